@@ -1,15 +1,14 @@
 #version 330 core
 
-in vec2 TexCoord;
 in vec3 Normal;
 in vec3 FragPos;
+in float Fade;
 
 out vec4 FragColor;
 
 uniform vec3 lightPos;
 uniform vec3 lightColor;
 uniform vec3 viewPos;
-uniform float time;
 
 void main() {
     // Pure white clouds like Minecraft
@@ -27,20 +26,9 @@ void main() {
     
     vec3 result = (ambient + diffuse) * cloudColor;
     
-    // Create Minecraft-style cloud texture with holes
-    vec2 cloudCoord = TexCoord * 8.0; // 8x8 texture pattern per face
-    
-    // Add slow movement
-    float moveSpeed = 0.002;
-    cloudCoord.x += time * moveSpeed;
-    
-    // Solid Minecraft-style clouds - no holes, no cheese!
-    vec2 pixelGrid = floor(cloudCoord);
-    float pixelHash = sin(pixelGrid.x * 127.1 + pixelGrid.y * 311.7) * 43758.5453;
-    pixelHash = fract(pixelHash);
-    
-    // Completely solid clouds with consistent alpha
-    float alpha = 0.6; // Medium alpha that looks good even when overlapping
+    // Completely solid clouds with consistent alpha, faded out at the edge of the grid
+    float alpha = 0.6 * Fade; // Medium alpha that looks good even when overlapping
+    if (alpha <= 0.0) discard;
     
     FragColor = vec4(result, alpha);
 }
@@ -1,21 +1,53 @@
 #version 330 core
 
+// One unit cube, drawn once per cloud cell in a gridSide x gridSide square
+// around the camera. Cells without cloud collapse to nothing
 layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec3 aNormal;
+layout (location = 1) in vec3 aNormal;
 
-out vec2 TexCoord;
 out vec3 Normal;
 out vec3 FragPos;
+out float Fade;
 
-uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
+uniform sampler2D cloudMap;   // Wrapping occupancy map, one texel per cell
+uniform vec3 cameraPos;
+uniform vec2 windOffset;      // How far the clouds have drifted, in blocks
+uniform float cellSize;       // Cell width in blocks
+uniform float cloudHeight;
+uniform float thickness;
+uniform int gridSide;
+
+bool hasCloud(vec2 cell) {
+    // The texture repeats, so any cell maps somewhere on it
+    return texture(cloudMap, (cell + 0.5) / vec2(textureSize(cloudMap, 0))).r > 0.5;
+}
+
 void main() {
-    FragPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
-    TexCoord = aTexCoord;
-    
+    // Cells are fixed to the drifting clouds; the square of them follows the camera
+    vec2 cameraCell = floor((cameraPos.xz - windOffset) / cellSize);
+    vec2 cell = cameraCell + vec2(gl_InstanceID % gridSide, gl_InstanceID / gridSide) - float(gridSide / 2);
+
+    // Skip empty cells, and sides facing another cloud cell so neighbours merge
+    bool side = aNormal.y == 0.0;
+    if (!hasCloud(cell) || (side && hasCloud(cell + aNormal.xz))) {
+        Normal = aNormal;
+        FragPos = vec3(0.0);
+        Fade = 0.0;
+        gl_Position = vec4(0.0);
+        return;
+    }
+
+    FragPos = vec3((cell.x + aPos.x) * cellSize + windOffset.x,
+                   cloudHeight + aPos.y * thickness,
+                   (cell.y + aPos.z) * cellSize + windOffset.y);
+    Normal = aNormal;
+
+    // Fade out toward the edge of the square so cells don't pop in
+    float radius = float(gridSide) * 0.5 * cellSize;
+    Fade = 1.0 - smoothstep(0.7, 1.0, length(FragPos.xz - cameraPos.xz) / radius);
+
     gl_Position = projection * view * vec4(FragPos, 1.0);
 }
@@ -0,0 +1,33 @@
+#version 330 core
+
+in vec3 Normal;
+in vec3 Color;
+in vec3 FragPos;
+
+out vec4 FragColor;
+
+uniform vec3 cameraPos;
+uniform vec2 innerCenter;   // Centre of the camera's chunk
+uniform float innerRadius;  // Loaded chunks cover this much - they draw themselves
+uniform float outerRadius;  // Where the horizon ends
+uniform vec3 hazeColor;     // Sky colour at the horizon
+uniform vec3 lightDir;
+
+void main() {
+    if (length(FragPos.xz - innerCenter) < innerRadius) {
+        discard;
+    }
+
+    float distance = length(FragPos.xz - cameraPos.xz);
+    if (distance > outerRadius) {
+        discard;
+    }
+
+    // Same bright, mostly-ambient look as the chunks
+    float diff = max(dot(normalize(Normal), lightDir), 0.0) * 0.2;
+    vec3 result = (0.8 + diff) * Color;
+
+    // Fade into the sky over the outer half, so the edge never shows
+    float haze = smoothstep(outerRadius * 0.5, outerRadius, distance);
+    FragColor = vec4(mix(result, hazeColor, haze), 1.0);
+}
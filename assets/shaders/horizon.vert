@@ -0,0 +1,20 @@
+#version 330 core
+
+// Far-field terrain - world-space positions, one flat colour per sample
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec3 aColor;
+
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec3 Normal;
+out vec3 Color;
+out vec3 FragPos;
+
+void main() {
+    FragPos = aPos;
+    Normal = aNormal;
+    Color = aColor;
+    gl_Position = projection * view * vec4(aPos, 1.0);
+}
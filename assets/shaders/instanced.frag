@@ -0,0 +1,30 @@
+#version 330 core
+
+// Input from the vertex shader
+in vec2 TexCoord;
+in vec3 Normal;
+in vec3 FragPos;
+in vec4 Tint;
+
+// Output color for this pixel
+out vec4 FragColor;
+
+uniform sampler2D texture1;
+
+// Same lighting as basic.frag, so instances match the terrain
+uniform vec3 lightPos;
+uniform vec3 lightColor;
+
+void main() {
+    vec4 textureColor = texture(texture1, TexCoord) * Tint;
+    
+    float ambientStrength = 0.8;
+    vec3 ambient = ambientStrength * lightColor;
+    
+    vec3 norm = normalize(Normal);
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(norm, lightDir), 0.0) * 0.2;
+    vec3 diffuse = diff * lightColor;
+    
+    FragColor = vec4((ambient + diffuse) * textureColor.rgb, textureColor.a);
+}
@@ -0,0 +1,35 @@
+#version 330 core
+
+// Input attributes from the shared mesh
+layout (location = 0) in vec3 aPos;      // Vertex position
+layout (location = 1) in vec2 aTexCoord; // Texture coordinates
+layout (location = 2) in vec3 aNormal;   // Surface normal
+
+// Per-instance attributes - advance once per copy, not per vertex
+layout (location = 3) in mat4 aModel;     // Object-to-world transformation (locations 3-6)
+layout (location = 7) in vec4 aColor;     // Tint
+layout (location = 8) in vec2 aTexOffset; // Texture atlas offset
+
+// Transformation matrices
+uniform mat4 view;       // World-to-camera transformation
+uniform mat4 projection; // Camera-to-screen transformation
+
+// Output to fragment shader
+out vec2 TexCoord;
+out vec3 Normal;
+out vec3 FragPos;
+out vec4 Tint;
+
+void main() {
+    vec4 worldPos = aModel * vec4(aPos, 1.0);
+    gl_Position = projection * view * worldPos;
+    
+    TexCoord = aTexCoord + aTexOffset;
+    
+    // Instances are only rotated and uniformly scaled, so the model matrix
+    // turns normals correctly - the fragment shader normalizes them
+    Normal = mat3(aModel) * aNormal;
+    
+    FragPos = worldPos.xyz;
+    Tint = aColor;
+}
@@ -0,0 +1,18 @@
+#version 330 core
+
+in vec2 TexCoord;
+in vec4 Color;
+out vec4 FragColor;
+
+uniform sampler2D uiAtlas;
+
+void main() {
+    vec4 texColor = texture(uiAtlas, TexCoord);
+    
+    // Discard fully transparent pixels
+    if (texColor.a < 0.1) {
+        discard;
+    }
+    
+    FragColor = vec4(texColor.rgb * Color.rgb, texColor.a * Color.a);
+}
@@ -2,17 +2,15 @@
 
 layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;
 
 out vec2 TexCoord;
+out vec4 Color;
 
 uniform mat4 projection;
-uniform vec2 position;
-uniform vec2 size;
 
 void main() {
-    // Scale and position the quad
-    vec2 scaledPos = aPos * size + position;
-    
-    gl_Position = projection * vec4(scaledPos, 0.0, 1.0);
+    gl_Position = projection * vec4(aPos, 0.0, 1.0);
     TexCoord = aTexCoord;
+    Color = aColor;
 }
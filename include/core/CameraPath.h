@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <string>
+
+class Camera;
+
+/**
+ * CameraPath - scripted camera for headless benchmark runs
+ *
+ * The camera's position and direction are a function of the frame number
+ * only, so every run renders the same views:
+ *   orbit   - a full turn on a small circle, looking out, slightly down.
+ *             It never leaves the chunk it starts in, so no chunk loads or
+ *             unloads once the world around it has settled
+ *   flyover - a straight line at flying speed, streaming new chunks in
+ */
+class CameraPath {
+public:
+    enum class Kind { ORBIT, FLYOVER };
+
+    CameraPath(Kind kind, const glm::vec3& start, int frames);
+
+    // false for a name that isn't a path
+    static bool parse(const std::string& name, Kind& kind);
+    static const char* name(Kind kind);
+
+    void apply(int frame, Camera& camera) const;
+
+    static constexpr float ORBIT_RADIUS = 6.0f;      // Blocks - stays inside the start chunk
+    static constexpr float FLYOVER_SPEED = 20.0f;    // Blocks per second
+    static constexpr float FRAME_TIME = 1.0f / 60.0f; // Scripted time per frame
+
+private:
+    Kind m_kind;
+    glm::vec3 m_start;
+    int m_frames;
+};
@@ -4,36 +4,56 @@
 #include <glm/glm.hpp>
 #include "world/WorldConfig.h"
 #include "world/Block.h"
+#include "utils/ModernCpp.h"
+#include "core/CameraPath.h"
 
 class Window;
 class ChunkRenderer;
 class CloudRenderer;
 class SkyboxRenderer;
 class SunRenderer;
+class HorizonRenderer;
+class InstancedRenderer;
+class VoxelCollider;
 class Camera;
 class World;
+class UIBatch;
 class LoadingScreen;
 class Crosshair;
 class BlockOutline;
 class Hotbar;
 class RayVisualization;
 
-class ItemEntity;
+class ItemStore;
 struct GLFWwindow;
 
+// 🖥️ --headless: render offscreen along a scripted camera path and print frame statistics
+struct HeadlessOptions {
+    bool enabled = false;
+    int width = 1280;
+    int height = 720;
+    int frames = 600;                       // Measured frames, after the world has settled
+    CameraPath::Kind path = CameraPath::Kind::ORBIT;
+    std::vector<int> checksumFrames;        // Frames whose pixels are hashed and printed
+};
+
 class Game {
 public:
     Game();
+    explicit Game(const HeadlessOptions& headless);
     ~Game();
     
     void run();
     
 private:
+    void runHeadless();
+    void settleHeadless();  // Renders until the chunks around the camera stop changing
     void initialize();
     void update(float deltaTime);
     void render();
     void cleanup();
     void processInput(float deltaTime);
+    void movePlayer(const glm::vec3& motion, bool jump, float deltaTime);  // Collides the camera's move with the blocks
     void handleBlockBreaking(); // Handle block breaking when left mouse is clicked
     void handleBlockPlacement(); // Handle block placement when right mouse is clicked
     
@@ -41,6 +61,7 @@ private:
     void updateItemEntities(float deltaTime);
     void renderItemEntities();
     void spawnItemEntity(const glm::vec3& position, BlockType blockType);
+    void spawnBenchmarkItems(int count);
     void checkItemCollection();
     
     std::unique_ptr<Window> m_window;
@@ -48,27 +69,47 @@ private:
     std::unique_ptr<CloudRenderer> m_cloudRenderer;
     std::unique_ptr<SkyboxRenderer> m_skyboxRenderer;
     std::unique_ptr<SunRenderer> m_sunRenderer;
+    std::unique_ptr<HorizonRenderer> m_horizonRenderer;
+    std::unique_ptr<InstancedRenderer> m_itemRenderer;
     std::unique_ptr<Camera> m_camera;
     std::unique_ptr<World> m_world;
+    std::unique_ptr<UIBatch> m_uiBatch;  // Every 2D element queues its quads here
     std::unique_ptr<LoadingScreen> m_loadingScreen;
     std::unique_ptr<Crosshair> m_crosshair;
     std::unique_ptr<BlockOutline> m_blockOutline;
     std::unique_ptr<Hotbar> m_hotbar;
     std::unique_ptr<RayVisualization> m_rayVisualization;
 
-    std::vector<std::unique_ptr<ItemEntity>> m_itemEntities;
+    std::unique_ptr<ItemStore> m_items;
+    std::unique_ptr<VoxelCollider> m_playerCollider;
+    float m_playerFallSpeed;  // Upward speed while walking - gravity and jumps
+    bool m_playerOnGround;
     bool m_running;
     float m_lastFrameTime;
+    float m_time;  // Seconds the sky, sun and clouds animate by - scripted when headless
+    HeadlessOptions m_headless;
     
     // FPS tracking
     float m_frameCount;
     float m_fpsTimer;
     float m_currentFPS;
+    float m_itemUpdateMs;  // CPU time of the last item update and collection
+    float m_itemRenderMs;  // CPU time of the last item pass
     
     // Loading state
     bool m_isLoading;
     float m_loadingStartTime;
     
+    // ⏱️ Startup phases, in ms, reported once the first frame is shown
+    struct StartupTimes {
+        double window = 0.0;     // Config, window and GL state
+        double world = 0.0;      // Asset prefetch and world generation started
+        double renderers = 0.0;  // Renderer setup - GL uploads and shader compiles
+    } m_startupTimes;
+    Utils::Timer m_startupTimer;  // Runs from construction
+    bool m_startupReported;
+    void reportStartup();
+    
     // Mouse handling
     bool m_firstMouse;
     float m_lastX, m_lastY;
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A texture as stored in a bundle: RGBA8, every mip level, bottom row first
+// as glTexImage2D takes it. Level n follows level n-1 and is half its size
+struct PackedTexture {
+    int width = 0;
+    int height = 0;
+    int levels = 0;
+    const uint8_t* pixels = nullptr;  // Into the mapped bundle
+
+    const uint8_t* level(int n, int& levelWidth, int& levelHeight) const;
+};
+
+/**
+ * AssetBundle - every texture and shader source baked into one file
+ *
+ * Layout:   [header][entry table][path strings][data...]
+ * Textures are stored decoded and fully mipmapped, so loading one is a
+ * glTexImage2D per level straight out of the mapping - no image decoding and
+ * no glGenerateMipmap. Shader sources are stored as text. The file is written
+ * at build time by tools/asset_packer and mmapped read-only at startup.
+ *
+ * Each entry remembers its source file's modification time. An entry whose
+ * loose file has changed since is reported missing, so an edited shader or
+ * texture is picked up from disk without repacking. GL-free.
+ */
+class AssetBundle {
+public:
+    AssetBundle();
+    ~AssetBundle();
+
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    bool open(const std::string& path);
+    bool isOpen() const { return m_mapped != nullptr; }
+
+    // nullptr / false when the bundle doesn't have the file or it is stale
+    const PackedTexture* findTexture(const std::string& path) const;
+    bool findShader(const std::string& path, std::string& source) const;
+
+    size_t getTextureCount() const { return m_textures.size(); }
+    size_t getShaderCount() const { return m_shaders.size(); }
+
+    // Modification time of a file as the bundle records it, -1 if it doesn't exist
+    static int64_t sourceTime(const std::string& path);
+
+    // Bytes of a full mip chain of RGBA8 levels
+    static size_t mipChainSize(int width, int height, int levels);
+
+    static constexpr const char* DEFAULT_PATH = "assets.bundle";
+
+private:
+    struct ShaderSource {
+        const char* text;
+        size_t length;
+        int64_t sourceTime;
+    };
+    struct TextureEntry {
+        PackedTexture texture;
+        int64_t sourceTime;
+    };
+
+    bool isFresh(const std::string& path, int64_t recordedTime) const;
+    void close();
+
+    int m_fd;
+    const uint8_t* m_mapped;
+    size_t m_mappedSize;
+    std::unordered_map<std::string, TextureEntry> m_textures;
+    std::unordered_map<std::string, ShaderSource> m_shaders;
+
+    friend class AssetBundleWriter;
+    static constexpr uint32_t MAGIC = 0x4241434D;  // "MCAB"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t TYPE_TEXTURE = 0;
+    static constexpr uint32_t TYPE_SHADER = 1;
+    static constexpr size_t DATA_ALIGNMENT = 16;
+
+    // On-disk records, native byte order
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+    struct Entry {
+        uint32_t type;
+        uint32_t pathOffset;   // From the start of the file
+        uint32_t pathLength;
+        uint32_t width;        // Textures only
+        uint32_t height;
+        uint32_t levels;
+        uint64_t dataOffset;   // From the start of the file
+        uint64_t dataSize;
+        int64_t sourceTime;
+    };
+};
+
+/**
+ * AssetBundleWriter - collects textures and shader sources, then writes a bundle
+ */
+class AssetBundleWriter {
+public:
+    // pixels holds the whole mip chain in PackedTexture's layout
+    void addTexture(const std::string& path, int width, int height, int levels, std::vector<uint8_t> pixels,
+                    int64_t sourceTime);
+    void addShader(const std::string& path, std::string source, int64_t sourceTime);
+
+    bool write(const std::string& path) const;
+
+private:
+    struct Item {
+        std::string path;
+        uint32_t type;
+        int width = 0;
+        int height = 0;
+        int levels = 0;
+        std::vector<uint8_t> data;
+        int64_t sourceTime;
+    };
+    std::vector<Item> m_items;
+};
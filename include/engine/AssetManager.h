@@ -2,16 +2,34 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <future>
+#include <vector>
 #include <typeinfo>
 #include <typeindex>
+#include "engine/graphics/ProgramBinaryCache.h"
 
 // Forward declarations
 class Texture;
 class Shader;
+class AssetBundle;
+struct ImageData;
 
 /**
  * Centralized Asset Management System
  * Handles loading, caching, and lifetime of all game assets
+ *
+ * ⚡ prefetch() decodes images and reads shader sources on worker threads.
+ * Later loads of those paths wait for the worker's result and only do the GL
+ * upload or compile, which stays on the thread that owns the context. Paths
+ * nobody prefetched are read on the spot, as before.
+ *
+ * ⚡ Files found in the asset bundle (see AssetBundle) come from it instead:
+ * textures upload their baked mip levels straight from the mapping and
+ * shader sources are copied out of it. Loose files are the fallback, and win
+ * over a bundled copy that is older than they are.
+ *
+ * ⚡ Shader programs come from the ProgramBinaryCache when it has them, and are
+ * compiled from source and added to it when it doesn't.
  */
 class AssetManager {
 public:
@@ -29,7 +47,17 @@ public:
     // Get cached shader by name
     std::shared_ptr<Shader> getShader(const std::string& name);
     
-    // Preload commonly used assets
+    // Decoded pixels of an image file - prefetched, or decoded now. nullptr on failure
+    std::shared_ptr<const ImageData> loadImage(const std::string& path);
+    
+    // Text of a shader source file - prefetched, or read now. Empty on failure
+    std::string loadShaderSource(const std::string& path);
+    
+    // Starts reading these files on worker threads; returns at once
+    void prefetch(const std::vector<std::string>& imagePaths, const std::vector<std::string>& shaderPaths);
+    
+    // Opens the asset bundle, then prefetches whatever the game needs that it lacks
+    // (nothing on a single core, where the prefetch would only slow startup down)
     void preloadAssets();
     
     // Clear all cached assets
@@ -39,12 +67,26 @@ public:
     size_t getCachedTextureCount() const { return m_textures.size(); }
     size_t getCachedShaderCount() const { return m_shaders.size(); }
     
+    // ⏱️ Time spent creating shader programs, cached binaries and compiles alike
+    double getShaderSetupMs() const { return m_shaderSetupMs; }
+    const ProgramBinaryCache& getProgramCache() const { return m_programCache; }
+    
 private:
-    AssetManager() = default;
+    AssetManager();
+    ~AssetManager();
+    
+    std::unique_ptr<AssetBundle> m_bundle;  // Stays mapped while textures may still be loaded from it
+    ProgramBinaryCache m_programCache;
+    double m_shaderSetupMs = 0.0;
     
     std::unordered_map<std::string, std::shared_ptr<Texture>> m_textures;
     std::unordered_map<std::string, std::shared_ptr<Shader>> m_shaders;
     
+    // Worker results by path. Decoded images stay until clearCache(), since the UI
+    // atlas and a GL texture may both want the same file
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<const ImageData>>> m_images;
+    std::unordered_map<std::string, std::shared_future<std::string>> m_shaderSources;
+    
     // Helper to generate shader keys
     std::string makeShaderKey(const std::string& vertPath, const std::string& fragPath);
 };
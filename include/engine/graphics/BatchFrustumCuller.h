@@ -0,0 +1,54 @@
+#pragma once
+
+#include "engine/graphics/Frustum.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+/**
+ * BatchFrustumCuller - frustum test of many boxes at once
+ *
+ * Boxes are kept structure-of-arrays, so one plane is tested against eight
+ * boxes per AVX instruction (four with SSE, one at a time otherwise). With a
+ * cell size, boxes are grouped into square cells first: a cell entirely
+ * outside the frustum rejects all its boxes at once, and one entirely inside
+ * accepts them untested - a one-level quadtree, which at chunk counts saves
+ * more than deeper levels would cost.
+ *
+ * Add boxes, build(), then cull() as often as the frustum changes. GL-free.
+ */
+class BatchFrustumCuller {
+public:
+    explicit BatchFrustumCuller(float cellSize = 0.0f);  // World units per cell side, 0 = no cells
+
+    void clear();
+    void add(const glm::vec3& min, const glm::vec3& max);  // Index is the add order
+    void build();
+
+    // Indices of the boxes that touch the frustum, in no particular order
+    void cull(const Frustum& frustum, std::vector<int>& visible) const;
+
+    int size() const { return static_cast<int>(m_ids.size()); }
+
+    // Statistics of the last cull
+    int getCellsRejected() const { return m_cellsRejected; }
+    int getCellsAccepted() const { return m_cellsAccepted; }
+
+private:
+    struct Cell {
+        glm::vec3 min;
+        glm::vec3 max;
+        int begin;
+        int end;
+    };
+
+    float m_cellSize;
+    std::vector<glm::vec3> m_addedMin, m_addedMax;  // Add order, until build()
+    std::vector<float> m_minX, m_minY, m_minZ;      // Cell order, padded to a whole SIMD block
+    std::vector<float> m_maxX, m_maxY, m_maxZ;
+    std::vector<int> m_ids;                         // Add index of each slot
+    std::vector<Cell> m_cells;
+    mutable int m_cellsRejected;
+    mutable int m_cellsAccepted;
+
+    void testRange(const Frustum& frustum, int begin, int end, std::vector<int>& visible) const;
+};
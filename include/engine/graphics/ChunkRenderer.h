@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <glm/glm.hpp>
 #include "world/Block.h"
+#include "world/ChunkLODManager.h"
 
 class Shader;
 class Chunk;
@@ -22,7 +23,13 @@ public:
     ~ChunkRenderer();
     
     bool initialize();
-    void renderChunk(const Chunk& chunk, const glm::mat4& view, const glm::mat4& projection);
+    // faceMask picks the face directions to submit (ChunkFacePlanes::getVisibleFaces)
+    void renderChunk(const Chunk& chunk, const glm::mat4& view, const glm::mat4& projection,
+                     unsigned int faceMask = ChunkFacePlanes::ALL_FACES);
+    
+    // Draw a chunk from its downsampled LOD meshes instead of its own
+    void renderLODChunk(const ChunkLODManager::LODMeshes& meshes, const glm::mat4& view, const glm::mat4& projection,
+                        unsigned int faceMask = ChunkFacePlanes::ALL_FACES);
     
     // Get texture coordinates for a block type
     TextureCoords getTextureCoords(BlockType blockType) const;
@@ -45,6 +52,8 @@ private:
     std::unordered_map<BlockType, TextureCoords> m_textureCoords;
     
     void initializeTextureCoords();
+    void useShader(const glm::mat4& view, const glm::mat4& projection);
+    std::shared_ptr<Texture> getLayerTexture(int layer) const;
     void renderBlockType(const Chunk& chunk, BlockType blockType, 
-                        const glm::mat4& view, const glm::mat4& projection);
+                        const glm::mat4& view, const glm::mat4& projection, unsigned int faceMask);
 };
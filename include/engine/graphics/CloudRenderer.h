@@ -6,12 +6,14 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 class Shader;
-class Mesh;
 
 /**
  * CloudRenderer - Renders smooth, infinitely moving clouds like Minecraft
- * Creates a large static cloud mesh that moves smoothly via shader animation
- * No discrete mesh regeneration - clouds move continuously through time
+ * ⚡ All cloud geometry is one static cube, drawn instanced once per cell of a
+ * gridSize*2 square around the camera. Whether a cell holds cloud comes from a
+ * small wrapping occupancy texture the vertex shader samples, scrolled by the
+ * wind - the CPU builds the cube and the texture once and never touches
+ * geometry again, however far the player travels
  */
 class CloudRenderer {
 public:
@@ -26,8 +28,7 @@ public:
     // Configuration
     void setCloudHeight(float height) { m_cloudHeight = height; }
     void setCloudSpeed(float speed) { m_cloudSpeed = speed; }
-    void setCloudDensity(float density) { m_cloudDensity = density; }
-    void setCloudUpdateDistance(float distance) { m_cloudUpdateDistance = distance; }
+    void setCloudDensity(float density);
     void setCloudGridSize(int size) { m_cloudGridSize = size; }
     void setCloudSpacing(float spacing) { m_cloudSpacing = spacing; }
     void setCloudLayers(int layers) { m_cloudLayers = layers; }
@@ -35,7 +36,13 @@ public:
     
 private:
     std::shared_ptr<Shader> m_shader;
-    std::unique_ptr<Mesh> m_cloudMesh;
+    
+    // Static cube and the cloud occupancy map
+    unsigned int m_VAO = 0;
+    unsigned int m_VBO = 0;
+    unsigned int m_EBO = 0;
+    unsigned int m_cloudMap = 0;
+    bool m_cloudMapDirty = false;    // Density changed - refill the map before drawing
     
     // Cloud parameters
     float m_cloudHeight = 80.0f;     // Height above ground (balanced height)
@@ -43,20 +50,12 @@ private:
     float m_cloudDensity = 0.5f;     // How dense the clouds are
     float m_time = 0.0f;             // Current animation time
     
-    // Player position tracking for cloud generation
-    glm::vec3 m_lastPlayerPos = glm::vec3(0.0f);
-    float m_cloudUpdateDistance = 64.0f;  // Regenerate clouds when player moves this far
-    
-    // Cloud generation parameters (configurable)
-    int m_cloudGridSize = 32;
-    float m_cloudSpacing = 8.0f;
+    // Cloud grid parameters (configurable)
+    int m_cloudGridSize = 32;        // Cells drawn each side of the camera
+    float m_cloudSpacing = 8.0f;     // Width of one cloud cell in blocks
     int m_cloudLayers = 6;
     float m_cloudLayerSpacing = 2.5f;
     
-    // Smooth movement parameters
-    float m_windVariation = 0.0f;     // For natural wind movement
-    float m_lastUpdateTime = 0.0f;    // Track time for smooth updates
-    
-    void generateCloudMeshAroundPosition(const glm::vec3& centerPos);
-    void createCloudCube(float x, float z, float baseHeight, float size, float height, std::vector<float>& vertices, std::vector<unsigned int>& indices, unsigned int& vertexIndex);
+    void createCubeMesh();
+    void uploadCloudMap();
 };
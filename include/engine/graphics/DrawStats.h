@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * DrawStats - draw calls and triangles submitted since the last reset
+ *
+ * 📊 Every glDraw* call site records itself here, so one frame's totals
+ * cover all passes: sky, chunks, horizon, clouds, items and UI. Triangles
+ * are what was submitted, before culling or the vertex shader collapsing
+ * any. Used from the GL thread only, like the context it counts for.
+ */
+struct DrawStats {
+    int drawCalls = 0;
+    uint64_t triangles = 0;
+
+    void reset() { *this = DrawStats(); }
+
+    // A GL_TRIANGLES draw of vertexCount vertices or indices, instances times over
+    void recordTriangles(uint64_t vertexCount, uint64_t instances = 1) {
+        drawCalls++;
+        triangles += vertexCount / 3 * instances;
+    }
+
+    // Lines and points - a draw call, no triangles
+    void recordOther() { drawCalls++; }
+};
+
+extern DrawStats g_drawStats;
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "engine/graphics/Shader.h"
+#include "world/HorizonField.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+/**
+ * HorizonRenderer - draws the HorizonField clipmap past the loaded chunks
+ * One vertex buffer per level, re-uploaded only when that level scrolls.
+ * Fragments over the loaded area are discarded (the chunks draw themselves
+ * there), and the far edge fades into the sky's horizon colour.
+ */
+class HorizonRenderer {
+public:
+    HorizonRenderer();
+    ~HorizonRenderer();
+
+    bool initialize(const ModularWorldGenerator* generator, float radius);
+    void update(const glm::vec3& cameraPos);
+    void render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPos);
+    void cleanup();
+
+    // Blocks around the camera's chunk covered by real chunks
+    void setInnerRadius(float radius) { m_innerRadius = radius; }
+    void setRadius(float radius);
+
+    // Statistics
+    size_t getTriangleCount() const;
+    size_t getSamplesTaken() const { return m_field ? m_field->getSamplesTaken() : 0; }
+
+private:
+    struct LevelBuffers {
+        unsigned int VAO = 0;
+        unsigned int VBO = 0;
+        unsigned int EBO = 0;
+        int indexCount = 0;
+    };
+
+    std::shared_ptr<Shader> m_shader;
+    std::unique_ptr<HorizonField> m_field;
+    std::vector<LevelBuffers> m_levels;
+    HorizonMeshData m_meshData;     // Reused between uploads
+    float m_radius;
+    float m_innerRadius;
+    bool m_initialized;
+
+    void uploadLevel(int level);
+    void resizeLevels();
+};
@@ -13,6 +13,10 @@ class Texture;
  * GPU Instanced Rendering System
  * Renders multiple identical objects (like grass, flowers, debris) in a single draw call
  * Massive performance improvement for repeated geometry
+ *
+ * Each block type gets one cube mesh and one instance buffer. Instances are
+ * re-added every frame and streamed to the GPU in one upload per type, so
+ * moving objects cost a matrix each rather than a draw call each.
  */
 class InstancedRenderer {
 public:
@@ -54,14 +58,19 @@ private:
         std::vector<InstanceData> instances;
         unsigned int instanceVBO;
         unsigned int VAO, VBO, EBO;
+        size_t capacity;        // Instances the instance buffer has room for
         std::shared_ptr<Texture> texture;
         bool needsUpdate;
         
-        InstanceGroup() : instanceVBO(0), VAO(0), VBO(0), EBO(0), needsUpdate(true) {}
+        InstanceGroup() : instanceVBO(0), VAO(0), VBO(0), EBO(0), capacity(0), needsUpdate(true) {}
     };
     
     std::unordered_map<BlockType, std::unique_ptr<InstanceGroup>> m_instanceGroups;
-    std::unique_ptr<Shader> m_instancedShader;
+    std::shared_ptr<Shader> m_instancedShader;
+    
+    // Lighting - same as the chunks
+    glm::vec3 m_lightPos;
+    glm::vec3 m_lightColor;
     
     int m_drawCalls;
     bool m_initialized;
@@ -23,6 +23,13 @@ public:
     void render() const;
     void clear();
     
+    // ⚡ Index ranges that can be drawn on their own - group i is indices starts[i]
+    // to starts[i + 1], up to MAX_GROUPS. Set after setIndices; clear() forgets them
+    static constexpr int MAX_GROUPS = 32;
+    void setIndexGroups(const unsigned int* starts, int groupCount);
+    // Draw only the groups whose bit is set, as one multi-draw (everything without groups)
+    void renderGroups(unsigned int groupMask) const;
+    
     // Utility methods for block rendering
     static std::vector<Vertex> generateCubeVertices(const glm::vec3& position, float size = 1.0f);
     static std::vector<unsigned int> generateCubeIndices(unsigned int baseIndex = 0);
@@ -31,6 +38,7 @@ private:
     unsigned int m_VAO, m_VBO, m_EBO;
     std::vector<Vertex> m_vertices;
     std::vector<unsigned int> m_indices;
+    std::vector<unsigned int> m_groupStarts;  // Group count + 1 entries, empty if ungrouped
     bool m_uploaded;
     
     void setupMesh();
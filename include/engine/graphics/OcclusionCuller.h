@@ -1,72 +1,113 @@
 #pragma once
 
+#include "world/Chunk.h"
 #include <glm/glm.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
-#include <memory>
-
-class Shader;
 
 /**
- * GPU Occlusion Culling System
- * Uses OpenGL queries to determine which chunks are actually visible
- * Dramatically improves performance in complex scenes
+ * OcclusionCuller - software-rasterized occlusion culling on the CPU
+ *
+ * The nearest chunks' ChunkOccluder boxes are rasterized into a small depth
+ * buffer, four pixels at a time with SSE where the target has it, and every
+ * other chunk's bounding box is tested against that buffer: a box whose
+ * nearest point lies behind the occluders across its whole screen rectangle
+ * is hidden. Occluders only ever cover solid blocks, each pixel keeps the
+ * farthest depth its occluder reaches, and tested rectangles are grown by a
+ * pixel, so the low resolution never hides something that shows.
+ *
+ * Depth is stored as 1/w - it interpolates linearly across the screen, and 0
+ * (cleared) is infinitely far away.
+ *
+ * The synchronous calls are GL-free, so known scenes test headless. In game,
+ * submit() hands a frame to a worker thread that runs while that frame draws,
+ * and the next frame picks up the hidden chunks with takeResult().
  */
 class OcclusionCuller {
 public:
+    static constexpr int WIDTH = 256;
+    static constexpr int HEIGHT = 128;
+
+    struct Occluder {
+        glm::ivec2 chunkPos;
+        ChunkOccluder shape;
+    };
+
+    // Chunk and the bounding box to test for it
+    struct Candidate {
+        glm::ivec2 chunkPos;
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    // Everything the worker needs for one frame, copied so chunks can change meanwhile
+    struct Frame {
+        glm::mat4 viewProjection = glm::mat4(1.0f);
+        glm::vec3 cameraPos = glm::vec3(0.0f);
+        glm::vec3 cameraForward = glm::vec3(0.0f, 0.0f, -1.0f);
+        std::vector<Occluder> occluders;
+        std::vector<Candidate> candidates;
+    };
+
+    struct Result {
+        glm::vec3 cameraPos = glm::vec3(0.0f);
+        glm::vec3 cameraForward = glm::vec3(0.0f, 0.0f, -1.0f);
+        std::vector<glm::ivec2> hidden;
+        int tested = 0;
+        int occluderQuads = 0;
+        float milliseconds = 0.0f;
+
+        // Results lag a frame - only trust them while the camera has barely moved
+        bool isValidFor(const glm::vec3& position, const glm::vec3& forward) const;
+    };
+
     OcclusionCuller();
     ~OcclusionCuller();
-    
-    bool initialize();
-    void cleanup();
-    
-    // Test if a chunk bounding box is visible
-    bool isChunkVisible(const glm::vec3& chunkMin, const glm::vec3& chunkMax, 
-                       const glm::mat4& viewProjection);
-    
-    // Begin occlusion testing frame
-    void beginFrame();
-    
-    // End occlusion testing frame and retrieve results
-    void endFrame();
-    
-    // Enable/disable occlusion culling
-    void setEnabled(bool enabled) { m_enabled = enabled; }
-    bool isEnabled() const { return m_enabled; }
-    
-    // Performance statistics
-    int getTestedChunks() const { return m_testedChunks; }
-    int getVisibleChunks() const { return m_visibleChunks; }
-    float getCullingEfficiency() const { 
-        return m_testedChunks > 0 ? (float)m_visibleChunks / m_testedChunks : 1.0f; 
-    }
+
+    OcclusionCuller(const OcclusionCuller&) = delete;
+    OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+    // Synchronous use - clear, rasterize occluders, then test boxes
+    void beginFrame(const glm::mat4& viewProjection, const glm::vec3& cameraPos);
+    void addOccluder(const glm::ivec2& chunkPos, const ChunkOccluder& shape);
+    bool isBoxVisible(const glm::vec3& min, const glm::vec3& max) const;
+    void run(const Frame& frame, Result& result);
+
+    // ⚡ Asynchronous use - the worker starts on the first submit. A frame it
+    // hasn't started yet is replaced; don't mix with the synchronous calls
+    void submit(Frame&& frame);
+    bool takeResult(Result& result);  // False if nothing finished since the last take
+    bool waitForResult(Result& result);  // Blocks until the last submitted frame is done - same frames, same results
+
+    // Statistics of the current depth buffer
+    int getOccluderQuads() const { return m_occluderQuads; }
+    const std::vector<float>& getDepthBuffer() const { return m_depth; }
 
 private:
-    struct OcclusionQuery {
-        unsigned int queryId;
-        glm::vec3 chunkMin, chunkMax;
-        bool resultReady;
-        bool isVisible;
-        int framesSinceTest;
+    struct ScreenVertex {
+        float x, y;   // Pixels, y up
+        float depth;  // 1/w
     };
-    
-    std::vector<std::unique_ptr<OcclusionQuery>> m_queries;
-    std::unique_ptr<Shader> m_occlusionShader;
-    
-    unsigned int m_boundingBoxVAO, m_boundingBoxVBO;
-    bool m_enabled;
-    bool m_initialized;
-    
-    // Performance tracking
-    int m_testedChunks;
-    int m_visibleChunks;
-    
-    // Create simple bounding box geometry for occlusion testing
-    void createBoundingBoxGeometry();
-    
-    // Render a bounding box for occlusion testing
-    void renderBoundingBox(const glm::vec3& min, const glm::vec3& max, 
-                          const glm::mat4& viewProjection);
-    
-    // Get or create an occlusion query for a chunk
-    OcclusionQuery* getQuery(const glm::vec3& chunkMin, const glm::vec3& chunkMax);
+
+    std::vector<float> m_depth;
+    glm::mat4 m_viewProjection;
+    glm::vec3 m_cameraPos;
+    int m_occluderQuads;
+
+    // Worker
+    std::thread m_worker;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    Frame m_pendingFrame;
+    Result m_finishedResult;
+    bool m_hasPendingFrame;
+    bool m_running;  // Worker is on a frame it took
+    bool m_hasFinishedResult;
+    bool m_stop;
+
+    void rasterizeQuad(const glm::vec3 corners[4]);
+    void rasterizePolygon(const ScreenVertex* vertices, int count);
+    void workerLoop();
 };
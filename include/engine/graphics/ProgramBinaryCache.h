@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class Shader;
+
+/**
+ * ProgramBinaryCache - linked shader programs kept on disk between runs
+ *
+ * ⚡ After a program is compiled and linked from source, its driver binary
+ * (glGetProgramBinary) is written to one file per program. The next launch
+ * hands that binary back with glProgramBinary and skips compiling and
+ * linking. Files are named by a hash of both sources and the driver's
+ * vendor, renderer and version strings, so an edited shader or an updated
+ * driver simply misses. A binary the driver refuses anyway is deleted and the
+ * program is compiled from source as usual.
+ *
+ * Needs a current GL context. Does nothing where the driver offers no binary formats.
+ */
+class ProgramBinaryCache {
+public:
+    explicit ProgramBinaryCache(std::string directory = DEFAULT_DIRECTORY);
+
+    // Links shader from the cached binary for these sources. false on a miss
+    bool load(Shader& shader, const std::string& vertexSource, const std::string& fragmentSource);
+
+    // Saves the binary of a shader just linked from these sources
+    void store(const Shader& shader, const std::string& vertexSource, const std::string& fragmentSource);
+
+    bool isSupported();
+
+    int getHits() const { return m_hits; }
+    int getMisses() const { return m_misses; }
+
+    static constexpr const char* DEFAULT_DIRECTORY = "shader_cache";
+
+private:
+    uint64_t makeKey(const std::string& vertexSource, const std::string& fragmentSource) const;
+    std::string pathFor(uint64_t key) const;
+
+    std::string m_directory;
+    std::string m_driver;  // Vendor, renderer and version - read with the first program
+    bool m_checked;
+    bool m_supported;
+    int m_hits;
+    int m_misses;
+
+    // File layout: header, then the driver's binary
+    static constexpr uint32_t MAGIC = 0x4250434D;  // "MCPB"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t MAX_BINARY_SIZE = 64u << 20;  // A larger length means a damaged file
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t format;  // Driver binary format, as glGetProgramBinary reported it
+        uint32_t length;
+        uint64_t key;     // Guards against a file that was renamed or truncated
+    };
+};
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 class Shader {
@@ -12,6 +14,15 @@ public:
     bool loadFromFiles(const std::string& vertexPath, const std::string& fragmentPath);
     bool loadFromString(const std::string& vertexSource, const std::string& fragmentSource);
     
+    // Reads a source file - no GL involved, so any thread may call it. Empty on failure
+    static std::string loadShaderFile(const std::string& path);
+    
+    // ⚡ Linked program binaries, for ProgramBinaryCache. loadFromBinary fails quietly
+    // when the driver rejects the binary, so the caller can compile instead
+    bool loadFromBinary(unsigned int format, const std::vector<uint8_t>& binary);
+    bool getBinary(unsigned int& format, std::vector<uint8_t>& binary) const;
+    static bool supportsBinaries();  // Needs a current context
+    
     void use() const;
     unsigned int getProgram() const { return m_program; }
     
@@ -27,6 +38,5 @@ private:
     mutable std::unordered_map<std::string, int> m_uniformCache;
     
     unsigned int compileShader(const std::string& source, unsigned int type);
-    std::string loadShaderFile(const std::string& path);
     int getUniformLocation(const std::string& name) const;
 };
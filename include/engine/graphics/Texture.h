@@ -3,6 +3,17 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+
+// Pixels decoded from an image file: RGBA, top row first
+struct ImageData {
+    int width = 0;
+    int height = 0;
+    int channels = 0;  // Channels in the file - the pixels are always expanded to four
+    std::vector<unsigned char> pixels;
+};
+
+struct PackedTexture;
 
 class Texture {
 public:
@@ -10,6 +21,11 @@ public:
     ~Texture();
     
     bool loadFromFile(const std::string& filePath);
+    bool loadFromImage(const ImageData& image);  // GL upload only
+    bool loadFromPacked(const PackedTexture& packed);  // ⚡ Uploads baked mip levels - no glGenerateMipmap
+    
+    // ⚡ Needs no GL context, so it can run on any thread
+    static bool decodeFile(const std::string& filePath, ImageData& image);
     void bind(unsigned int textureUnit = 0) const;
     void unbind() const;
     
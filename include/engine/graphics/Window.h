@@ -1,17 +1,32 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 // Forward declaration
 struct GLFWwindow;
 
 class Window {
 public:
     Window(int width, int height, const char* title);
+    
+    // 🖥️ Offscreen: an EGL surfaceless context drawing into a framebuffer object,
+    // so no display or GLFW is needed. Input and title calls do nothing
+    struct Headless {};
+    Window(int width, int height, Headless);
     ~Window();
     
+    bool isHeadless() const { return m_headless; }
+    
+    // RGBA of what the last frame drew, bottom row first
+    void readPixels(std::vector<uint8_t>& pixels) const;
+    
     bool shouldClose() const;
     void swapBuffers();
     void pollEvents();
-    GLFWwindow* getHandle() const { return m_window; }
+    GLFWwindow* getHandle() const { return m_window; }  // nullptr when headless
+    void setTitle(const std::string& title);
     
     // 📏 Window dimensions and scalability
     void getFramebufferSize(int& width, int& height) const;
@@ -26,4 +41,11 @@ public:
     
 private:
     GLFWwindow* m_window;
+    
+    // Headless context and its render target
+    bool m_headless;
+    int m_width, m_height;
+    void* m_eglDisplay;
+    void* m_eglContext;
+    unsigned int m_framebuffer, m_colorBuffer, m_depthBuffer;
 };
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "world/Block.h"
+#include "world/VoxelCollider.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class ChunkView;
+
+/**
+ * ItemStore - every dropped item, stored component by component
+ *
+ * Each component is its own array (structure-of-arrays), so the physics step
+ * streams through positions and velocities without touching types or counts,
+ * and no item costs a heap allocation or a virtual call. Moving drops are
+ * swept through a VoxelCollider; drops at rest only check they still have a
+ * block under them.
+ *
+ * Items are found by position through a uniform-grid spatial hash rebuilt
+ * after each step: a counting sort of the items by hashed cell, so a query
+ * only looks at the cells around it instead of every item.
+ *
+ * Identical drops that come to rest close together merge into one stack, as
+ * Minecraft does, which keeps piles from mining or explosions cheap to draw
+ * and simulate. Only stacks that moved since they were last checked look for
+ * partners - distance is symmetric, so a newcomer finds the stacks already at
+ * rest - and a field of settled drops costs nothing to merge.
+ * GL-free - Game hands getModelMatrix() to an InstancedRenderer.
+ */
+class ItemStore {
+public:
+    static constexpr float COLLECTION_RADIUS = 0.8f;
+    static constexpr float PICKUP_DELAY = 0.5f;    // Seconds before a new drop can be collected
+    static constexpr float MERGE_RADIUS = 0.5f;
+    static constexpr int MAX_STACK = 99;           // Same as a hotbar slot
+    static constexpr float CELL_SIZE = 1.0f;       // Spatial hash cell side, >= the merge and pickup radii
+
+    // Offers a stack to whoever collects it; returns how many were taken
+    using TakeFunction = std::function<int(BlockType type, int count)>;
+
+    ItemStore();
+
+    // A drop at a position, tossed up with a little random spread
+    void spawn(const glm::vec3& position, BlockType type, int count = 1);
+    void spawn(const glm::vec3& position, const glm::vec3& velocity, BlockType type, int count);
+    void reserve(size_t capacity);
+    void clear();
+
+    // Physics and animation for every item, then merging and the spatial hash
+    void update(float deltaTime, ChunkView& view);
+
+    // Offers every collectable stack within COLLECTION_RADIUS of a point to take,
+    // removing what is taken. Returns the number of items taken.
+    int collect(const glm::vec3& point, const TakeFunction& take);
+
+    // Indices of the items within a radius of a point, as of the last update.
+    // Allocation-free for radii up to CELL_SIZE
+    void query(const glm::vec3& point, float radius, std::vector<int>& result) const;
+
+    size_t size() const { return m_type.size(); }
+    int getItemCount() const;  // Items in all stacks
+    glm::vec3 getPosition(size_t i) const { return glm::vec3(m_posX[i], m_posY[i], m_posZ[i]); }
+    glm::vec3 getVelocity(size_t i) const { return glm::vec3(m_velX[i], m_velY[i], m_velZ[i]); }
+    BlockType getType(size_t i) const { return m_type[i]; }
+    int getCount(size_t i) const { return m_count[i]; }
+    bool isOnGround(size_t i) const { return m_onGround[i] != 0; }
+
+    // Spinning, bobbing cube at the item's position
+    glm::mat4 getModelMatrix(size_t i) const;
+
+    void setMergingEnabled(bool enabled) { m_mergingEnabled = enabled; }
+
+private:
+    // Components, one entry per stack
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<float> m_velX, m_velY, m_velZ;
+    std::vector<float> m_age;
+    std::vector<BlockType> m_type;
+    std::vector<std::uint16_t> m_count;
+    std::vector<std::uint8_t> m_onGround;
+    std::vector<std::uint8_t> m_settled;  // At rest and already checked for merging
+
+    // Spatial hash: items of bucket b are m_cellItems[m_cellStart[b] .. m_cellStart[b + 1])
+    std::vector<int> m_cellStart;
+    std::vector<int> m_cellItems;
+    std::vector<std::uint32_t> m_bucketOf;
+    std::uint32_t m_bucketMask;
+
+    std::vector<std::uint8_t> m_removed;
+    VoxelCollider m_collider;
+    bool m_mergingEnabled;
+
+    void applyPhysics(float deltaTime, ChunkView& view);
+    void mergeStacks();
+    void buildSpatialHash();
+    void removeMarked();
+    std::uint32_t bucketFor(int cellX, int cellY, int cellZ) const;
+};
@@ -1,19 +1,18 @@
 #pragma once
-#include <memory>
 #include <glm/glm.hpp>
 
-class Shader;
+class UIBatch;
 
 /**
  * Simple crosshair UI element for the center of the screen
- * Renders a Minecraft-style crosshair using OpenGL
+ * Renders a Minecraft-style crosshair as two quads on the shared UIBatch
  */
 class Crosshair {
 public:
     Crosshair();
     ~Crosshair();
     
-    bool initialize();
+    bool initialize(UIBatch& batch);
     void render(int windowWidth, int windowHeight);
     void cleanup();
     
@@ -24,10 +23,7 @@ public:
     void setVisible(bool visible) { m_visible = visible; }
     
 private:
-    bool setupGeometry();
-    
-    unsigned int m_VAO, m_VBO, m_EBO;
-    std::unique_ptr<Shader> m_shader;
+    UIBatch* m_batch;
     
     // Crosshair properties
     glm::vec3 m_color;
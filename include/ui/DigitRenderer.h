@@ -42,6 +42,20 @@ namespace UI {
         0b1111110001100011111100001000011111
     }};
     
+    // Bolder digits with two-pixel strokes, same layout, for small text like item counts
+    constexpr std::array<uint64_t, 10> BOLD_DIGIT_PATTERNS = {{
+        0b11111110111101111011110111101111111,  // 0
+        0b01100111001110001100011000110011111,  // 1
+        0b11111110110001111111110001100011111,  // 2
+        0b11111000110001111111000110001111111,  // 3
+        0b11011110111101111111000110001100011,  // 4
+        0b11111110001100011111000110001111111,  // 5
+        0b11111110001100011111110111101111111,  // 6
+        0b11111000110011001100011000110001100,  // 7
+        0b11111110111101111111110111101111111,  // 8
+        0b11111110111101111111000110001111111   // 9
+    }};
+    
     // Extract pixel from compressed pattern
     constexpr bool getDigitPixel(int digit, int x, int y) {
         if (digit < 0 || digit > 9 || x < 0 || x >= DIGIT_WIDTH || y < 0 || y >= DIGIT_HEIGHT) {
@@ -50,4 +64,12 @@ namespace UI {
         int bitIndex = y * DIGIT_WIDTH + x;
         return (DIGIT_PATTERNS[digit] >> (DIGIT_PIXELS - 1 - bitIndex)) & 1;
     }
+    
+    constexpr bool getBoldDigitPixel(int digit, int x, int y) {
+        if (digit < 0 || digit > 9 || x < 0 || x >= DIGIT_WIDTH || y < 0 || y >= DIGIT_HEIGHT) {
+            return false;
+        }
+        int bitIndex = y * DIGIT_WIDTH + x;
+        return (BOLD_DIGIT_PATTERNS[digit] >> (DIGIT_PIXELS - 1 - bitIndex)) & 1;
+    }
 }
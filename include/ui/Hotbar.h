@@ -1,12 +1,11 @@
 #pragma once
 
-#include "engine/graphics/Shader.h"
-#include "engine/graphics/Texture.h"
 #include "world/Block.h"
 #include <glm/glm.hpp>
-#include <memory>
 #include <array>
 
+class UIBatch;
+
 // Structure to hold item data in a hotbar slot
 struct HotbarSlot {
     BlockType blockType = BlockType::AIR;
@@ -25,14 +24,17 @@ struct HotbarSlot {
 /**
  * Hotbar UI System
  * Renders a Minecraft-style hotbar with 10 inventory slots
+ * Slots, icons and item counts are queued on the shared UIBatch; whoever owns
+ * the batch flushes it once the rest of the UI is queued too
  */
 class Hotbar {
 public:
     Hotbar();
     ~Hotbar();
     
-    bool initialize();
-    void render(int screenWidth, int screenHeight);
+    // Adds the hotbar's images to the batch, which must not have baked its atlas yet
+    bool initialize(UIBatch& batch);
+    void render(int screenWidth);  // Bottom-left origin - only the width places it
     void cleanup();
     
     // Hotbar interaction
@@ -87,16 +89,12 @@ public:
     bool hasSpaceFor(BlockType blockType, int count = 1) const;
     
 private:
-    void setupGeometry();
     void renderSlot(int slot, float x, float y, float size);
     void renderSelection(float x, float y, float size);
     void renderItemCount(int count, float x, float y, float size);
-    void renderDigit(int digit, float x, float y, float scale);
-    std::shared_ptr<Texture> getTextureForBlockType(BlockType blockType);
+    static const char* getIconPath(BlockType blockType);
     
-    unsigned int m_VAO, m_VBO, m_EBO;
-    std::unique_ptr<Shader> m_shader;
-    std::shared_ptr<Texture> m_hotbarTexture, m_selectionTexture;
+    UIBatch* m_batch;
     
     // Hotbar state
     static constexpr int HOTBAR_SLOTS = 10;
@@ -2,17 +2,20 @@
 #include <memory>
 #include <string>
 #include <glm/glm.hpp>
-#include "ui/DigitRenderer.h"
-#include "engine/graphics/OpenGLResource.h"
 
-class Shader;
+class UIBatch;
 
+/**
+ * LoadingScreen - Full-screen progress overlay while the first chunks load
+ * Queued on the shared UIBatch with a top-left origin, like a page of text;
+ * the batch is flushed by its owner
+ */
 class LoadingScreen {
 public:
     LoadingScreen();
     ~LoadingScreen();
     
-    bool initialize();
+    bool initialize(UIBatch& batch);
     void render(int windowWidth, int windowHeight, int chunksLoaded, int totalChunks, const std::string& status = "Loading...");
     void cleanup();
     
@@ -23,7 +26,8 @@ private:
     void renderNumber(int number, float x, float y, float scale, const glm::vec3& color, int windowWidth, int windowHeight);
     void renderDigit(int digit, float x, float y, float scale, const glm::vec3& color, int windowWidth, int windowHeight);
     
-    OpenGL::VertexArray m_vao;
-    OpenGL::Buffer m_vbo;
-    std::unique_ptr<Shader> m_shader;
+    // A rectangle given from its top-left corner, in the batch's bottom-left coordinates
+    void renderRect(float x, float y, float width, float height, const glm::vec3& color, int windowHeight);
+    
+    UIBatch* m_batch;
 };
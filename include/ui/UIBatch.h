@@ -0,0 +1,81 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Shader;
+
+/**
+ * UIBatch - Draws every 2D UI quad of a frame in one go
+ *
+ * ⚡ UI elements append quads - screen rectangle, atlas UVs, colour - to a CPU
+ * array, and flush() streams the lot into one vertex buffer and draws it with
+ * a single glDrawElements. Everything shares one atlas texture: the images
+ * registered with addImage(), a white texel for flat-colour quads and the
+ * digit glyphs, baked from the DigitRenderer patterns. Quads draw in the
+ * order they were added, so later ones cover earlier ones.
+ *
+ * Positions are pixels with the origin at the bottom-left of the screen.
+ */
+class UIBatch {
+public:
+    // Where an image sits in the atlas. uvMin is its top-left corner
+    struct Sprite {
+        glm::vec2 uvMin = glm::vec2(0.0f);
+        glm::vec2 uvMax = glm::vec2(0.0f);
+    };
+
+    // Digit glyph styles: the loading screen's dotted digits, and the hotbar's solid ones
+    enum class Font { DOTTED, BOLD };
+
+    UIBatch();
+    ~UIBatch();
+
+    // Images must be added before initialize() bakes the atlas
+    void addImage(const std::string& path);
+    bool initialize();
+    void cleanup();
+
+    // nullptr for an image that wasn't added or failed to load
+    const Sprite* findSprite(const std::string& path) const;
+
+    void quad(const glm::vec2& position, const glm::vec2& size, const Sprite& sprite,
+              const glm::vec4& color = glm::vec4(1.0f));
+    void rect(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+
+    // A glyph with its bottom-left corner at position, each glyph texel texelSize pixels wide
+    void digit(Font font, int digit, const glm::vec2& position, float texelSize, const glm::vec4& color);
+    static glm::vec2 glyphSize(Font font);  // In texels
+
+    // Draws and empties the batch
+    void flush(int screenWidth, int screenHeight);
+
+    int getQuadCount() const { return m_lastQuads; }   // Quads drawn by the last flush
+    int getDrawCalls() const { return m_lastDraws; }   // Draws issued by the last flush
+
+private:
+    struct Vertex {
+        glm::vec2 position;
+        glm::vec2 texCoord;
+        glm::vec4 color;
+    };
+
+    std::shared_ptr<Shader> m_shader;
+    unsigned int m_VAO, m_VBO, m_EBO;
+    unsigned int m_atlas;
+    bool m_initialized;
+
+    std::vector<std::string> m_imagePaths;
+    std::unordered_map<std::string, Sprite> m_sprites;
+    Sprite m_white;
+    Sprite m_glyphs[2][10];
+
+    std::vector<Vertex> m_vertices;  // Four per quad, waiting for flush()
+    int m_lastQuads;
+    int m_lastDraws;
+
+    static constexpr int MAX_QUADS = 4096;  // Quads per draw - a fuller batch is drawn in parts
+};
@@ -5,6 +5,10 @@
 #include <type_traits>
 #include <chrono>
 #include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
 
 namespace Utils {
 
@@ -51,6 +55,26 @@ namespace Utils {
         seed ^= hasher(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
     
+    // Stable FNV-1a hash - identical on every platform and run (unlike std::hash)
+    inline std::uint64_t fnv1a64(const void* data, std::size_t size,
+                                 std::uint64_t hash = 14695981039346656037ull) noexcept {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+    
+    // Portable deterministic PRNG step (SplitMix64) - unlike <random> distributions,
+    // the sequence is the same with every standard library
+    inline std::uint64_t splitMix64(std::uint64_t& state) noexcept {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+    
     // High-resolution timer for performance measurements
     class Timer {
     public:
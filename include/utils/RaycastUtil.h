@@ -2,21 +2,17 @@
 
 #include <glm/glm.hpp>
 #include "world/Block.h"
+#include "world/VoxelRaycaster.h"
 
 class World;
 
 class RaycastUtil {
 public:
-    struct RaycastResult {
-        bool hit = false;
-        glm::ivec3 blockPos;
-        glm::vec3 hitPoint;
-        glm::ivec3 normal;
-        BlockType blockType;
-    };
+    using RaycastResult = RaycastHit;
 
+    // Traces through a ChunkView of the world - see VoxelRaycaster
     static RaycastResult raycast(const glm::vec3& rayStart,
                                  const glm::vec3& rayDirection,
                                  const World& world,
                                  float maxDistance);
-};
\ No newline at end of file
+};
@@ -1,15 +1,155 @@
 #pragma once
 
 #include "world/Block.h"
+#include "world/SectionVisibility.h"
 #include "engine/graphics/Mesh.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
 #include <iostream>
 #include <atomic>
+#include <functional>
 
 constexpr int CHUNK_SIZE = 16;
 constexpr int CHUNK_HEIGHT = 64;  // Increased height for terrain generation
+constexpr int SECTION_COUNT = CHUNK_HEIGHT / SectionVisibility::SIZE;  // 16-block-high slices for culling
+
+// Hash function for glm::ivec2 to use as key in unordered_map
+struct ChunkPositionHash {
+    std::size_t operator()(const glm::ivec2& pos) const {
+        return std::hash<int>()(pos.x) ^ (std::hash<int>()(pos.y) << 1);
+    }
+};
+
+// 🧱 Conservative shape of a chunk for software occlusion culling. Each 4x4-column
+// tile is solid from y = 0 up to its height, so boxes built from it never cover air
+struct ChunkOccluder {
+    static constexpr int TILE = 4;
+    static constexpr int TILES = CHUNK_SIZE / TILE;
+    uint8_t tileHeight[TILES][TILES] = {};  // [x][z] - 0 where a column is open at the bottom
+};
+
+// ⚡ Where a mesh's faces of each direction lie, in addFaceToMesh order (+Z, -Z, -X, +X,
+// +Y, -Y). A face is only ever seen from in front of its plane, so a direction the camera
+// is behind every face of is skipped whole instead of being culled vertex by vertex
+struct ChunkFacePlanes {
+    static constexpr int FACE_COUNT = 6;
+    static constexpr unsigned int ALL_FACES = (1u << FACE_COUNT) - 1;
+    
+    // Along each direction's axis: the lowest plane of a + direction, the highest of a
+    // - direction. Open until set, so every direction shows
+    float limit[FACE_COUNT] = {-1e30f, 1e30f, 1e30f, -1e30f, -1e30f, 1e30f};
+    
+    // Bit per direction with a face turned towards the camera
+    unsigned int getVisibleFaces(const glm::vec3& cameraPos) const;
+};
+
+// CPU-side chunk geometry - one vertex/index list per material mesh
+struct ChunkMeshData {
+    enum Layer { SOLID, WATER, OAK, LEAVES, STONE, GRAVEL, SAND, LAYER_COUNT };
+    std::vector<Vertex> vertices[LAYER_COUNT];
+    std::vector<unsigned int> indices[LAYER_COUNT];
+    SectionVisibility visibility[SECTION_COUNT];  // Face connectivity of each section, bottom first
+    ChunkOccluder occluder;                       // Solid core, for occlusion culling
+    float minY = 0.0f, maxY = 0.0f;               // Vertical extent of the vertices, in whole LOD cells
+    
+    // Indices grouped by face direction - faceStart[layer][d] to [d + 1] are direction d
+    unsigned int faceStart[LAYER_COUNT][ChunkFacePlanes::FACE_COUNT + 1] = {};
+    ChunkFacePlanes facePlanes;
+    
+    // Which material mesh a block's faces go into
+    static int getLayer(BlockType blockType);
+    
+    // Set minY/maxY from the vertices of every layer, widened to the coarsest LOD cell
+    void computeBounds();
+    
+    // Sort each layer's faces by direction and fill faceStart and facePlanes
+    void groupByFace();
+};
+
+// How much of a chunk is generated - far chunks only need their silhouette
+enum class ChunkDetail : uint8_t {
+    FULL,        // Every voxel, caves and features
+    HEIGHTFIELD  // Height and surface block per column, no voxel data
+};
+
+// ⚡ Which blocks of a chunk are filled, as bits. A column is CHUNK_HEIGHT = 64 blocks,
+// so each kind of "filled" is one 64-bit word per column with bit y for block y, and
+// 64 blocks are tested with one AND. Over it sits a min-max mip of the FILLED bits:
+// per 16x16x16 section, whether any block is filled (max) and whether every one is
+// (min), so walks can skip an empty section in one go.
+class ChunkOccupancy {
+public:
+    enum Kind {
+        FILLED,  // Not air
+        SOLID,   // Not air or water - what bodies collide with
+        OPAQUE,  // Not air, water or leaves - what hides faces (SectionVisibility::isSeeThrough)
+        KIND_COUNT
+    };
+    static_assert(CHUNK_HEIGHT == 64, "one 64-bit word per column");
+
+    // Exact bits and mips from a chunk's blocks, in getBlockData() order
+    void rebuild(const std::vector<BlockType>& blocks);
+
+    // O(1) for generation: column bits stay exact, the mips only conservative - a
+    // section may claim blocks it no longer has and miss being full, never the reverse
+    inline void set(int x, int y, int z, BlockType type) {
+        const std::uint64_t bit = 1ull << y;
+        const int column = x + z * CHUNK_SIZE;
+        const bool kinds[KIND_COUNT] = {
+            type != BlockType::AIR,
+            type != BlockType::AIR && type != BlockType::WATER,
+            !SectionVisibility::isSeeThrough(type)
+        };
+        for (int kind = 0; kind < KIND_COUNT; ++kind) {
+            m_columns[kind][column] = kinds[kind] ? m_columns[kind][column] | bit : m_columns[kind][column] & ~bit;
+        }
+        const std::uint8_t section = static_cast<std::uint8_t>(1u << (y / SectionVisibility::SIZE));
+        if (kinds[FILLED]) {
+            m_sectionAny |= section;
+        } else {
+            m_sectionAll &= static_cast<std::uint8_t>(~section);
+        }
+    }
+
+    // For edits: set, then recompute the mips of the block's section
+    void update(int x, int y, int z, BlockType type);
+
+    // Bit y of a column, local coordinates
+    std::uint64_t getColumn(Kind kind, int x, int z) const { return m_columns[kind][x + z * CHUNK_SIZE]; }
+
+    // Index of the lowest set bit of a non-zero word
+    static int lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(bits);
+#else
+        int index = 0;
+        while (!(bits & 1)) {
+            bits >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    // Min-max mips by section index, y / SectionVisibility::SIZE
+    bool isSectionEmpty(int section) const { return !(m_sectionAny & (1u << section)); }
+    bool isSectionFull(int section) const { return (m_sectionAll & (1u << section)) != 0; }
+
+private:
+    std::uint64_t m_columns[KIND_COUNT][CHUNK_SIZE * CHUNK_SIZE] = {};  // [kind][x + z * CHUNK_SIZE]
+    std::uint8_t m_sectionAny = 0;  // Bit per section
+    std::uint8_t m_sectionAll = 0;
+
+    void refreshSection(int section);
+};
+
+// Per-column terrain summary of a far chunk
+struct ChunkHeightfield {
+    int height[CHUNK_SIZE][CHUNK_SIZE];          // Top terrain block of each column
+    BlockType surface[CHUNK_SIZE][CHUNK_SIZE];   // Block type at that height
+    int waterLevel = 0;                          // Columns below it are drawn under water
+};
 
 // Forward declarations
 class ModularWorldGenerator;
@@ -20,7 +160,8 @@ class TerrainGenerator;
 
 class Chunk {
 public:
-    Chunk(const glm::ivec2& position, ModularWorldGenerator* terrainGen = nullptr, bool autoGenerate = true);
+    Chunk(const glm::ivec2& position, ModularWorldGenerator* terrainGen = nullptr, bool autoGenerate = true,
+          ChunkDetail detail = ChunkDetail::FULL);
     ~Chunk();
     
     // Block management (optimized with inline functions)
@@ -48,6 +189,7 @@ public:
             // Safety check for vector bounds with debug info
             if (index >= 0 && index < static_cast<int>(m_blockTypes.size())) {
                 m_blockTypes[index] = type;
+                m_occupancy->set(x, y, z, type);
             } else {
                 // Should never happen if bounds checking is correct
                 std::cerr << "ERROR: setBlockFast index out of bounds! x=" << x << " y=" << y << " z=" << z 
@@ -58,20 +200,29 @@ public:
     
     // Chunk operations
     // Methods to generate and render this chunk
-    void generate();            // Generate terrain and mesh (main thread)
+    void generate();            // Generate terrain (mesh is built on the next buildMesh)
     void buildMesh();           // Create mesh for rendering (must run on render thread)
     void buildMeshWithCulling(const glm::vec3& cameraPos, const glm::vec3& cameraDir); // Build mesh with view culling
     // Generate terrain data only (mesh will be built separately)
     void generateTerrainOnly(); // Prepare terrain layout without building mesh
-    void buildMeshData();      // Build vertex and index data on the CPU
+    void buildMeshData(ChunkMeshData& meshData) const; // Build vertex and index data on the CPU (any thread, no GL)
     void uploadMesh();         // Send mesh data to the GPU
-    void render(const glm::mat4& view, const glm::mat4& projection);
-    void drawWaterMesh() const;  // Draw mesh for water blocks only
-    void drawOakMesh() const;    // Draw mesh for oak log blocks only
-    void drawLeavesMesh() const; // Draw mesh for leaves blocks only
-    void drawStoneMesh() const;  // Draw mesh for stone blocks only
-    void drawGravelMesh() const; // Draw mesh for gravel blocks only
-    void drawSandMesh() const;   // Draw mesh for sand blocks only
+    // faceMask: ChunkFacePlanes bits of the face directions to draw
+    void render(const glm::mat4& view, const glm::mat4& projection,
+                unsigned int faceMask = ChunkFacePlanes::ALL_FACES);
+    void drawWaterMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const;  // Draw mesh for water blocks only
+    void drawOakMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const;    // Draw mesh for oak log blocks only
+    void drawLeavesMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const; // Draw mesh for leaves blocks only
+    void drawStoneMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const;  // Draw mesh for stone blocks only
+    void drawGravelMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const; // Draw mesh for gravel blocks only
+    void drawSandMesh(unsigned int faceMask = ChunkFacePlanes::ALL_FACES) const;   // Draw mesh for sand blocks only
+    
+    // 💾 Persistence support - raw block data in index order (x + z*16 + y*256)
+    const std::vector<BlockType>& getBlockData() const { return m_blockTypes; }
+    bool loadBlockData(std::vector<BlockType>&& blocks); // Use saved data instead of generating
+    
+    // ⚡ Filled-block bits and their min-max mips, kept in step with every write - nullptr for heightfields
+    const ChunkOccupancy* getOccupancy() const { return m_occupancy.get(); }
     
     // Async mesh building support
     void markReadyForUpload();   // Flag chunk as having mesh data ready for GPU
@@ -82,6 +233,23 @@ public:
     bool needsMeshRebuild() const { return m_needsRebuild; }
     bool isGenerated() const { return m_generated; }
     
+    // Heightfield chunks hold no blocks - reads return AIR and writes are ignored
+    ChunkDetail getDetail() const { return m_detail; }
+    bool isHeightfield() const { return m_detail == ChunkDetail::HEIGHTFIELD; }
+    
+    // 👁️ Face connectivity of each section as of the last mesh build, bottom first
+    const SectionVisibility* getSectionVisibility() const { return m_sectionVisibility; }
+    
+    // 🧱 Solid core as of the last mesh build
+    const ChunkOccluder& getOccluder() const { return m_occluder; }
+    
+    // ⚡ World-space box around everything the chunk draws at any LOD, as of the
+    // last mesh build - the whole column until then
+    void getBounds(glm::vec3& min, glm::vec3& max) const;
+    
+    // ⚡ Face directions of the last mesh built, every one until then
+    const ChunkFacePlanes& getFacePlanes() const { return m_facePlanes; }
+    
     // Helpers to get chunk coordinates and world position
     glm::ivec2 getPosition() const { return m_position; }
     glm::vec3 getWorldPosition() const { 
@@ -97,22 +265,34 @@ private:
     // ⚡ ULTRA-FAST block storage - just store block types, not full objects
     std::vector<BlockType> m_blockTypes;
     std::vector<std::unique_ptr<Block>> m_blocks;
-    std::unique_ptr<Mesh> m_mesh;           // Mesh containing solid block geometry
-    std::unique_ptr<Mesh> m_waterMesh;      // Mesh containing water block geometry
-    std::unique_ptr<Mesh> m_oakMesh;        // Mesh containing oak log block geometry
-    std::unique_ptr<Mesh> m_leavesMesh;     // Mesh containing leaves block geometry
-    std::unique_ptr<Mesh> m_stoneMesh;      // Mesh containing stone block geometry
-    std::unique_ptr<Mesh> m_gravelMesh;     // Mesh containing gravel block geometry
-    std::unique_ptr<Mesh> m_sandMesh;       // Mesh containing sand block geometry
-    bool m_needsRebuild;
-    std::atomic<bool> m_generated{false};  // Atomic for thread safety
+    std::unique_ptr<ChunkOccupancy> m_occupancy;  // With the block arrays, not for heightfields
+    // GPU meshes are created by buildMesh() on the render thread. shared_ptr keeps
+    // Mesh (and GL) out of the destructor, so headless tools link without GL.
+    std::shared_ptr<Mesh> m_mesh;           // Mesh containing solid block geometry
+    std::shared_ptr<Mesh> m_waterMesh;      // Mesh containing water block geometry
+    std::shared_ptr<Mesh> m_oakMesh;        // Mesh containing oak log block geometry
+    std::shared_ptr<Mesh> m_leavesMesh;     // Mesh containing leaves block geometry
+    std::shared_ptr<Mesh> m_stoneMesh;      // Mesh containing stone block geometry
+    std::shared_ptr<Mesh> m_gravelMesh;     // Mesh containing gravel block geometry
+    std::shared_ptr<Mesh> m_sandMesh;       // Mesh containing sand block geometry
+    std::atomic<bool> m_needsRebuild;      // Set by any thread that changes blocks, cleared as a rebuild starts
+    std::atomic<bool> m_generationClaimed{false}; // One worker fills the blocks...
+    std::atomic<bool> m_generated{false};  // ...and publishes them here once they are final
     bool m_readyForUpload = false;  // True if mesh data is built and ready for GPU upload
     ModularWorldGenerator* m_terrainGenerator; // Shared modular terrain generator instance
+    ChunkDetail m_detail;
+    std::unique_ptr<ChunkHeightfield> m_heightfield; // Only for HEIGHTFIELD chunks
+    SectionVisibility m_sectionVisibility[SECTION_COUNT]; // Open until the first mesh build
+    ChunkOccluder m_occluder;                  // Occludes nothing until the first mesh build
+    float m_minY = -0.5f;                      // Vertical extent of the last mesh built
+    float m_maxY = CHUNK_HEIGHT - 0.5f;
+    ChunkFacePlanes m_facePlanes;
     
     void generateTerrain();
     void generateFlatTerrain(); // Use a simple flat terrain as fallback
     void addTerrainVariation(int x, int z, int surfaceHeight);
     void addFaceToMesh(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, 
                        const glm::vec3& blockPos, int faceIndex, const glm::vec3& normal, 
-                       unsigned int& vertexIndex);
+                       unsigned int& vertexIndex) const;
+    void buildHeightfieldMeshData(ChunkMeshData& meshData) const;
 };
@@ -4,81 +4,130 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class Mesh;
 
 /**
  * Level of Detail (LOD) System for Chunks
- * Automatically reduces geometry complexity based on distance from camera
- * Maintains visual quality while dramatically improving performance
+ * Distant chunks are drawn from voxel-downsampled meshes: every 2x2x2 (MEDIUM)
+ * or 4x4x4 (LOW) cell of blocks becomes one coarse voxel, cutting triangles
+ * roughly 4x and 16x while keeping the silhouette.
+ *
+ * - Coarse meshes are built on the manager's own worker threads from a copy
+ *   of the chunk's blocks, and uploaded on the main thread
+ * - Levels switch with hysteresis, so a chunk sitting on a threshold doesn't
+ *   flip back and forth every frame
+ * - Seams: like the full mesher, coarse meshes always close their chunk-edge
+ *   walls, so neighbours at different levels never leave a gap. A chunk keeps
+ *   drawing its current level until the new one is uploaded, so switching
+ *   never leaves a hole either
+ *
+ * Heightfield chunks beyond the render distance are not managed here - they
+ * are already coarser than LOW.
  */
 class ChunkLODManager {
 public:
     enum class LODLevel {
-        FULL_DETAIL = 0,     // All blocks rendered normally
-        MEDIUM_DETAIL = 1,   // Skip some interior faces, reduce water detail
-        LOW_DETAIL = 2,      // Only render surface blocks
-        BILLBOARD = 3        // Single textured quad representing entire chunk
+        FULL_DETAIL = 0,     // The chunk's own mesh
+        MEDIUM_DETAIL = 1,   // 2x2x2 blocks per voxel
+        LOW_DETAIL = 2,      // 4x4x4 blocks per voxel
+        COUNT
     };
-    
-    struct LODChunk {
-        std::unique_ptr<Chunk> fullChunk;
-        std::unique_ptr<Mesh> lodMeshes[4];  // One mesh per LOD level
-        LODLevel currentLOD;
-        float distanceFromCamera;
-        bool lodMeshesBuilt[4];
-        
-        LODChunk() : currentLOD(LODLevel::FULL_DETAIL), distanceFromCamera(0.0f) {
-            for (int i = 0; i < 4; ++i) lodMeshesBuilt[i] = false;
-        }
+    static constexpr int LEVEL_COUNT = static_cast<int>(LODLevel::COUNT);
+    static int getScale(LODLevel level) { return 1 << static_cast<int>(level); }
+
+    // GPU meshes of one coarse level, one per material layer like the chunk's own
+    struct LODMeshes {
+        std::shared_ptr<Mesh> layers[ChunkMeshData::LAYER_COUNT];
+        ChunkFacePlanes facePlanes;  // Coarse faces sit on their own planes
     };
-    
-    ChunkLODManager();
+
+    explicit ChunkLODManager(int workerCount = 2);
     ~ChunkLODManager();
-    
-    // Configure LOD distance thresholds
-    void setLODDistances(float medium, float low, float billboard);
-    
-    // Update LOD levels based on camera position
-    void updateLOD(const glm::vec3& cameraPosition);
-    
-    // Add a chunk to LOD management
-    void addChunk(std::unique_ptr<Chunk> chunk);
-    
+
+    ChunkLODManager(const ChunkLODManager&) = delete;
+    ChunkLODManager& operator=(const ChunkLODManager&) = delete;
+
+    // Configure LOD distance thresholds (in chunks) and the hysteresis band around them
+    void setLODDistances(float medium, float low);
+    void setHysteresis(float chunks) { m_hysteresis = chunks; }
+
+    // Pick the level for a full chunk at this distance from the camera (main thread,
+    // once per frame). Queues a coarse mesh build when the level has none yet.
+    // Returns the level to draw - the previous one until the new mesh is uploaded.
+    LODLevel updateLOD(const Chunk& chunk, float distanceInChunks);
+
+    // Blocks changed (generated, edited) - coarse meshes are rebuilt when next needed
+    void invalidateChunk(const glm::ivec2& chunkPos);
+
     // Remove a chunk from LOD management
     void removeChunk(const glm::ivec2& chunkPos);
-    
-    // Get the appropriate mesh for rendering a chunk
-    Mesh* getChunkMesh(const glm::ivec2& chunkPos);
-    
-    // Build LOD meshes for a chunk in background thread
-    void buildLODMeshes(const glm::ivec2& chunkPos);
-    
+
+    // Upload finished coarse meshes - main thread, needs GL (ChunkLODUpload.cpp)
+    int uploadReadyMeshes(int maxUploads);
+
+    // Get the coarse meshes to draw for a chunk (null at FULL_DETAIL or if not uploaded)
+    const LODMeshes* getChunkMeshes(const glm::ivec2& chunkPos) const;
+
+    // Downsampled mesh of a chunk's blocks (any thread, no GL). scale is 2 or 4
+    static void buildLODMeshData(const std::vector<BlockType>& blocks, const glm::ivec2& chunkPos,
+                                 int scale, ChunkMeshData& meshData);
+
+    // Calculate appropriate LOD level for distance, staying at current inside the hysteresis band
+    LODLevel calculateLODLevel(float distance, LODLevel current) const;
+
     // Performance statistics
-    int getChunksAtLOD(LODLevel level) const;
-    float getAverageTriangleReduction() const;
+    int getChunksAtLOD(LODLevel level) const;       // By level being drawn
+    size_t getLODTriangles() const;                 // Triangles in the coarse meshes being drawn
+    int getPendingBuilds() const;
+    bool hasPendingLevels() const;                  // A level was requested and is not on the GPU yet
 
 private:
-    std::unordered_map<glm::ivec2, std::unique_ptr<LODChunk>, ChunkPositionHash> m_lodChunks;
-    
+    struct LODChunk {
+        LODLevel targetLevel = LODLevel::FULL_DETAIL;  // Chosen with hysteresis
+        LODLevel drawLevel = LODLevel::FULL_DETAIL;    // Finest uploaded level at or near the target
+        LODMeshes meshes[LEVEL_COUNT];                 // [0] unused - the chunk draws itself
+        bool ready[LEVEL_COUNT] = {};
+        bool pending[LEVEL_COUNT] = {};
+        size_t triangles[LEVEL_COUNT] = {};
+        unsigned int version = 0;                      // Bumped on invalidate, stale builds are dropped
+    };
+
+    struct BuildJob {
+        glm::ivec2 chunkPos;
+        LODLevel level;
+        unsigned int version;
+        std::shared_ptr<const std::vector<BlockType>> blocks;
+    };
+
+    struct BuildResult {
+        glm::ivec2 chunkPos;
+        LODLevel level;
+        unsigned int version;
+        ChunkMeshData meshData;
+    };
+
+    std::unordered_map<glm::ivec2, LODChunk, ChunkPositionHash> m_lodChunks;  // Main thread only
+
     // LOD distance thresholds
     float m_mediumDetailDistance;
     float m_lowDetailDistance;
-    float m_billboardDistance;
-    
-    // Calculate appropriate LOD level for distance
-    LODLevel calculateLODLevel(float distance) const;
-    
-    // Build a specific LOD mesh for a chunk
-    void buildLODMesh(LODChunk& lodChunk, LODLevel level);
-    
-    // Generate medium detail mesh (skip some interior faces)
-    void generateMediumDetailMesh(const Chunk& chunk, Mesh& mesh);
-    
-    // Generate low detail mesh (surface only)
-    void generateLowDetailMesh(const Chunk& chunk, Mesh& mesh);
-    
-    // Generate billboard mesh (single quad)
-    void generateBillboardMesh(const Chunk& chunk, Mesh& mesh);
-    
-    // Sample chunk color for billboard
-    glm::vec3 sampleChunkColor(const Chunk& chunk);
+    float m_hysteresis;
+
+    // ⚡ Worker threads
+    std::deque<BuildJob> m_jobs;
+    std::deque<BuildResult> m_results;
+    mutable std::mutex m_jobMutex;
+    std::mutex m_resultMutex;
+    std::condition_variable m_jobCondition;
+    std::vector<std::thread> m_workers;
+    bool m_stopWorkers;
+
+    void requestBuild(const Chunk& chunk, LODChunk& lodChunk, LODLevel level);
+    void buildWorker();
 };
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "world/Chunk.h"
+#include "world/RegionFile.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * Chunk Storage - persists visited chunks in region files
+ *
+ * Saves are queued and compressed/written by a background I/O thread, so
+ * unloading a chunk never blocks the main thread on disk.
+ * Loads are safe from any thread and check the pending write queue first,
+ * so a chunk that is unloaded and reloaded quickly never reads stale data.
+ */
+class ChunkStorage {
+public:
+    // signature: ModularWorldGenerator::getSignature() - stale regions are discarded
+    ChunkStorage(const std::string& directory, uint32_t signature, int compressionLevel = 1);
+    ~ChunkStorage();  // Flushes all pending saves before returning
+
+    ChunkStorage(const ChunkStorage&) = delete;
+    ChunkStorage& operator=(const ChunkStorage&) = delete;
+
+    // Load a chunk's block data - returns false if the chunk was never saved
+    bool loadChunk(const glm::ivec2& chunkPos, std::vector<BlockType>& blocks);
+
+    // Check whether a chunk has been saved (or is queued), without reading it
+    bool hasChunk(const glm::ivec2& chunkPos);
+
+    // Queue a chunk for saving (takes a copy, returns immediately)
+    void saveChunkAsync(const glm::ivec2& chunkPos, std::vector<BlockType> blocks);
+
+    // Block until every queued save has reached the region files
+    void flush();
+
+    // Statistics
+    int getChunksLoaded() const { return m_chunksLoaded.load(); }
+    int getChunksSaved() const { return m_chunksSaved.load(); }
+    const std::string& getDirectory() const { return m_directory; }
+
+private:
+    using BlockData = std::vector<BlockType>;
+
+    std::string m_directory;
+    uint32_t m_signature;
+    int m_compressionLevel;
+
+    // Open region files, created on first access
+    std::unordered_map<glm::ivec2, std::unique_ptr<RegionFile>, ChunkPositionHash> m_regions;
+    std::mutex m_regionsMutex;
+
+    // 💾 Background I/O thread
+    std::unordered_map<glm::ivec2, BlockData, ChunkPositionHash> m_pendingWrites;  // Queued saves
+    std::unordered_map<glm::ivec2, BlockData, ChunkPositionHash> m_activeWrites;   // Batch being written
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::condition_variable m_flushCondition;
+    std::thread m_ioThread;
+    bool m_stopIO;
+
+    std::atomic<int> m_chunksLoaded{0};
+    std::atomic<int> m_chunksSaved{0};
+
+    RegionFile* getRegion(const glm::ivec2& chunkPos, bool create);
+    bool writeChunk(const glm::ivec2& chunkPos, const BlockData& blocks);
+    void ioWorker();
+};
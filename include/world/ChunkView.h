@@ -0,0 +1,51 @@
+#pragma once
+
+#include "world/Chunk.h"
+#include <glm/glm.hpp>
+#include <functional>
+
+/**
+ * ChunkView - block reads across chunks without a lock per block
+ *
+ * World::getBlock takes the chunk map's mutex and hashes the chunk position
+ * on every call. A view resolves each chunk once through a lookup function
+ * and remembers it in a small direct-mapped table, so a batch of reads that
+ * stays within a few chunks costs one lookup per chunk, not per block.
+ *
+ * Chunks the lookup does not return - missing, still generating, or only a
+ * heightfield - read as unavailable, so callers can wait instead of treating
+ * them as air. The chunks must outlive the view: World only adds and removes
+ * chunks in update(), so a view made after it is good until the next one.
+ */
+class ChunkView {
+public:
+    using Lookup = std::function<const Chunk*(const glm::ivec2&)>;
+
+    explicit ChunkView(Lookup lookup);
+
+    // Chunk holding a block column, or nullptr if it is unavailable
+    const Chunk* getChunkAt(int worldX, int worldZ);
+
+    // False if the block's chunk is unavailable; above and below the world is air
+    bool getBlock(int worldX, int worldY, int worldZ, BlockType& type) {
+        const Chunk* chunk = getChunkAt(worldX, worldZ);
+        if (!chunk) return false;
+        type = chunk->getBlockFast(worldX & (CHUNK_SIZE - 1), worldY, worldZ & (CHUNK_SIZE - 1));
+        return true;
+    }
+
+    int getLookups() const { return m_lookups; }
+
+private:
+    static constexpr int TABLE_SIDE = 8;  // Entries per axis, a power of two
+
+    struct Entry {
+        glm::ivec2 chunkPos;
+        const Chunk* chunk;
+        bool valid;
+    };
+
+    Lookup m_lookup;
+    Entry m_table[TABLE_SIDE * TABLE_SIDE];
+    int m_lookups;
+};
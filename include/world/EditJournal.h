@@ -0,0 +1,71 @@
+#pragma once
+
+#include "world/Chunk.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Edit Journal - persists player edits as deltas against generated terrain
+ *
+ * Terrain is fully reproducible from the seed, so only the blocks a player
+ * changed are saved: every edit is appended to a write-ahead journal as a
+ * (chunk, index, blockType) record. Untouched chunks cost zero bytes on disk.
+ * When most records have been superseded by later edits of the same block,
+ * the journal is compacted down to one record per edited block.
+ */
+class EditJournal {
+public:
+    // Edits only make sense on top of the terrain of the seed they were made in
+    EditJournal(const std::string& directory, unsigned int seed);
+    ~EditJournal();  // Flushes and compacts if worthwhile
+
+    EditJournal(const EditJournal&) = delete;
+    EditJournal& operator=(const EditJournal&) = delete;
+
+    // Record a player edit (main thread) - index is the chunk-local block index
+    void recordEdit(const glm::ivec2& chunkPos, int index, BlockType type);
+
+    // Apply all saved edits for a freshly generated/loaded chunk (any thread)
+    int applyEdits(const glm::ivec2& chunkPos, Chunk& chunk) const;
+
+    // Write buffered records to disk, compacting when the journal is mostly stale
+    void flush();
+
+    // Rewrite the journal with exactly one record per edited block
+    bool compact();
+
+    // Statistics
+    size_t getEditCount() const;      // Live edited blocks
+    size_t getRecordCount() const;    // Records in the journal file
+
+private:
+    #pragma pack(push, 1)
+    struct Record {
+        int32_t chunkX;
+        int32_t chunkZ;
+        uint16_t index;
+        uint16_t blockType;
+    };
+    #pragma pack(pop)
+
+    using ChunkEdits = std::unordered_map<uint16_t, BlockType>;
+
+    static constexpr uint32_t MAGIC = 0x4C4A4445;      // "EDJL"
+    static constexpr size_t COMPACT_MIN_RECORDS = 4096; // Don't bother compacting tiny journals
+
+    std::string m_path;
+    uint32_t m_seed;
+    std::FILE* m_file;
+    std::unordered_map<glm::ivec2, ChunkEdits, ChunkPositionHash> m_edits;  // Live deltas per chunk
+    std::vector<Record> m_pendingRecords;  // Appended but not yet written
+    size_t m_recordCount;                  // Records on disk + pending
+    mutable std::mutex m_mutex;
+
+    bool replay();
+    bool openForAppend();
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "world/ModularWorldGenerator.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+// One vertex of the far-field terrain - colour instead of a texture, it's only ever seen from afar
+struct HorizonVertex {
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec3 color;
+};
+
+struct HorizonMeshData {
+    std::vector<HorizonVertex> vertices;
+    std::vector<unsigned int> indices;
+};
+
+/**
+ * HorizonField - terrain heights and colours far beyond the loaded chunks
+ *
+ * A clipmap: a pyramid of square grids centred on the camera, each with twice
+ * the sample spacing of the one inside it, so every level costs the same while
+ * the covered area quadruples. Samples come straight from getTerrainHeight on
+ * the coarse grid - no chunk is ever generated for the horizon.
+ *
+ * ⚡ PERFORMANCE:
+ * - Levels are stored toroidally: when the camera moves, only the rows and
+ *   columns that scrolled into a level are sampled, the rest stay put
+ * - A level's origin snaps to every second sample, so its mesh only changes
+ *   when the camera crosses two of its cells - the coarse levels almost never
+ * - Coarse levels leave a hole where the finer one sits; the finer level's
+ *   outer edge is bent onto the coarse one so no cracks show between them
+ *
+ * GL-free - HorizonRenderer uploads and draws the level meshes.
+ */
+class HorizonField {
+public:
+    static constexpr int GRID_SIZE = 64;             // Cells per level side (even)
+    static constexpr int BASE_SPACING = CHUNK_SIZE;  // Blocks between level-0 samples
+
+    // radius: blocks from the camera the outermost level must reach
+    HorizonField(const ModularWorldGenerator* generator, float radius);
+
+    // Reach a new radius - adds or drops coarse levels, all levels resample
+    void setRadius(float radius);
+
+    // Recentre every level on the camera, sampling what scrolled in.
+    // Returns the number of levels whose mesh changed
+    int update(const glm::vec3& cameraPos);
+
+    int getLevelCount() const { return static_cast<int>(m_levels.size()); }
+    int getSpacing(int level) const { return m_levels[level].spacing; }
+    bool isLevelDirty(int level) const { return m_levels[level].dirty; }
+
+    // Mesh of one level in world space, minus the hole under the next finer level.
+    // Clears the level's dirty flag
+    void buildLevelMesh(int level, HorizonMeshData& meshData);
+
+    // Statistics
+    size_t getSamplesTaken() const { return m_samplesTaken; }
+
+private:
+    static constexpr int SAMPLES = GRID_SIZE + 1;    // Samples per level side
+
+    struct Sample {
+        float height;       // Top of the surface, water included
+        glm::vec3 color;
+    };
+
+    struct Level {
+        int spacing;                    // Blocks between samples
+        glm::ivec2 origin;              // Grid index of the first sample (even)
+        bool valid = false;             // Has been filled at least once
+        bool dirty = true;              // Mesh no longer matches the samples
+        std::vector<Sample> samples;    // SAMPLES x SAMPLES, wrapped by grid index
+    };
+
+    const ModularWorldGenerator* m_generator;
+    std::vector<Level> m_levels;
+    size_t m_samplesTaken;
+
+    Sample sampleTerrain(int worldX, int worldZ) const;
+    void sampleRange(Level& level, int minX, int maxX, int minZ, int maxZ);  // Grid indices, inclusive
+    const Sample& getSample(const Level& level, int gridX, int gridZ) const;
+    static int wrap(int gridIndex);
+};
@@ -1,7 +1,13 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <atomic>
 #include "world/Block.h"
+#include "world/ProtoChunk.h"
 #include "world/TerrainGenerator.h"
 #include <glm/glm.hpp>
 
@@ -22,6 +28,20 @@ struct TerrainContext {
         : chunkX(cx), chunkZ(cz), terrainHeight(height), isLakeArea(lake), waterLevel(water), worldPos(pos) {}
 };
 
+/**
+ * Jittered-grid placement - one candidate point per square cell, at a seeded
+ * random offset inside the cell. A chunk only enumerates the few cells that
+ * overlap it, and the same cell always yields the same point, so features
+ * get spacing for free without probing every column.
+ */
+struct FeaturePlacement {
+    int cellSize = 0;            // 0 = poll every surface column
+    std::uint64_t salt = 0;      // Keeps the grids of different features apart
+    
+    // Candidate columns inside the chunk, in chunk-local coordinates
+    void getCandidates(const glm::ivec2& chunkPos, unsigned int seed, std::vector<glm::ivec2>& candidates) const;
+};
+
 /**
  * Base class for terrain features (trees, ores, structures, etc.)
  * Makes adding new world generation features much easier!
@@ -30,12 +50,15 @@ class TerrainFeature {
 public:
     virtual ~TerrainFeature() = default;
     
-    // Generate this feature in the given chunk
-    virtual void generate(Chunk& chunk, const TerrainContext& context) = 0;
+    // Generate this feature at the context position - may write into neighbouring chunks
+    virtual void generate(FeatureWriter& writer, const TerrainContext& context) = 0;
     
     // Check if this feature should generate at the given position
     virtual bool shouldGenerate(const TerrainContext& context) const = 0;
     
+    // Where to ask shouldGenerate - sparse features return a candidate grid
+    virtual FeaturePlacement getPlacement() const { return FeaturePlacement(); }
+    
     // Get feature name for debugging
     virtual std::string getName() const = 0;
     
@@ -46,17 +69,44 @@ public:
 /**
  * Modular World Generator
  * Features can be easily added and removed without touching core generation code
+ *
+ * Chunks go through a staged pipeline:
+ *   1. heightmap - terrain height and lake map per column (cached in the proto-chunk)
+ *   2. surface   - base blocks from the heightmap, then cave carving
+ *   3. features  - trees etc., recorded as writes into the 3x3 neighbourhood
+ *   4. finalize  - surface plus the feature writes of all 9 neighbours, applied in
+ *                  a fixed order
+ * A chunk is finalized only once every neighbour has reached the feature stage,
+ * so features spanning chunk edges are complete without any post-pass.
+ * Far chunks stop after the heightmap (generateHeightfield); the cached heightmap
+ * is reused if the chunk is later generated in full.
  */
 class ModularWorldGenerator {
 public:
     ModularWorldGenerator(unsigned int seed);
     
+    // Standard generator (terrain + trees) configured from g_worldConfig
+    static std::unique_ptr<ModularWorldGenerator> createDefault(unsigned int seed);
+    
+    // Output is a pure function of (seed, settings, chunk position) - no thread
+    // or scheduling order dependence. Bump this whenever generated blocks change.
+    static constexpr std::uint32_t GENERATOR_VERSION = 4;
+    
+    // Fingerprint of everything that affects generated blocks (version, seed, config)
+    // Used to invalidate cached chunks when the world would generate differently
+    std::uint32_t getSignature() const { return m_signature; }
+    unsigned int getSeed() const { return m_seed; }
+    
     // Add a terrain feature
     void addFeature(std::unique_ptr<TerrainFeature> feature);
     
-    // Generate terrain for a chunk
+    // Generate terrain for a chunk (thread-safe, runs neighbour features as needed)
     void generateChunk(Chunk& chunk);
     
+    // Far-chunk fast path: the heightmap and the surface block of each column only -
+    // no voxel fill, caves or features (thread-safe, shares the heightmap cache)
+    void generateHeightfield(const glm::ivec2& chunkPos, ChunkHeightfield& heightfield);
+    
     // Get base terrain height (delegates to original TerrainGenerator)
     int getTerrainHeight(int worldX, int worldZ) const;
     
@@ -69,10 +119,39 @@ public:
     int getWaterLevel() const;
     int getTreeHeight() const;
     
+    // Time spent in each pipeline stage, summed over all threads
+    enum Stage { STAGE_HEIGHTMAP, STAGE_SURFACE, STAGE_FEATURES, STAGE_FINALIZE, STAGE_COUNT };
+    double getStageTimeMs(Stage stage) const { return m_stageMicros[stage].load() / 1000.0; }
+    uint64_t getStageRuns(Stage stage) const { return m_stageRuns[stage].load(); }
+    
 private:
+    unsigned int m_seed;
+    std::uint32_t m_signature;
     std::unique_ptr<TerrainGenerator> m_baseGenerator;
     std::vector<std::unique_ptr<TerrainFeature>> m_features;
     
+    // Proto-chunks of chunks still waiting to be finalized
+    static constexpr size_t MAX_PROTO_CHUNKS = 4096;
+    std::unordered_map<glm::ivec2, std::unique_ptr<ProtoChunk>, ChunkPositionHash> m_protoChunks;
+    std::mutex m_protoMutex;
+    std::condition_variable m_protoCondition;
+    uint64_t m_protoTick = 0;
+    
+    std::atomic<uint64_t> m_stageMicros[STAGE_COUNT] = {};
+    std::atomic<uint64_t> m_stageRuns[STAGE_COUNT] = {};
+    void addStageTime(Stage stage, double micros);
+    
+    // Pipeline stages
+    void buildHeightmap(const glm::ivec2& chunkPos, ProtoChunk& proto) const;
+    void buildSurface(Chunk& chunk, const ProtoChunk& proto) const;
+    void runFeatures(const glm::ivec2& chunkPos, const ProtoChunk& proto, FeatureWriter& writer) const;
+    
+    // Writes from the chunk at sourcePos into targetPos, running its features if needed
+    void collectFeatureWrites(const glm::ivec2& sourcePos, const glm::ivec2& targetPos,
+                              std::vector<BlockWrite>& writes);
+    ProtoChunk& getProtoChunk(const glm::ivec2& chunkPos);  // Caller holds m_protoMutex
+    void evictProtoChunks();                                // Caller holds m_protoMutex
+    
     // Sort features by priority
     void sortFeaturesByPriority();
     
@@ -24,6 +24,11 @@ public:
     double octaveNoise(double x, double y, int octaves, double persistence = 0.5) const;
     double octaveNoise(double x, double y, double z, int octaves, double persistence = 0.5) const;
     
+    // ⚡ Batched 3D octave noise over a regular lattice (caves) - out[x + nx * (z + nz * y)]
+    // Same result as octaveNoise() at each lattice point, without per-call overhead
+    void octaveNoiseGrid(double x0, double y0, double z0, double stepX, double stepY, double stepZ,
+                         int nx, int ny, int nz, int octaves, double persistence, double* out) const;
+    
     // 🌄 Advanced terrain generation functions
     double ridgedNoise(double x, double y, int octaves = 4, double persistence = 0.5) const;
     double billowNoise(double x, double y, int octaves = 4, double persistence = 0.5) const;
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "world/Block.h"
+#include "world/Chunk.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+// Chunks a feature may write into: its own chunk and the 8 around it
+constexpr int NEIGHBOURHOOD_SIZE = 3;
+constexpr int NEIGHBOURHOOD_SLOTS = NEIGHBOURHOOD_SIZE * NEIGHBOURHOOD_SIZE;
+
+// Slot of a chunk offset (-1..1, -1..1) within the 3x3 neighbourhood
+inline int getNeighbourSlot(int dx, int dz) { return (dx + 1) + (dz + 1) * NEIGHBOURHOOD_SIZE; }
+inline glm::ivec2 getNeighbourOffset(int slot) {
+    return glm::ivec2(slot % NEIGHBOURHOOD_SIZE - 1, slot / NEIGHBOURHOOD_SIZE - 1);
+}
+
+/**
+ * A single block written by a feature, replayed when the target chunk is finalized
+ */
+struct BlockWrite {
+    uint16_t index;       // Chunk-local index (x + z*16 + y*256)
+    BlockType type;
+    bool onlyIntoAir;     // Soft placement - only fills air or the same block type
+};
+
+/**
+ * Feature Writer - records the blocks one chunk's features place
+ *
+ * Features write in world coordinates and may reach into the neighbouring
+ * chunks (tree canopies crossing a chunk edge). Writes are sorted into one
+ * list per target chunk; each target applies them when it is finalized, so
+ * a feature never needs its neighbours to exist while it runs.
+ * Writes beyond the 3x3 neighbourhood or outside the world height are dropped.
+ */
+class FeatureWriter {
+public:
+    explicit FeatureWriter(const glm::ivec2& chunkPos);
+
+    // Unconditional write (trunks, structures)
+    void setBlock(int worldX, int y, int worldZ, BlockType type);
+
+    // Only fills air or the same block type (leaves never replace terrain or logs)
+    void placeBlock(int worldX, int y, int worldZ, BlockType type);
+
+    // Writes for the chunk at chunkPos + getNeighbourOffset(slot), in placement order
+    std::vector<BlockWrite>& getWrites(int slot) { return m_writes[slot]; }
+
+private:
+    glm::ivec2 m_chunkPos;
+    std::vector<BlockWrite> m_writes[NEIGHBOURHOOD_SLOTS];
+
+    void record(int worldX, int y, int worldZ, BlockType type, bool onlyIntoAir);
+};
+
+// How far a proto-chunk has come through the generation pipeline
+enum class GenerationStage : uint8_t {
+    EMPTY,      // Only holds writes from neighbours
+    HEIGHTMAP,  // Heightmap and lake map are cached
+    FEATURES    // Own features ran and were delivered to the neighbourhood
+};
+
+/**
+ * Proto-Chunk - generation state of a chunk that is not finalized yet
+ *
+ * Holds the cached heightmap and the pending feature writes each chunk in the
+ * neighbourhood has delivered into this one (one slot per source chunk).
+ * Everything here is derived from the seed, so a proto-chunk can be evicted
+ * at any time and rebuilt on demand with identical results.
+ */
+struct ProtoChunk {
+    GenerationStage stage = GenerationStage::EMPTY;
+    bool featuresRunning = false;        // Another thread is running this chunk's features
+    int heightMap[CHUNK_SIZE][CHUNK_SIZE];
+    bool lakeMap[CHUNK_SIZE][CHUNK_SIZE];
+
+    std::vector<BlockWrite> incoming[NEIGHBOURHOOD_SLOTS];  // Indexed by source offset
+    bool hasIncoming[NEIGHBOURHOOD_SLOTS] = {};
+    uint64_t lastUsed = 0;               // For LRU eviction
+};
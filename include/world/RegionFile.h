@@ -0,0 +1,82 @@
+#pragma once
+
+#include "world/Block.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+constexpr int REGION_SIZE = 32;                                  // Chunks per region side
+constexpr int REGION_CHUNK_COUNT = REGION_SIZE * REGION_SIZE;    // 1024 chunks per file
+
+/**
+ * Region File - one file on disk holding a 32x32 area of chunks
+ *
+ * Layout:   [header][offset table: 1024 entries][compressed chunk sections...]
+ * Sections are zlib-compressed block arrays aligned to 4KB sectors. A chunk
+ * that is saved again goes to free sectors first, and its old sectors are only
+ * released once the offset table points at the new copy.
+ * Reads go straight through an mmap of the file - no copies, no seeks.
+ * The header records the generator signature; a region written by a
+ * different seed/settings is discarded and rebuilt on open.
+ */
+class RegionFile {
+public:
+    RegionFile(const std::string& path, uint32_t signature);
+    ~RegionFile();
+
+    RegionFile(const RegionFile&) = delete;
+    RegionFile& operator=(const RegionFile&) = delete;
+
+    // Open (or create) the file and load its offset table
+    bool open();
+
+    // Chunk access - local coordinates are 0..REGION_SIZE-1
+    bool hasChunk(int localX, int localZ) const;
+    bool readChunk(int localX, int localZ, std::vector<BlockType>& blocks);
+    bool writeChunk(int localX, int localZ, const std::vector<uint8_t>& compressed, uint32_t rawSize);
+
+    const std::string& getPath() const { return m_path; }
+
+    // Coordinate helpers (handle negative chunk coordinates properly)
+    static glm::ivec2 chunkToRegion(const glm::ivec2& chunkPos);
+    static glm::ivec2 chunkToLocal(const glm::ivec2& chunkPos);
+    static std::string getFileName(const glm::ivec2& regionPos);
+
+private:
+    // One entry in the on-disk offset table
+    struct SectionEntry {
+        uint32_t offset = 0;    // Byte offset of the section (0 = chunk not stored)
+        uint32_t size = 0;      // Compressed size in bytes
+        uint32_t capacity = 0;  // Bytes reserved on disk (multiple of SECTOR_SIZE)
+        uint32_t rawSize = 0;   // Uncompressed size in bytes
+    };
+
+    static constexpr uint32_t MAGIC = 0x4752434D;  // "MCRG"
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint32_t SECTOR_SIZE = 4096;
+    static constexpr size_t HEADER_SIZE = 3 * sizeof(uint32_t);  // magic, version, signature
+    static constexpr size_t TABLE_SIZE = REGION_CHUNK_COUNT * sizeof(SectionEntry);
+    static constexpr size_t DATA_START = ((HEADER_SIZE + TABLE_SIZE + SECTOR_SIZE - 1) / SECTOR_SIZE) * SECTOR_SIZE;
+
+    std::string m_path;
+    uint32_t m_signature;
+    int m_fd;
+    const uint8_t* m_mapped;     // Read-only mapping of the whole file
+    size_t m_mappedSize;
+    size_t m_fileSize;
+    std::vector<SectionEntry> m_table;
+    std::map<uint32_t, uint32_t> m_freeSectors;  // Offset -> bytes of sectors no entry uses
+    mutable std::mutex m_mutex;  // Serializes reads/writes on this file
+
+    bool initialize();
+    void findFreeSectors();
+    uint32_t allocateSectors(uint32_t capacity);
+    void releaseSectors(uint32_t offset, uint32_t capacity);
+    bool remap();
+    void unmap();
+    static int getTableIndex(int localX, int localZ) { return localX + localZ * REGION_SIZE; }
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "world/Block.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * SectionVisibility - which faces of a 16x16x16 chunk section see each other
+ *
+ * Computed at mesh time by flood-filling the section's see-through blocks:
+ * every connected region of air, water or leaves that touches faces A and B
+ * connects them. Stored as a symmetric 6x6 bitset. VisibilityGraph walks these
+ * out from the camera each frame to find the sections that can be seen at all.
+ */
+class SectionVisibility {
+public:
+    enum Face { NEG_X, POS_X, NEG_Y, POS_Y, NEG_Z, POS_Z, FACE_COUNT };
+    static constexpr int SIZE = 16;
+
+    // Sections that were never computed hide nothing
+    SectionVisibility() : m_bits(ALL_CONNECTED) {}
+    static SectionVisibility none() { return SectionVisibility(0); }
+
+    bool connects(int from, int to) const { return (m_bits >> (from * FACE_COUNT + to)) & 1; }
+    void connect(int a, int b) {
+        m_bits |= (1ull << (a * FACE_COUNT + b)) | (1ull << (b * FACE_COUNT + a));
+    }
+    bool isOpen() const { return m_bits == ALL_CONNECTED; }
+    std::uint64_t getBits() const { return m_bits; }
+
+    // Flood fill of one section of a chunk's blocks (index x + z*16 + y*256)
+    static SectionVisibility compute(const std::vector<BlockType>& blocks, int sectionY);
+
+    static int opposite(int face) { return face ^ 1; }
+    static glm::ivec3 getDirection(int face);
+
+    // Blocks light and sight pass through - the same set the mesher draws faces behind
+    static bool isSeeThrough(BlockType type) {
+        return type == BlockType::AIR || type == BlockType::WATER || type == BlockType::LEAVES;
+    }
+
+private:
+    static constexpr std::uint64_t ALL_CONNECTED = (1ull << (FACE_COUNT * FACE_COUNT)) - 1;
+    std::uint64_t m_bits;
+
+    explicit SectionVisibility(std::uint64_t bits) : m_bits(bits) {}
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include "world/PerlinNoise.h"
 #include "world/Block.h"
+#include "world/Chunk.h"
 #include <glm/glm.hpp>
 
 /**
@@ -22,6 +23,12 @@ public:
     // Get the appropriate block type for a position
     BlockType getBlockType(int worldX, int worldY, int worldZ, int surfaceHeight) const;
     
+    // Top block of every column in a chunk - same result as getBlockType at the
+    // surface height, but the coastline search reads one shared noise grid
+    void getSurfaceBlocks(const glm::ivec2& chunkPos, const int heightMap[CHUNK_SIZE][CHUNK_SIZE],
+                          const bool lakeMap[CHUNK_SIZE][CHUNK_SIZE],
+                          BlockType surface[CHUNK_SIZE][CHUNK_SIZE]) const;
+    
     // Lake generation
     bool shouldGenerateLake(int worldX, int worldZ) const;
     int getWaterLevel() const { return m_params.waterLevel; }
@@ -44,6 +51,14 @@ public:
     // Tree generation
     bool shouldGenerateTree(int worldX, int worldZ) const;
     
+    // Cave carving - hollows out a whole chunk from its heightmap (heightMap[x][z])
+    // Returns the number of blocks carved
+    int carveCaves(Chunk& chunk, const int heightMap[CHUNK_SIZE][CHUNK_SIZE]) const;
+    
+    // Cave density lattice: one sample every 4x8x4 blocks, trilinear in between
+    static constexpr int CAVE_CELL_XZ = 4;
+    static constexpr int CAVE_CELL_Y = 8;
+    
     // Terrain generation parameters - Minecraft-style varied terrain
     struct TerrainParams {
         double heightScale = 15.0;      // Good variation for interesting terrain
@@ -74,7 +89,7 @@ public:
 private:
     PerlinNoise m_heightNoise;          // Primary terrain height
     PerlinNoise m_detailNoise;          // Fine detail noise
-    PerlinNoise m_caveNoise;            // For future cave generation
+    PerlinNoise m_caveNoise;            // 3D density for cave carving
     PerlinNoise m_lakeNoise;            // For lake generation
     PerlinNoise m_plainsNoise;          // For plains generation
     PerlinNoise m_treeNoise;            // For tree generation
@@ -85,5 +100,4 @@ private:
     // Helper functions
     double getHeightNoise(double x, double z) const;
     int getBaseHeight(int worldX, int worldZ) const;  // Get height without lake modifications
-    bool shouldGenerateCave(int x, int y, int z) const;
 };
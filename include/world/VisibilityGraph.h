@@ -0,0 +1,61 @@
+#pragma once
+
+#include "world/Chunk.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * VisibilityGraph - CPU occlusion culling over chunk sections
+ *
+ * A breadth-first walk from the camera's section. A section is entered through
+ * one face and left through another only if its SectionVisibility connects the
+ * two, and the walk never steps back towards the camera, so sight lines can't
+ * bend round corners. Sections the walk never reaches are hidden behind
+ * terrain - underground, that is nearly everything.
+ *
+ * Deterministic, no GPU round-trip, and GL-free: the walk only sees
+ * connectivity through the lookup, so synthetic layouts test it headless.
+ */
+class VisibilityGraph {
+public:
+    // Sections of one loaded chunk, bottom first - null if it isn't loaded (treated as open)
+    using ColumnLookup = std::function<const SectionVisibility*(const glm::ivec2& chunkPos)>;
+    // Frustum test - sections outside are neither drawn nor walked through
+    using SectionFilter = std::function<bool(const glm::ivec3& section)>;
+
+    // Walk every section within radius chunks of the camera
+    void compute(const glm::vec3& cameraPos, int radius, const ColumnLookup& lookup,
+                 const SectionFilter& inView = nullptr);
+
+    // Results of the last compute - anything outside its radius is not judged (visible)
+    bool isSectionVisible(const glm::ivec3& section) const;
+    bool isChunkVisible(const glm::ivec2& chunkPos) const;
+
+    // Statistics
+    int getVisibleSections() const { return m_visibleSections; }
+
+private:
+    struct Column {
+        const SectionVisibility* sections = nullptr;
+        bool lookedUp = false;
+        std::uint8_t visibleMask = 0;   // Bit per section reached
+    };
+
+    struct Step {
+        glm::ivec3 section;
+        int entryFace;                  // Face it was entered through, -1 for the camera's own
+        int directions;                 // Faces stepped out of so far, as a bit mask
+    };
+
+    glm::ivec2 m_center = glm::ivec2(0);
+    int m_radius = -1;
+    int m_side = 0;
+    std::vector<Column> m_columns;
+    std::vector<Step> m_queue;
+    int m_visibleSections = 0;
+
+    int getColumnIndex(const glm::ivec2& chunkPos) const;  // -1 outside the radius
+    void visit(const glm::ivec3& section, int columnIndex, int entryFace, int directions);
+};
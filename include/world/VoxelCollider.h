@@ -0,0 +1,70 @@
+#pragma once
+
+#include "world/Block.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+class ChunkView;
+
+// Axis-aligned box in world space
+struct AABB {
+    glm::vec3 min;
+    glm::vec3 max;
+
+    AABB moved(const glm::vec3& offset) const { return {min + offset, max + offset}; }
+    glm::vec3 center() const { return (min + max) * 0.5f; }
+};
+
+// What a move did - the motion made and which axes were stopped
+struct CollisionResult {
+    glm::vec3 motion{0.0f};
+    bool collidedX = false;
+    bool collidedY = false;
+    bool collidedZ = false;
+    bool onGround = false;   // Stopped while moving down
+    bool steppedUp = false;  // Took the step-up path
+};
+
+/**
+ * VoxelCollider - swept boxes against the block grid
+ *
+ * A move gathers the solid blocks overlapped by the box's sweep - the box
+ * grown by the motion, so only voxels the move could touch are read - then
+ * resolves one axis at a time, Y first, then X, then Z: each axis's motion
+ * is cut short at the nearest face in its way before the box moves along it.
+ * However long the motion, nothing is tunnelled through, and blocked axes
+ * slide along walls instead of stopping the whole move.
+ *
+ * With a step height, a move that is stopped sideways on the ground is
+ * retried raised by up to that height and dropped back down, and kept if it
+ * gets further - walking up one-block ledges without a jump.
+ *
+ * Blocks span +-0.5 around their integer coordinates, as the mesher draws
+ * them. Reads go through a ChunkView; chunks it cannot see are solid, so
+ * nothing walks or falls into terrain that isn't there yet. Plain float math
+ * in a fixed order, so the same inputs always give the same result. GL-free.
+ */
+class VoxelCollider {
+public:
+    VoxelCollider();
+
+    static bool isSolid(BlockType type) { return type != BlockType::AIR && type != BlockType::WATER; }
+    static AABB blockBox(int x, int y, int z);
+
+    // Moves box by motion as far as the blocks allow, updating box
+    CollisionResult move(ChunkView& view, AABB& box, const glm::vec3& motion, float stepHeight = 0.0f);
+
+    // Whether box overlaps any solid block
+    bool intersects(ChunkView& view, const AABB& box);
+
+    // Voxels read by all calls so far
+    long long getVoxelsVisited() const { return m_voxelsVisited; }
+
+private:
+    std::vector<AABB> m_solids;  // Scratch, reused between calls
+    long long m_voxelsVisited;
+
+    void gatherSolids(ChunkView& view, const AABB& region);
+    float clipAxis(int axis, const AABB& box, float motion) const;
+    CollisionResult resolve(AABB& box, const glm::vec3& motion) const;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "world/Block.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+class ChunkView;
+
+// First block a ray runs into
+struct RaycastHit {
+    bool hit = false;
+    glm::ivec3 blockPos;
+    glm::vec3 hitPoint;    // Where the ray enters the block
+    glm::ivec3 normal;     // Face it enters through
+    BlockType blockType;
+};
+
+/**
+ * VoxelRaycaster - DDA ray walks through the block grid
+ *
+ * A ray steps from block to block in the order it crosses them and stops at
+ * the first one that isn't air, skipping the block it starts in. Blocks span
+ * +-0.5 around their integer coordinates, as the mesher and BlockOutline draw
+ * them.
+ *
+ * ⚡ The walk keeps the chunk it is in, asking the ChunkView for a chunk only
+ * when an x or z step crosses into another one, and reads the chunk's
+ * ChunkOccupancy bits rather than its blocks. Empty 16x16x16 sections and the
+ * space above and below the world are crossed in one jump, which leaves the
+ * walk where stepping through them block by block would - the same hits
+ * either way. Smaller empty boxes aren't worth a jump: one costs about as much
+ * as the handful of steps it would save.
+ * A batch traces every ray through one view, so rays near each other share
+ * their chunk lookups. A chunk the view can't see ends the ray without a
+ * hit. GL-free.
+ */
+class VoxelRaycaster {
+public:
+    struct Ray {
+        glm::vec3 origin;
+        glm::vec3 direction;
+        float maxDistance;
+    };
+
+    static RaycastHit trace(ChunkView& view, const glm::vec3& origin, const glm::vec3& direction, float maxDistance);
+
+    // One result per ray, in the same order
+    static void traceBatch(ChunkView& view, const std::vector<Ray>& rays, std::vector<RaycastHit>& results);
+};
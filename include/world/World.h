@@ -2,6 +2,13 @@
 
 #include "world/Chunk.h"
 #include "world/ModularWorldGenerator.h"
+#include "world/ChunkStorage.h"
+#include "world/ChunkView.h"
+#include "world/EditJournal.h"
+#include "world/ChunkLODManager.h"
+#include "world/VisibilityGraph.h"
+#include "engine/graphics/OcclusionCuller.h"
+#include "engine/graphics/BatchFrustumCuller.h"
 #include "world/features/TreeFeature.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -13,17 +20,12 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
+#include <algorithm>
 
 class ChunkRenderer;
 class Camera;
 
-// Hash function for glm::ivec2 to use as key in unordered_map
-struct ChunkPositionHash {
-    std::size_t operator()(const glm::ivec2& pos) const {
-        return std::hash<int>()(pos.x) ^ (std::hash<int>()(pos.y) << 1);
-    }
-};
-
 class World {
 public:
     World();
@@ -37,6 +39,9 @@ public:
     Chunk* getChunk(const glm::ivec2& chunkPos);
     BlockType getBlock(int x, int y, int z) const;
     BlockType getBlockType(const glm::ivec3& worldPos) const; // Convenience method for vector input
+    
+    // ⚡ Many block reads with one locked lookup per chunk - valid until the next update()
+    ChunkView createChunkView() const;
     void setBlock(int x, int y, int z, BlockType type);
     
     // Coordinate conversion utilities
@@ -47,10 +52,27 @@ public:
     void setRenderDistance(int distance) { m_renderDistance = distance; }
     int getRenderDistance() const { return m_renderDistance; }
     
+    // 🏔️ Chunks between the render distance and this one are heightfield silhouettes
+    // (0 or <= render distance disables them)
+    void setFarRenderDistance(int distance) { m_farRenderDistance = distance; }
+    int getFarRenderDistance() const { return std::max(m_renderDistance, m_farRenderDistance); }
+    
+    // 📊 Culling that never depends on worker timing: each frame waits for the
+    // occlusion pass over the frame before it (headless benchmark runs)
+    void setDeterministicCulling(bool deterministic) { m_deterministicCulling = deterministic; }
+    
     // Loading progress tracking
     int getLoadedChunkCount() const;
     int getRequiredChunkCount(const glm::vec3& playerPosition) const;
     bool isInitialLoadingComplete(const glm::vec3& playerPosition) const;
+    // Generation, upgrades, mesh rebuilds or LOD uploads still to come for loaded chunks
+    bool hasPendingWork();
+    
+    // 👁️ Full chunks the visibility graph hid last frame
+    int getVisibilityCulledChunks() const { return m_visibilityCulledChunks; }
+    // 🧱 Chunks the software depth buffer hid last frame, and chunks drawn
+    int getOcclusionCulledChunks() const { return m_occlusionCulledChunks; }
+    int getRenderedChunks() const { return m_renderedChunks; }
     
     // 🌍 Terrain generation access
     ModularWorldGenerator* getTerrainGenerator() const { return m_terrainGenerator.get(); }
@@ -59,11 +81,27 @@ private:
     // Core data
     std::unordered_map<glm::ivec2, std::unique_ptr<Chunk>, ChunkPositionHash> m_chunks;
     std::unique_ptr<ModularWorldGenerator> m_terrainGenerator; // 🌍 Natural world generation with features
+    std::unique_ptr<ChunkStorage> m_chunkStorage; // 💾 Region file cache of generated chunks (null if disabled)
+    std::unique_ptr<EditJournal> m_editJournal;   // 💾 Player edits as deltas against generated terrain
+    std::unique_ptr<ChunkLODManager> m_lodManager; // ⚡ Downsampled meshes for distant chunks (null if disabled)
+    VisibilityGraph m_visibilityGraph;             // 👁️ Sections the camera can see through caves and air
+    std::unique_ptr<OcclusionCuller> m_occlusionCuller; // 🧱 CPU depth buffer of nearby terrain (null if disabled)
+    OcclusionCuller::Result m_occlusionResult;     // Last finished occlusion pass
+    std::unordered_set<glm::ivec2, ChunkPositionHash> m_occlusionHidden; // Chunks it hid
+    BatchFrustumCuller m_frustumCuller;            // ⚡ Every chunk's mesh bounds, culled in SIMD batches
+    std::vector<Chunk*> m_cullChunks;              // Chunk of each culler box
+    std::vector<int> m_visibleChunkIndices;
+    bool m_cullListDirty;                          // Chunks or their bounds changed - rebuild the culler
+    bool m_deterministicCulling;                   // Wait for each occlusion result instead of taking what's done
     
     // World state
     int m_renderDistance;
+    int m_farRenderDistance;
     glm::ivec2 m_lastPlayerChunkPos;
     bool m_firstUpdate;
+    int m_visibilityCulledChunks;
+    int m_occlusionCulledChunks;
+    int m_renderedChunks;
     
     // ⚡ Async chunk generation system with thread pool
     std::queue<glm::ivec2> m_chunksNeedingGeneration;
@@ -77,6 +115,20 @@ private:
     
     // Performance settings - optimized for smoothness
     static constexpr float UNLOAD_DISTANCE_MULTIPLIER = 1.5f; // When to unload chunks
+    static constexpr float OCCLUDER_DISTANCE = 4.0f;          // Chunks this near are rasterized as occluders
+    static constexpr float OCCLUSION_MIN_DISTANCE = 2.0f;     // Chunks this near are never occlusion tested
+    static constexpr float CULL_CELL_SIZE = 8.0f * CHUNK_SIZE; // Frustum culler groups 8x8 chunks
+    static constexpr float JOURNAL_FLUSH_INTERVAL = 1.0f;     // Seconds between edit journal writes
+    std::chrono::steady_clock::time_point m_lastJournalFlush;
+    
+    // 🏔️ Heightfield chunks that came into the render distance are generated in full
+    // by the workers, then swapped in on the main thread (the renderer holds raw pointers)
+    std::vector<std::unique_ptr<Chunk>> m_upgradedChunks;
+    std::unordered_set<glm::ivec2, ChunkPositionHash> m_chunksBeingUpgraded;
+    std::mutex m_upgradeMutex;
+    static constexpr int MAX_UPGRADES_PER_FRAME = 4;  // Each one uploads a full mesh
+    static constexpr int FAR_UNLOAD_MARGIN = 4;       // Chunks of slack before far chunks unload
+    static constexpr int MAX_LOD_UPLOADS_PER_FRAME = 16; // Coarse meshes are small
     
     // Internal methods
     void generateChunksAroundPlayer(const glm::vec3& playerPosition);
@@ -84,6 +136,8 @@ private:
     void unloadDistantChunks(const glm::vec3& playerPosition);
     void generateTerrainAsync(); // ⚡ Background terrain generation
     void terrainGenerationWorker(); // ⚡ Background worker thread
+    void loadOrGenerateTerrain(const glm::ivec2& chunkPos, Chunk& chunk); // 💾 Region cache, generator, edits
+    void swapInUpgradedChunks();    // 🏔️ Replace heightfield chunks with their full versions
     
     // Utility functions
     bool isChunkLoaded(const glm::ivec2& chunkPos) const;
@@ -10,10 +10,19 @@ struct WorldConfig {
     struct Rendering {
         int renderDistance = 8;         // Chunks to render in each direction
         int loadDistance = 10;          // Chunks to keep loaded (should be >= renderDistance)
+        int farRenderDistance = 24;     // Heightfield-only chunks out to here (0 = off)
+        bool enableLOD = true;          // Draw distant chunks from downsampled meshes
+        float lodMediumDistance = 8.0f; // Chunks beyond this use 2x2x2-block voxels
+        float lodLowDistance = 16.0f;   // Chunks beyond this use 4x4x4-block voxels
+        float lodHysteresis = 1.0f;     // Chunks past a threshold before switching level
+        float horizonScale = 10.0f;     // Horizon terrain out to this many render distances (0 = off)
         float fogStartDistance = 64.0f; // Distance where fog starts
         float fogEndDistance = 128.0f;  // Distance where fog is completely opaque
         bool enableFog = true;          // Whether to use fog for distant chunks
         bool enableFrustumCulling = true; // Cull chunks outside view frustum
+        bool enableVisibilityCulling = true; // Cull chunks no sight line from the camera reaches
+        bool enableOcclusionCulling = true;  // Cull chunks behind nearby terrain in a CPU depth buffer
+        bool enableFaceCulling = true;       // Skip face directions that point away from the camera
         int maxChunksPerFrame = 4;      // Max chunks to generate per frame (for lag prevention)
     } rendering;
     
@@ -64,6 +73,15 @@ struct WorldConfig {
             int maxDistance = 4;        // Maximum distance from water to generate gravel
             double edgeBonus = 0.5;     // Extra gravel probability right at water edge
         } gravel;
+        
+        // Cave carving from 3D noise
+        struct Caves {
+            bool enabled = true;
+            double frequency = 0.05;    // Lower = larger caves
+            double threshold = 0.3;     // Higher = fewer, narrower caves
+            int octaves = 2;            // Number of noise layers
+            int surfaceMargin = 4;      // Solid blocks always kept below the surface
+        } caves;
     } terrain;
     
     // TREE GENERATION SETTINGS
@@ -98,15 +116,22 @@ struct WorldConfig {
         float chunkUpdateDelay = 0.1f;      // Delay between chunk updates (seconds)
     } performance;
     
+    // PERSISTENCE SETTINGS
+    struct Persistence {
+        bool enabled = true;                // Save player edits (delta journal)
+        bool cacheGeneratedChunks = false;  // Also cache generated chunks in region files (trades disk for generation time)
+        std::string worldDirectory = "saves/world"; // Where the journal and region files are stored
+        int compressionLevel = 1;           // zlib level (1 = fastest, 9 = smallest files)
+    } persistence;
+    
     // CLOUD SETTINGS
     struct Clouds {
         bool enabled = true;                // Whether to render clouds
         float height = 80.0f;               // Height of cloud layer
         float speed = 0.01f;                // Cloud movement speed
         float density = 0.5f;               // Cloud density (0.0 - 1.0)
-        float updateDistance = 64.0f;       // Regenerate clouds when player moves this distance
-        int gridSize = 32;                  // Size of cloud grid
-        float spacing = 8.0f;               // Spacing between cloud positions
+        int gridSize = 32;                  // Cloud cells drawn each side of the camera
+        float spacing = 8.0f;               // Width of one cloud cell
         int layers = 6;                     // Number of cloud layers
         float layerSpacing = 2.5f;          // Spacing between cloud layers
     } clouds;
@@ -126,10 +151,11 @@ struct WorldConfig {
         bool showChunkBorders = false;      // Render chunk boundary lines
         bool showFPS = true;                // Display FPS counter
         bool showPlayerPosition = true;     // Display player coordinates
-        bool showChunkInfo = false;         // Display chunk generation info
+        bool showChunkInfo = false;         // Display chunks drawn and culled with the FPS
         bool enableWireframe = false;       // Render in wireframe mode
         bool logTreeGeneration = false;     // Log tree generation details
         bool logChunkGeneration = false;    // Log chunk generation details
+        int itemBenchmarkDrops = 0;         // Drops spawned around the player at startup (0 = none)
     } debug;
     
     // LIGHTING SETTINGS (for future use)
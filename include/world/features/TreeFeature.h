@@ -13,8 +13,9 @@ class TreeFeature : public TerrainFeature {
 public:
     TreeFeature(unsigned int seed);
     
-    void generate(Chunk& chunk, const TerrainContext& context) override;
+    void generate(FeatureWriter& writer, const TerrainContext& context) override;
     bool shouldGenerate(const TerrainContext& context) const override;
+    FeaturePlacement getPlacement() const override;
     std::string getName() const override { return "TreeFeature"; }
     int getPriority() const override { return 10; } // Generate after base terrain
     
@@ -27,30 +28,24 @@ public:
         double threshold = 0.3;     // Moderate threshold for reasonable tree density
         int minHeight = 4;          // Taller minimum trees
         int maxHeight = 7;          // Taller maximum trees for better leaf layers
-        int minSpacing = 5;         // Reasonable spacing between trees
+        int minSpacing = 5;         // Placement grid cell size - at most one tree per cell
     };
     
     void setParams(const TreeParams& params) { m_params = params; }
     const TreeParams& getParams() const { return m_params; }
     
-    // Post-processing to ensure all trees are complete
-    void ensureAllTreesGenerated(Chunk& chunk) const;
-    
 private:
     PerlinNoise m_treeNoise;
     TreeParams m_params;
     const TerrainGenerator* m_baseGenerator = nullptr;
     
-    bool checkSpacing(const TerrainContext& context) const;
     int getTreeHeight(const TerrainContext& context) const;
     
-    // New improved tree generation methods
-    void generateImprovedTree(Chunk& chunk, int localX, int baseY, int localZ, int height, const TerrainContext& context) const;
-    void generateSimpleLeaves(Chunk& chunk, int centerX, int leafStartY, int centerZ, int treeHeight) const;
-    void placeLeaf(Chunk& chunk, int x, int y, int z) const;
-    int countNearbyLeaves(Chunk& chunk, int centerX, int leafStartY, int centerZ) const;
+    // New improved tree generation methods (world coordinates - canopies may cross chunk edges)
+    void generateImprovedTree(FeatureWriter& writer, int worldX, int baseY, int worldZ, int height, const TerrainContext& context) const;
+    void generateSimpleLeaves(FeatureWriter& writer, int centerX, int leafStartY, int centerZ, int treeHeight) const;
+    void placeLeaf(FeatureWriter& writer, int x, int y, int z) const;
     
     // Helper methods for comprehensive tree generation
-    bool shouldGenerateTreeAtPosition(const TerrainContext& context) const;
     int getTerrainHeightAt(int worldX, int worldZ) const;
 };
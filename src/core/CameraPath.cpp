@@ -0,0 +1,40 @@
+#include "core/CameraPath.h"
+#include "engine/graphics/Camera.h"
+#include <algorithm>
+#include <cmath>
+
+CameraPath::CameraPath(Kind kind, const glm::vec3& start, int frames)
+    : m_kind(kind), m_start(start), m_frames(std::max(frames, 1)) {
+}
+
+bool CameraPath::parse(const std::string& name, Kind& kind) {
+    if (name == "orbit") {
+        kind = Kind::ORBIT;
+    } else if (name == "flyover") {
+        kind = Kind::FLYOVER;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* CameraPath::name(Kind kind) {
+    return kind == Kind::ORBIT ? "orbit" : "flyover";
+}
+
+void CameraPath::apply(int frame, Camera& camera) const {
+    float t = static_cast<float>(frame) / m_frames;
+    if (m_kind == Kind::ORBIT) {
+        // Walks the circle once over the run, looking along it - the view turns a full 360 degrees
+        float angle = t * 360.0f;
+        float radians = glm::radians(angle);
+        camera.setPosition(m_start + glm::vec3(std::cos(radians), 0.0f, std::sin(radians)) * ORBIT_RADIUS);
+        camera.setYaw(angle + 90.0f);
+        camera.setPitch(-15.0f);
+    } else {
+        // Yaw 0 looks along +x
+        camera.setPosition(m_start + glm::vec3(frame * FRAME_TIME * FLYOVER_SPEED, 0.0f, 0.0f));
+        camera.setYaw(0.0f);
+        camera.setPitch(-10.0f);
+    }
+}
@@ -4,8 +4,11 @@
 #include "engine/graphics/CloudRenderer.h"
 #include "engine/graphics/SkyboxRenderer.h"
 #include "engine/graphics/SunRenderer.h"
+#include "engine/graphics/HorizonRenderer.h"
+#include "engine/graphics/InstancedRenderer.h"
 #include "engine/graphics/Camera.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include "engine/AssetManager.h"
 #include "world/Block.h"
 #include "world/BlockDefinition.h"
@@ -13,23 +16,44 @@
 #include "utils/RaycastDebug.h"
 #include <cmath>
 #include "world/World.h"
+#include "world/VoxelCollider.h"
 #include "world/features/TreeFeature.h"
 #include "world/WorldConfig.h"
+#include "ui/UIBatch.h"
 #include "ui/LoadingScreen.h"
 #include "ui/Crosshair.h"
 #include "ui/BlockOutline.h"
 #include "ui/Hotbar.h"
 #include "ui/RayVisualization.h"
 
-#include "entities/ItemEntity.h"
+#include "entities/ItemStore.h"
+#include "utils/ModernCpp.h"
 #include <algorithm>
 
 // External declaration for global world config
 extern WorldConfig g_worldConfig;
 #include <GLFW/glfw3.h>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
+
+// 🧱 Player body around the camera, in blocks
+constexpr float PLAYER_HALF_WIDTH = 0.3f;
+constexpr float PLAYER_HEIGHT = 1.8f;
+constexpr float PLAYER_EYE_HEIGHT = 1.62f;
+constexpr float PLAYER_STEP_HEIGHT = 1.0f;  // Walks up one-block ledges - there are no slabs to step onto
+constexpr float PLAYER_TERMINAL_SPEED = -50.0f;
+
+// 🖥️ Headless runs
+constexpr float HEADLESS_CAMERA_HEIGHT = 24.0f;   // Blocks above the ground at the start
+constexpr int HEADLESS_SETTLE_FRAMES = 60;        // Unchanged frames before the world counts as settled
+constexpr double HEADLESS_SETTLE_TIMEOUT = 120.0; // Seconds - measure anyway after this
+
+Game::Game() : Game(HeadlessOptions()) {
+}
 
-Game::Game() : m_running(false), m_lastFrameTime(0.0f), m_frameCount(0.0f), m_fpsTimer(0.0f), m_currentFPS(0.0f), m_isLoading(false), m_loadingStartTime(0.0f) {
+Game::Game(const HeadlessOptions& headless) : m_playerFallSpeed(0.0f), m_playerOnGround(false), m_running(false), m_lastFrameTime(0.0f), m_time(0.0f), m_headless(headless), m_frameCount(0.0f), m_fpsTimer(0.0f), m_currentFPS(0.0f), m_itemUpdateMs(0.0f), m_itemRenderMs(0.0f), m_isLoading(false), m_loadingStartTime(0.0f), m_startupReported(false) {
     
 }
 
@@ -39,6 +63,10 @@ Game::~Game() {
     m_hotbar.reset();
     m_blockOutline.reset();
     m_crosshair.reset();
+    m_uiBatch.reset();
+    m_items.reset();
+    m_itemRenderer.reset();
+    m_horizonRenderer.reset();  // Samples the world's generator
     m_world.reset();
     m_chunkRenderer.reset();
     m_sunRenderer.reset();
@@ -50,6 +78,11 @@ Game::~Game() {
 }
 
 void Game::run() {
+    if (m_headless.enabled) {
+        runHeadless();
+        return;
+    }
+    
     initialize();
     
     m_running = true;
@@ -57,6 +90,7 @@ void Game::run() {
         float currentTime = glfwGetTime();
         float deltaTime = currentTime - m_lastFrameTime;
         m_lastFrameTime = currentTime;
+        m_time = currentTime;
         
         // Poll for window events
         m_window->pollEvents();
@@ -66,10 +100,131 @@ void Game::run() {
         
         // Swap front and back buffers
         m_window->swapBuffers();
+        
+        if (!m_startupReported) {
+            reportStartup();
+        }
     }
 }
 
+void Game::reportStartup() {
+    m_startupReported = true;
+    double total = m_startupTimer.elapsedMs();
+    double firstFrame = total - m_startupTimes.window - m_startupTimes.world - m_startupTimes.renderers;
+    std::cout << "⏱️ Startup: " << total << " ms to the first frame - window and GL "
+              << m_startupTimes.window << " ms, world and asset threads started " << m_startupTimes.world
+              << " ms, renderers and uploads " << m_startupTimes.renderers << " ms, first frame "
+              << firstFrame << " ms" << std::endl;
+    
+    const AssetManager& assets = AssetManager::getInstance();
+    size_t fromCache = assets.getProgramCache().getHits();
+    std::cout << "⏱️ Shaders: " << assets.getShaderSetupMs() << " ms for " << assets.getCachedShaderCount()
+              << " programs - " << fromCache << " from the binary cache, "
+              << assets.getCachedShaderCount() - fromCache << " compiled" << std::endl;
+}
+
+void Game::runHeadless() {
+    initialize();
+    
+    // Above the middle of the spawn chunk, so the orbit never leaves it
+    float ground = static_cast<float>(m_world->getTerrainGenerator()->getTerrainHeight(CHUNK_SIZE / 2, CHUNK_SIZE / 2));
+    glm::vec3 start(CHUNK_SIZE / 2, ground + HEADLESS_CAMERA_HEIGHT, CHUNK_SIZE / 2);
+    CameraPath path(m_headless.path, start, m_headless.frames);
+    m_camera->setFlying(true);
+    path.apply(0, *m_camera);
+    settleHeadless();
+    
+    // ⏱️ Every frame is timed from update to glFinish, with scripted time so each run draws the same frames
+    std::vector<double> frameMs, updateMs, submitMs;
+    std::vector<int> drawCalls;
+    std::vector<uint64_t> triangles;
+    std::vector<uint8_t> pixels;
+    for (int frame = 0; frame < m_headless.frames; frame++) {
+        path.apply(frame, *m_camera);
+        m_time = frame * CameraPath::FRAME_TIME;
+        g_drawStats.reset();
+        
+        Utils::Timer frameTimer;
+        update(frame == 0 ? 0.0f : CameraPath::FRAME_TIME);
+        double updated = frameTimer.elapsedMs();
+        render();
+        double submitted = frameTimer.elapsedMs();
+        m_window->swapBuffers();
+        frameMs.push_back(frameTimer.elapsedMs());
+        updateMs.push_back(updated);
+        submitMs.push_back(submitted - updated);
+        drawCalls.push_back(g_drawStats.drawCalls);
+        triangles.push_back(g_drawStats.triangles);
+        
+        if (std::find(m_headless.checksumFrames.begin(), m_headless.checksumFrames.end(), frame) !=
+            m_headless.checksumFrames.end()) {
+            m_window->readPixels(pixels);
+            std::cout << "📊 Frame " << frame << " checksum " << std::hex << std::setw(16) << std::setfill('0')
+                      << Utils::fnv1a64(pixels.data(), pixels.size()) << std::dec << std::setfill(' ') << std::endl;
+        }
+    }
+    
+    auto average = [](const auto& values) {
+        double sum = 0.0;
+        for (auto value : values) sum += static_cast<double>(value);
+        return values.empty() ? 0.0 : sum / values.size();
+    };
+    std::vector<double> sorted = frameMs;
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted](double p) {
+        return sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+    };
+    
+    int width, height;
+    m_window->getFramebufferSize(width, height);
+    std::cout << "📊 Headless: " << m_headless.frames << " frames of the " << CameraPath::name(m_headless.path)
+              << " path at " << width << "x" << height << ", " << m_world->getLoadedChunkCount() << " chunks loaded\n"
+              << "   frame ms   avg " << average(frameMs) << ", min " << percentile(0.0) << ", p50 " << percentile(0.5)
+              << ", p95 " << percentile(0.95) << ", p99 " << percentile(0.99) << ", max " << sorted.back() << "\n"
+              << "   split ms   update " << average(updateMs) << ", render submit " << average(submitMs)
+              << ", finish " << average(frameMs) - average(updateMs) - average(submitMs) << "\n"
+              << "   draw calls avg " << average(drawCalls) << ", max " << *std::max_element(drawCalls.begin(), drawCalls.end()) << "\n"
+              << "   triangles  avg " << static_cast<uint64_t>(average(triangles)) << ", max "
+              << *std::max_element(triangles.begin(), triangles.end()) << std::endl;
+}
+
+void Game::settleHeadless() {
+    // Chunks generate and mesh on worker threads - measuring while they stream in would
+    // time the loading, and make the frames differ from run to run
+    Utils::Timer timer;
+    int lastLoaded = -1;
+    int lastRendered = -1;
+    int unchanged = 0;
+    int frames = 0;
+    while (unchanged < HEADLESS_SETTLE_FRAMES) {
+        update(0.0f);
+        render();
+        m_window->swapBuffers();
+        frames++;
+        if (!m_startupReported) {
+            reportStartup();
+        }
+        
+        int loaded = m_world->getLoadedChunkCount();
+        int rendered = m_world->getRenderedChunks();
+        bool stable = loaded == lastLoaded && rendered == lastRendered &&
+                      m_world->isInitialLoadingComplete(m_camera->getPosition()) && !m_world->hasPendingWork();
+        unchanged = stable ? unchanged + 1 : 0;
+        lastLoaded = loaded;
+        lastRendered = rendered;
+        
+        if (timer.elapsedMs() > HEADLESS_SETTLE_TIMEOUT * 1000.0) {
+            std::cout << "Headless: world still changing after " << HEADLESS_SETTLE_TIMEOUT << " s - measuring anyway" << std::endl;
+            break;
+        }
+    }
+    std::cout << "Headless: world settled after " << frames << " frames, " << timer.elapsedMs() / 1000.0 << " s" << std::endl;
+}
+
 void Game::initialize() {
+    // ⏱️ Startup is timed phase by phase, and reported with the first frame
+    Utils::Timer startupPhase;
+    
     // Load world configuration
     if (!g_worldConfig.loadFromFile("world_config.ini")) {
         // Config file not found, using defaults and creating new file
@@ -77,8 +232,12 @@ void Game::initialize() {
         g_worldConfig.saveToFile("world_config.ini");
     }
     
-    // Create window (1280x720 is a good default size)
-    m_window = std::make_unique<Window>(1280, 720, "Minecraft Clone");
+    // Create window (1280x720 is a good default size), or the offscreen target of a headless run
+    if (m_headless.enabled) {
+        m_window = std::make_unique<Window>(m_headless.width, m_headless.height, Window::Headless{});
+    } else {
+        m_window = std::make_unique<Window>(1280, 720, "Minecraft Clone");
+    }
     
     // Set up window resize callback
     int width, height;
@@ -86,8 +245,10 @@ void Game::initialize() {
     glViewport(0, 0, width, height);
     
     // Set up resize callback for automatic scaling
-    glfwSetWindowUserPointer(m_window->getHandle(), this);
-    m_window->setFramebufferSizeCallback(framebufferSizeCallback);
+    if (!m_headless.enabled) {
+        glfwSetWindowUserPointer(m_window->getHandle(), this);
+        m_window->setFramebufferSizeCallback(framebufferSizeCallback);
+    }
     
     // Enable depth testing
     glEnable(GL_DEPTH_TEST);
@@ -100,12 +261,16 @@ void Game::initialize() {
     // Set clear color to black (skybox will provide the sky)
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
     
+    m_startupTimes.window = startupPhase.elapsedMs();
+    startupPhase.reset();
+    
     // Initialize improved systems
     
     // Initialize Block Definition Registry
     BlockDefinitionRegistry::getInstance().initializeDefaultBlocks();
     
-    // Initialize Asset Manager and preload assets
+    // ⚡ Image decoding and shader source reads start on worker threads (given a
+    // second core); the renderers below only upload and compile, waiting on any file not read yet
     AssetManager::getInstance().preloadAssets();
     
     // Initialize legacy block registry for compatibility
@@ -114,26 +279,60 @@ void Game::initialize() {
     // Create camera - position it higher to see more of the world
     m_camera = std::make_unique<Camera>(glm::vec3(0.0f, 20.0f, 0.0f));
     
+    // Create the infinite world
+    m_world = std::make_unique<World>();
+    m_world->setRenderDistance(g_worldConfig.rendering.renderDistance);  // Use config value
+    m_world->setFarRenderDistance(g_worldConfig.rendering.farRenderDistance);
+    m_world->setDeterministicCulling(m_headless.enabled);  // 📊 Same frames, same draw calls
+    
+    // ⚡ Queue the chunks around the spawn now, so the generation threads work
+    // while the renderers load their assets. A single core would run them in
+    // turn instead, so there the first frame's update queues them as before
+    if (std::thread::hardware_concurrency() > 1) {
+        m_world->update(m_camera->getPosition());
+    }
+    m_startupTimes.world = startupPhase.elapsedMs();
+    startupPhase.reset();
+    
     // Create improved chunk renderer that supports leaves
     m_chunkRenderer = std::make_unique<ChunkRenderer>();
     if (!m_chunkRenderer->initialize()) {
         throw std::runtime_error("Failed to initialize chunk renderer");
     }
     
-    // Create the infinite world
-    m_world = std::make_unique<World>();
-    m_world->setRenderDistance(g_worldConfig.rendering.renderDistance);  // Use config value
+    // 🏔️ Horizon terrain past the loaded chunks, sampled from the generator's heightmap
+    if (g_worldConfig.rendering.horizonScale > 0.0f) {
+        m_horizonRenderer = std::make_unique<HorizonRenderer>();
+        float horizonRadius = g_worldConfig.rendering.renderDistance * g_worldConfig.rendering.horizonScale * CHUNK_SIZE;
+        if (!m_horizonRenderer->initialize(m_world->getTerrainGenerator(), horizonRadius)) {
+            throw std::runtime_error("Failed to initialize horizon renderer");
+        }
+        m_horizonRenderer->setInnerRadius(static_cast<float>(m_world->getFarRenderDistance() * CHUNK_SIZE));
+    }
+    
+    // ⚡ Dropped items, one instanced draw per block type
+    m_itemRenderer = std::make_unique<InstancedRenderer>();
+    if (!m_itemRenderer->initialize()) {
+        throw std::runtime_error("Failed to initialize item renderer");
+    }
+    m_items = std::make_unique<ItemStore>();
+    m_playerCollider = std::make_unique<VoxelCollider>();
+    if (g_worldConfig.debug.itemBenchmarkDrops > 0) {
+        spawnBenchmarkItems(g_worldConfig.debug.itemBenchmarkDrops);
+    }
+    
+    // ⚡ 2D UI shares one batch: the elements add their images, then the batch bakes its atlas
+    m_uiBatch = std::make_unique<UIBatch>();
     
-    // Create debug overlay
     // Create loading screen
     m_loadingScreen = std::make_unique<LoadingScreen>();
-    if (!m_loadingScreen->initialize()) {
+    if (!m_loadingScreen->initialize(*m_uiBatch)) {
         throw std::runtime_error("Failed to initialize loading screen");
     }
 
     // Create crosshair
     m_crosshair = std::make_unique<Crosshair>();
-    if (!m_crosshair->initialize()) {
+    if (!m_crosshair->initialize(*m_uiBatch)) {
         throw std::runtime_error("Failed to initialize crosshair");
     }
 
@@ -145,9 +344,13 @@ void Game::initialize() {
 
     // Create hotbar
     m_hotbar = std::make_unique<Hotbar>();
-    if (!m_hotbar->initialize()) {
+    if (!m_hotbar->initialize(*m_uiBatch)) {
         throw std::runtime_error("Failed to initialize hotbar");
     }
+    
+    if (!m_uiBatch->initialize()) {
+        throw std::runtime_error("Failed to initialize UI batch");
+    }
 
     // Create ray visualization for debugging
     m_rayVisualization = std::make_unique<RayVisualization>();
@@ -191,6 +394,12 @@ void Game::initialize() {
         throw std::runtime_error("Failed to initialize sun renderer");
     }
 
+    m_startupTimes.renderers = startupPhase.elapsedMs();
+    
+    if (m_headless.enabled) {
+        return;  // No input - the camera follows its script
+    }
+    
     // Record loading start time
     m_loadingStartTime = glfwGetTime();    // Setup mouse input
     m_window->enableMouseCapture();
@@ -210,16 +419,43 @@ void Game::update(float deltaTime) {
         m_currentFPS = m_frameCount / m_fpsTimer;
         m_frameCount = 0.0f;
         m_fpsTimer = 0.0f;
+        
+        // 📊 Stats go in the title bar - there is no text rendering for an on-screen HUD
+        if (g_worldConfig.debug.showFPS) {
+            std::ostringstream title;
+            title << "Minecraft Clone | " << static_cast<int>(m_currentFPS) << " FPS";
+            if (g_worldConfig.debug.showChunkInfo && m_world) {
+                title << " | chunks: " << m_world->getRenderedChunks() << " drawn, "
+                      << m_world->getVisibilityCulledChunks() << " hidden by caves, "
+                      << m_world->getOcclusionCulledChunks() << " behind terrain";
+            }
+            if (m_itemRenderer && m_items && m_items->size() > 0) {
+                title << " | items: " << m_items->getItemCount() << " in " << m_itemRenderer->getTotalInstances()
+                      << " stacks, " << m_itemRenderer->getDrawCalls() << " draws, "
+                      << m_itemUpdateMs << " ms update, " << m_itemRenderMs << " ms render";
+            }
+            if (m_uiBatch) {
+                title << " | ui: " << m_uiBatch->getQuadCount() << " quads, " << m_uiBatch->getDrawCalls() << " draws";
+            }
+            m_window->setTitle(title.str());
+        }
     }
     
     // Process input
-    processInput(deltaTime);
+    if (!m_headless.enabled) {
+        processInput(deltaTime);
+    }
     
     // Update world based on camera position
     if (m_world && m_camera) {
         m_world->update(m_camera->getPosition());
     }
     
+    // Scroll the horizon clipmap with the camera
+    if (m_horizonRenderer && m_camera) {
+        m_horizonRenderer->update(m_camera->getPosition());
+    }
+    
     // Update clouds
     if (m_cloudRenderer) {
         m_cloudRenderer->update(deltaTime);
@@ -256,10 +492,12 @@ void Game::update(float deltaTime) {
     }
     
     // Update item entities
+    Utils::Timer itemTimer;
     updateItemEntities(deltaTime);
     
     // Check for item collection
     checkItemCollection();
+    m_itemUpdateMs = static_cast<float>(itemTimer.elapsedMs());
 }
 
 void Game::render() {
@@ -272,12 +510,12 @@ void Game::render() {
     
     // Render skybox first (it should be rendered behind everything)
     if (m_skyboxRenderer) {
-        m_skyboxRenderer->render(view, projection, static_cast<float>(glfwGetTime()));
+        m_skyboxRenderer->render(view, projection, m_time);
     }
     
     // Render sun after skybox but before everything else (behind clouds)
     if (m_sunRenderer) {
-        m_sunRenderer->render(view, projection, static_cast<float>(glfwGetTime()), m_camera->getPosition());
+        m_sunRenderer->render(view, projection, m_time, m_camera->getPosition());
     }
     
     // No lighting setup needed - we want flat, bright rendering!
@@ -287,23 +525,27 @@ void Game::render() {
         m_world->render(m_chunkRenderer.get(), view, projection);
     }
     
+    // Far-field terrain fills the gap between the loaded chunks and the sky
+    if (m_horizonRenderer) {
+        m_horizonRenderer->render(view, projection, m_camera->getPosition());
+    }
+    
     // Render clouds (should appear in front of sun)
     if (m_cloudRenderer && g_worldConfig.clouds.enabled) {
-        m_cloudRenderer->render(view, projection, static_cast<float>(glfwGetTime()), m_camera->getPosition());
-    }
-
-    // Render crosshair
-    if (m_crosshair) {
-        int width, height;
-        m_window->getFramebufferSize(width, height);
-        m_crosshair->render(width, height);
+        m_cloudRenderer->render(view, projection, m_time, m_camera->getPosition());
     }
 
-    // Render hotbar
-    if (m_hotbar) {
+    // 2D UI: the crosshair and hotbar queue their quads, then one flush draws them all
+    if (m_uiBatch) {
         int width, height;
         m_window->getFramebufferSize(width, height);
-        m_hotbar->render(width, height);
+        if (m_crosshair) {
+            m_crosshair->render(width, height);
+        }
+        if (m_hotbar) {
+            m_hotbar->render(width);
+        }
+        m_uiBatch->flush(width, height);
     }
 
 
@@ -351,7 +593,8 @@ void Game::processInput(float deltaTime) {
         fKeyPressed = false;
     }
     
-    // Camera movement
+    // Camera movement - the keys say where to go, the blocks say how far
+    glm::vec3 startPosition = m_camera->getPosition();
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
         m_camera->processKeyboard(FORWARD, deltaTime);
     if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
@@ -364,6 +607,9 @@ void Game::processInput(float deltaTime) {
         m_camera->processKeyboard(UP, deltaTime);
     if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS)
         m_camera->processKeyboard(DOWN, deltaTime);
+    glm::vec3 motion = m_camera->getPosition() - startPosition;
+    m_camera->setPosition(startPosition);
+    movePlayer(motion, glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS, deltaTime);
         
         // Hotbar slot selection (1-0 keys)
     if (m_hotbar) {
@@ -503,7 +749,7 @@ void Game::handleBlockBreaking() {
             // Get the correct drop type from block definition registry
             BlockType dropType = BlockDefinitionRegistry::getInstance().getDropType(blockType);
             
-            glm::vec3 itemPosition = glm::vec3(result.blockPos) + 0.5f;
+            glm::vec3 itemPosition = glm::vec3(result.blockPos);  // Blocks are centred on their coordinates
             spawnItemEntity(itemPosition, dropType);  // Use drop type instead of block type
             
             std::cout << "Block broken at (" << result.blockPos.x << ", " << result.blockPos.y << ", " << result.blockPos.z << ")" << std::endl;
@@ -532,79 +778,105 @@ void Game::handleBlockPlacement() {
     */
 }
 
-void Game::updateItemEntities(float deltaTime) {
-    // Update all item entities
-    for (auto& itemEntity : m_itemEntities) {
-        if (itemEntity && !itemEntity->isCollected()) {
-            itemEntity->update(deltaTime);
+void Game::movePlayer(const glm::vec3& motion, bool jump, float deltaTime) {
+    if (!m_world || !m_playerCollider) {
+        m_camera->setPosition(m_camera->getPosition() + motion);
+        return;
+    }
+    
+    glm::vec3 eye = m_camera->getPosition();
+    ChunkView view = m_world->createChunkView();
+    AABB body{eye - glm::vec3(PLAYER_HALF_WIDTH, PLAYER_EYE_HEIGHT, PLAYER_HALF_WIDTH),
+              eye + glm::vec3(PLAYER_HALF_WIDTH, PLAYER_HEIGHT - PLAYER_EYE_HEIGHT, PLAYER_HALF_WIDTH)};
+    
+    glm::vec3 move = motion;
+    float stepHeight = 0.0f;
+    if (m_camera->isFlying()) {
+        m_playerFallSpeed = 0.0f;
+    } else {
+        // Walking: the keys move along the ground, gravity and jumps move up and down
+        float gravity = g_worldConfig.gameplay.gravity;
+        if (jump && m_playerOnGround) {
+            m_playerFallSpeed = std::sqrt(2.0f * gravity * g_worldConfig.gameplay.jumpHeight);
+        }
+        m_playerFallSpeed = std::max(m_playerFallSpeed - gravity * deltaTime, PLAYER_TERMINAL_SPEED);
+        
+        // Don't fall into a chunk that hasn't loaded yet
+        if (!view.getChunkAt(static_cast<int>(std::floor(eye.x + 0.5f)), static_cast<int>(std::floor(eye.z + 0.5f)))) {
+            m_playerFallSpeed = 0.0f;
         }
+        move.y = m_playerFallSpeed * deltaTime;
+        stepHeight = PLAYER_STEP_HEIGHT;
     }
     
-    // Remove collected item entities
-    m_itemEntities.erase(
-        std::remove_if(m_itemEntities.begin(), m_itemEntities.end(),
-            [](const std::unique_ptr<ItemEntity>& item) {
-                return item->isCollected();
-            }),
-        m_itemEntities.end()
-    );
+    CollisionResult result = m_playerCollider->move(view, body, move, stepHeight);
+    if (result.collidedY) {
+        m_playerFallSpeed = 0.0f;
+    }
+    m_playerOnGround = result.onGround;
+    m_camera->setPosition(eye + result.motion);
+}
+
+void Game::updateItemEntities(float deltaTime) {
+    if (!m_world) return;
+    
+    // ⚡ One pass over every item, reading blocks through a cached view of the chunks
+    ChunkView view = m_world->createChunkView();
+    m_items->update(deltaTime, view);
 }
 
 void Game::renderItemEntities() {
-    if (!m_camera) return;
+    if (!m_camera || !m_itemRenderer || !m_items) return;
+    
+    Utils::Timer timer;
     
     // Set up view and projection matrices for 3D rendering
     glm::mat4 view = m_camera->getViewMatrix();
     glm::mat4 projection = m_camera->getProjectionMatrix(m_window->getAspectRatio());
     
-    // Get basic shader for item rendering
-    auto& assetManager = AssetManager::getInstance();
-    auto shader = assetManager.loadShader("assets/shaders/basic.vert", "assets/shaders/basic.frag");
-    
-    if (shader) {
-        shader->use();
-        shader->setMat4("view", view);
-        shader->setMat4("projection", projection);
-        
-        // Render all item entities
-        for (auto& itemEntity : m_itemEntities) {
-            if (itemEntity && !itemEntity->isCollected()) {
-                itemEntity->render();
-            }
-        }
+    // ⚡ Gather every item into its block type's batch, stream the batches, one draw each
+    m_itemRenderer->clear();
+    for (size_t i = 0; i < m_items->size(); ++i) {
+        m_itemRenderer->addInstance(m_items->getType(i), m_items->getModelMatrix(i));
     }
+    m_itemRenderer->updateInstanceData();
+    m_itemRenderer->renderAll(view, projection);
+    
+    m_itemRenderMs = static_cast<float>(timer.elapsedMs());
 }
 
 void Game::spawnItemEntity(const glm::vec3& position, BlockType blockType) {
-    std::cout << "Spawning item entity at (" << position.x << ", " << position.y << ", " << position.z << ") for block type " << static_cast<int>(blockType) << std::endl;
-    auto itemEntity = std::make_unique<ItemEntity>(position, blockType, m_world.get());
-    m_itemEntities.push_back(std::move(itemEntity));
-    std::cout << "Item entity spawned! Total items: " << m_itemEntities.size() << std::endl;
+    m_items->spawn(position, blockType);
+}
+
+void Game::spawnBenchmarkItems(int count) {
+    // 📊 A square of drops on the terrain around spawn, cycling through the block types
+    const BlockType types[] = {BlockType::GRASS, BlockType::DIRT, BlockType::STONE, BlockType::SAND,
+                               BlockType::OAK_LOG, BlockType::LEAVES, BlockType::GRAVEL};
+    const int typeCount = static_cast<int>(sizeof(types) / sizeof(types[0]));
+    int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+    glm::vec3 center = m_camera->getPosition();
+    
+    m_items->reserve(m_items->size() + count);
+    for (int i = 0; i < count; ++i) {
+        int x = static_cast<int>(center.x) + i % side - side / 2;
+        int z = static_cast<int>(center.z) + i / side - side / 2;
+        float y = m_world->getTerrainGenerator()->getTerrainHeight(x, z) + 1.0f;
+        m_items->spawn(glm::vec3(x, y, z), types[i % typeCount]);
+    }
+    std::cout << "Item benchmark: spawned " << count << " drops" << std::endl;
 }
 
 void Game::checkItemCollection() {
-    if (!m_camera || !m_hotbar) return;
-    
-    glm::vec3 playerPosition = m_camera->getPosition();
-    
-    for (auto& itemEntity : m_itemEntities) {
-        if (itemEntity && itemEntity->canBeCollected() && !itemEntity->isCollected()) {
-            float distance = glm::distance(playerPosition, itemEntity->getPosition());
-            
-            if (distance <= itemEntity->getCollectionRadius()) {
-                // Add item to hotbar inventory using new stacking system
-                BlockType blockType = itemEntity->getBlockType();
-                int remainingItems = m_hotbar->addItem(blockType, 1);
-                
-                if (remainingItems == 0) {
-                    // Item was successfully added
-                    itemEntity->setCollected();
-                    std::cout << "Collected " << static_cast<int>(blockType) << " and added to hotbar!" << std::endl;
-                } else {
-                    // Item couldn't be added (hotbar full)
-                    std::cout << "Hotbar is full! Cannot collect " << static_cast<int>(blockType) << std::endl;
-                }
-            }
+    if (!m_camera || !m_hotbar || !m_items) return;
+    
+    // Only the spatial hash cells around the player are looked at, not every item
+    m_items->collect(m_camera->getPosition(), [this](BlockType blockType, int count) {
+        // Add items to hotbar inventory using new stacking system
+        int remainingItems = m_hotbar->addItem(blockType, count);
+        if (remainingItems == count) {
+            std::cout << "Hotbar is full! Cannot collect " << static_cast<int>(blockType) << std::endl;
         }
-    }
+        return count - remainingItems;
+    });
 }
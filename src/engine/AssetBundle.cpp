@@ -0,0 +1,222 @@
+#include "engine/AssetBundle.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+const uint8_t* PackedTexture::level(int n, int& levelWidth, int& levelHeight) const {
+    const uint8_t* data = pixels;
+    levelWidth = width;
+    levelHeight = height;
+    for (int i = 0; i < n; i++) {
+        data += static_cast<size_t>(levelWidth) * levelHeight * 4;
+        levelWidth = std::max(1, levelWidth / 2);
+        levelHeight = std::max(1, levelHeight / 2);
+    }
+    return data;
+}
+
+AssetBundle::AssetBundle() : m_fd(-1), m_mapped(nullptr), m_mappedSize(0) {
+}
+
+AssetBundle::~AssetBundle() {
+    close();
+}
+
+void AssetBundle::close() {
+    m_textures.clear();
+    m_shaders.clear();
+    if (m_mapped) {
+        munmap(const_cast<uint8_t*>(m_mapped), m_mappedSize);
+        m_mapped = nullptr;
+        m_mappedSize = 0;
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool AssetBundle::open(const std::string& path) {
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDONLY);
+    if (m_fd < 0) {
+        return false;  // No bundle - everything comes from loose files
+    }
+    struct stat st;
+    if (fstat(m_fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        close();
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "AssetBundle: mmap failed for " << path << ": " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    m_mapped = static_cast<const uint8_t*>(mapped);
+    m_mappedSize = st.st_size;
+
+    Header header;
+    std::memcpy(&header, m_mapped, sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION ||
+        sizeof(Header) + static_cast<size_t>(header.entryCount) * sizeof(Entry) > m_mappedSize) {
+        std::cerr << "AssetBundle: " << path << " is not a bundle this build can read" << std::endl;
+        close();
+        return false;
+    }
+
+    // Index the entries; anything pointing outside the file is ignored
+    const uint8_t* table = m_mapped + sizeof(Header);
+    for (uint32_t i = 0; i < header.entryCount; i++) {
+        Entry entry;
+        std::memcpy(&entry, table + i * sizeof(Entry), sizeof(entry));
+        if (entry.pathOffset + static_cast<size_t>(entry.pathLength) > m_mappedSize ||
+            entry.dataOffset > m_mappedSize || entry.dataSize > m_mappedSize - entry.dataOffset) {
+            continue;
+        }
+        std::string name(reinterpret_cast<const char*>(m_mapped + entry.pathOffset), entry.pathLength);
+        if (entry.type == TYPE_TEXTURE) {
+            if (entry.dataSize != mipChainSize(entry.width, entry.height, entry.levels)) continue;
+            TextureEntry texture;
+            texture.texture.width = static_cast<int>(entry.width);
+            texture.texture.height = static_cast<int>(entry.height);
+            texture.texture.levels = static_cast<int>(entry.levels);
+            texture.texture.pixels = m_mapped + entry.dataOffset;
+            texture.sourceTime = entry.sourceTime;
+            m_textures[name] = texture;
+        } else if (entry.type == TYPE_SHADER) {
+            m_shaders[name] = ShaderSource{reinterpret_cast<const char*>(m_mapped + entry.dataOffset),
+                                           static_cast<size_t>(entry.dataSize), entry.sourceTime};
+        }
+    }
+    return true;
+}
+
+bool AssetBundle::isFresh(const std::string& path, int64_t recordedTime) const {
+    // A loose file that is missing doesn't make the bundled copy stale
+    int64_t time = sourceTime(path);
+    return time < 0 || time == recordedTime;
+}
+
+const PackedTexture* AssetBundle::findTexture(const std::string& path) const {
+    auto it = m_textures.find(path);
+    if (it == m_textures.end() || !isFresh(path, it->second.sourceTime)) {
+        return nullptr;
+    }
+    return &it->second.texture;
+}
+
+bool AssetBundle::findShader(const std::string& path, std::string& source) const {
+    auto it = m_shaders.find(path);
+    if (it == m_shaders.end() || !isFresh(path, it->second.sourceTime)) {
+        return false;
+    }
+    source.assign(it->second.text, it->second.length);
+    return true;
+}
+
+int64_t AssetBundle::sourceTime(const std::string& path) {
+    // Whole seconds: copies of the assets, like the build directory's, keep the time only that precisely
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) {
+        return -1;
+    }
+    return static_cast<int64_t>(st.st_mtime);
+}
+
+size_t AssetBundle::mipChainSize(int width, int height, int levels) {
+    size_t size = 0;
+    for (int i = 0; i < levels; i++) {
+        size += static_cast<size_t>(width) * height * 4;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    return size;
+}
+
+void AssetBundleWriter::addTexture(const std::string& path, int width, int height, int levels,
+                                   std::vector<uint8_t> pixels, int64_t sourceTime) {
+    Item item;
+    item.path = path;
+    item.type = AssetBundle::TYPE_TEXTURE;
+    item.width = width;
+    item.height = height;
+    item.levels = levels;
+    item.data = std::move(pixels);
+    item.sourceTime = sourceTime;
+    m_items.push_back(std::move(item));
+}
+
+void AssetBundleWriter::addShader(const std::string& path, std::string source, int64_t sourceTime) {
+    Item item;
+    item.path = path;
+    item.type = AssetBundle::TYPE_SHADER;
+    item.data.assign(source.begin(), source.end());
+    item.sourceTime = sourceTime;
+    m_items.push_back(std::move(item));
+}
+
+bool AssetBundleWriter::write(const std::string& path) const {
+    // Lay the file out: header, entries, then the path strings, then the aligned data
+    std::vector<AssetBundle::Entry> entries(m_items.size());
+    size_t offset = sizeof(AssetBundle::Header) + entries.size() * sizeof(AssetBundle::Entry);
+    for (size_t i = 0; i < m_items.size(); i++) {
+        entries[i].pathOffset = static_cast<uint32_t>(offset);
+        entries[i].pathLength = static_cast<uint32_t>(m_items[i].path.size());
+        offset += m_items[i].path.size();
+    }
+    for (size_t i = 0; i < m_items.size(); i++) {
+        const Item& item = m_items[i];
+        offset = (offset + AssetBundle::DATA_ALIGNMENT - 1) / AssetBundle::DATA_ALIGNMENT * AssetBundle::DATA_ALIGNMENT;
+        entries[i].type = item.type;
+        entries[i].width = static_cast<uint32_t>(item.width);
+        entries[i].height = static_cast<uint32_t>(item.height);
+        entries[i].levels = static_cast<uint32_t>(item.levels);
+        entries[i].dataOffset = offset;
+        entries[i].dataSize = item.data.size();
+        entries[i].sourceTime = item.sourceTime;
+        offset += item.data.size();
+    }
+
+    // Written under a temporary name, so a running game never maps half a bundle
+    const std::string tempPath = path + ".tmp";
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "AssetBundle: cannot write " << tempPath << std::endl;
+        return false;
+    }
+    AssetBundle::Header header{AssetBundle::MAGIC, AssetBundle::VERSION, static_cast<uint32_t>(entries.size()), 0};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetBundle::Entry));
+    for (const Item& item : m_items) {
+        file.write(item.path.data(), item.path.size());
+    }
+    for (size_t i = 0; i < m_items.size(); i++) {
+        static const char zeros[AssetBundle::DATA_ALIGNMENT] = {};
+        size_t position = static_cast<size_t>(file.tellp());
+        file.write(zeros, entries[i].dataOffset - position);
+        file.write(reinterpret_cast<const char*>(m_items[i].data.data()), m_items[i].data.size());
+    }
+    file.close();
+    if (!file) {
+        std::cerr << "AssetBundle: writing " << tempPath << " failed" << std::endl;
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::cerr << "AssetBundle: cannot replace " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -1,15 +1,45 @@
 #include "engine/AssetManager.h"
+#include "engine/AssetBundle.h"
 #include "engine/graphics/Texture.h"
 #include "engine/graphics/Shader.h"
+#include "utils/ModernCpp.h"
+#include <algorithm>
 #include <iostream>
 #include <filesystem>
+#include <thread>
 #include <vector>
 
+namespace {
+
+std::shared_ptr<const ImageData> decodeImage(const std::string& path) {
+    auto image = std::make_shared<ImageData>();
+    return Texture::decodeFile(path, *image) ? image : nullptr;
+}
+
+// Level 0 of a bundled texture, turned back to top-row-first rows
+std::shared_ptr<const ImageData> unpackImage(const PackedTexture& packed) {
+    auto image = std::make_shared<ImageData>();
+    image->width = packed.width;
+    image->height = packed.height;
+    image->channels = 4;
+    image->pixels.resize(static_cast<size_t>(packed.width) * packed.height * 4);
+    const size_t rowBytes = static_cast<size_t>(packed.width) * 4;
+    for (int row = 0; row < packed.height; row++) {
+        std::copy_n(packed.pixels + row * rowBytes, rowBytes, &image->pixels[(packed.height - 1 - row) * rowBytes]);
+    }
+    return image;
+}
+
+} // namespace
+
 AssetManager& AssetManager::getInstance() {
     static AssetManager instance;
     return instance;
 }
 
+AssetManager::AssetManager() = default;
+AssetManager::~AssetManager() = default;
+
 std::shared_ptr<Texture> AssetManager::loadTexture(const std::string& path) {
     // Check if already loaded
     auto it = m_textures.find(path);
@@ -17,9 +47,17 @@ std::shared_ptr<Texture> AssetManager::loadTexture(const std::string& path) {
         return it->second;
     }
     
-    // Load new texture
+    // Load new texture - straight from the bundle if it has it, otherwise only the
+    // upload happens here if the image was prefetched
     auto texture = std::make_shared<Texture>();
-    if (texture->loadFromFile(path)) {
+    const PackedTexture* packed = m_bundle ? m_bundle->findTexture(path) : nullptr;
+    if (packed && texture->loadFromPacked(*packed)) {
+        m_textures[path] = texture;
+        std::cout << "AssetManager: Loaded texture " << path << " from bundle" << std::endl;
+        return texture;
+    }
+    auto image = loadImage(path);
+    if (image && texture->loadFromImage(*image)) {
         m_textures[path] = texture;
         std::cout << "AssetManager: Loaded texture " << path << std::endl;
         return texture;
@@ -38,11 +76,25 @@ std::shared_ptr<Shader> AssetManager::loadShader(const std::string& vertPath, co
         return it->second;
     }
     
-    // Load new shader
+    // Load new shader - only the compile happens here if the sources were prefetched,
+    // and not even that if the program binary is cached
+    Utils::Timer setup;
+    std::string vertexSource = loadShaderSource(vertPath);
+    std::string fragmentSource = loadShaderSource(fragPath);
     auto shader = std::make_shared<Shader>();
-    if (shader->loadFromFiles(vertPath, fragPath)) {
+    bool cached = false;
+    bool loaded = false;
+    if (!vertexSource.empty() && !fragmentSource.empty()) {
+        cached = m_programCache.load(*shader, vertexSource, fragmentSource);
+        loaded = cached || shader->loadFromString(vertexSource, fragmentSource);
+        if (loaded && !cached) {
+            m_programCache.store(*shader, vertexSource, fragmentSource);
+        }
+    }
+    m_shaderSetupMs += setup.elapsedMs();
+    if (loaded) {
         m_shaders[key] = shader;
-        std::cout << "AssetManager: Loaded shader " << key << std::endl;
+        std::cout << "AssetManager: Loaded shader " << key << (cached ? " from binary cache" : "") << std::endl;
         return shader;
     } else {
         std::cout << "AssetManager: Failed to load shader " << key << std::endl;
@@ -60,33 +112,111 @@ std::shared_ptr<Shader> AssetManager::getShader(const std::string& name) {
     return (it != m_shaders.end()) ? it->second : nullptr;
 }
 
+std::shared_ptr<const ImageData> AssetManager::loadImage(const std::string& path) {
+    auto it = m_images.find(path);
+    if (it == m_images.end()) {
+        // Not prefetched - copy it out of the bundle or decode it on this thread, and keep it for the next caller
+        std::promise<std::shared_ptr<const ImageData>> decoded;
+        const PackedTexture* packed = m_bundle ? m_bundle->findTexture(path) : nullptr;
+        decoded.set_value(packed ? unpackImage(*packed) : decodeImage(path));
+        it = m_images.emplace(path, decoded.get_future().share()).first;
+    }
+    return it->second.get();
+}
+
+std::string AssetManager::loadShaderSource(const std::string& path) {
+    auto it = m_shaderSources.find(path);
+    if (it == m_shaderSources.end()) {
+        std::string source;
+        if (m_bundle && m_bundle->findShader(path, source)) {
+            return source;
+        }
+        return Shader::loadShaderFile(path);
+    }
+    // Each source feeds one program, so it needn't stay around
+    std::string source = it->second.get();
+    m_shaderSources.erase(it);
+    return source;
+}
+
+void AssetManager::prefetch(const std::vector<std::string>& imagePaths, const std::vector<std::string>& shaderPaths) {
+    // One task per file: they are few, and a decode is far longer than starting a thread.
+    // Files the bundle holds need no worker - reading them is a copy out of the mapping
+    std::string bundledSource;
+    for (const auto& path : imagePaths) {
+        if (m_images.count(path) || m_textures.count(path)) continue;
+        if (m_bundle && m_bundle->findTexture(path)) continue;
+        m_images.emplace(path, std::async(std::launch::async, decodeImage, path).share());
+    }
+    for (const auto& path : shaderPaths) {
+        if (m_shaderSources.count(path)) continue;
+        if (m_bundle && m_bundle->findShader(path, bundledSource)) continue;
+        m_shaderSources.emplace(path, std::async(std::launch::async, Shader::loadShaderFile, path).share());
+    }
+}
+
 void AssetManager::preloadAssets() {
-    std::cout << "AssetManager: Preloading common assets..." << std::endl;
+    if (!m_bundle) {
+        m_bundle = std::make_unique<AssetBundle>();
+        if (m_bundle->open(AssetBundle::DEFAULT_PATH)) {
+            std::cout << "AssetManager: Mapped " << AssetBundle::DEFAULT_PATH << " ("
+                      << m_bundle->getTextureCount() << " textures, " << m_bundle->getShaderCount()
+                      << " shaders)" << std::endl;
+        } else {
+            m_bundle.reset();
+            std::cout << "AssetManager: No asset bundle - loading loose files" << std::endl;
+        }
+    }
     
-    // Preload common textures
-    std::vector<std::string> commonTextures = {
+    // ⚡ With one core the workers only take time from the renderers waiting on them -
+    // each file is then read when it is first loaded, in order
+    if (std::thread::hardware_concurrency() <= 1) {
+        std::cout << "AssetManager: Single core - loading startup assets as they are needed" << std::endl;
+        return;
+    }
+    
+    std::cout << "AssetManager: Prefetching startup assets..." << std::endl;
+    
+    // Block, sky and UI textures
+    std::vector<std::string> images = {
         "assets/textures/grass.png",
+        "assets/textures/stone.png",
+        "assets/textures/sand.png",
+        "assets/textures/gravel.png",
+        "assets/textures/water.png",
         "assets/textures/water.webp",
         "assets/textures/oak.png",
-        "assets/textures/oakleave.png"
+        "assets/textures/oakleave.png",
+        "assets/textures/sun.png",
+        "assets/textures/hotbar.png",
+        "assets/textures/selecthotbar.png"
     };
+    images.erase(std::remove_if(images.begin(), images.end(),
+                                [](const std::string& path) { return !std::filesystem::exists(path); }),
+                 images.end());
     
-    for (const auto& path : commonTextures) {
-        if (std::filesystem::exists(path)) {
-            loadTexture(path);
+    // Every shader source - each renderer compiles its own pair
+    std::vector<std::string> shaders;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator("assets/shaders", error)) {
+        std::string extension = entry.path().extension().string();
+        if (extension == ".vert" || extension == ".frag") {
+            shaders.push_back(entry.path().generic_string());
         }
     }
     
-    // Preload common shaders
-    loadShader("assets/shaders/basic.vert", "assets/shaders/basic.frag");
-    
-    std::cout << "AssetManager: Preloaded " << m_textures.size() 
-              << " textures and " << m_shaders.size() << " shaders" << std::endl;
+    size_t pendingImages = m_images.size();
+    size_t pendingShaders = m_shaderSources.size();
+    prefetch(images, shaders);
+    std::cout << "AssetManager: Reading " << m_images.size() - pendingImages << " images and "
+              << m_shaderSources.size() - pendingShaders << " shader sources in the background" << std::endl;
 }
 
 void AssetManager::clearCache() {
     m_textures.clear();
     m_shaders.clear();
+    m_images.clear();          // Waits for any decode still running
+    m_shaderSources.clear();
     std::cout << "AssetManager: Cleared asset cache" << std::endl;
 }
 
@@ -0,0 +1,213 @@
+#include "engine/graphics/BatchFrustumCuller.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define FRUSTUM_AVX 1
+constexpr int LANES = 8;
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FRUSTUM_SSE 1
+constexpr int LANES = 4;
+#else
+constexpr int LANES = 1;
+#endif
+
+namespace {
+
+enum class Side { OUTSIDE, INSIDE, INTERSECTING };
+
+// Same test as Frustum::isChunkVisible, plus whether the box is wholly inside
+Side classify(const Frustum& frustum, const glm::vec3& min, const glm::vec3& max) {
+    Side side = Side::INSIDE;
+    for (const glm::vec4& plane : frustum.planes) {
+        glm::vec3 positive(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y,
+                           plane.z >= 0.0f ? max.z : min.z);
+        glm::vec3 negative(plane.x >= 0.0f ? min.x : max.x, plane.y >= 0.0f ? min.y : max.y,
+                           plane.z >= 0.0f ? min.z : max.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return Side::OUTSIDE;
+        }
+        if (glm::dot(glm::vec3(plane), negative) + plane.w < 0.0f) {
+            side = Side::INTERSECTING;
+        }
+    }
+    return side;
+}
+
+} // namespace
+
+BatchFrustumCuller::BatchFrustumCuller(float cellSize)
+    : m_cellSize(cellSize)
+    , m_cellsRejected(0)
+    , m_cellsAccepted(0) {
+}
+
+void BatchFrustumCuller::clear() {
+    m_addedMin.clear();
+    m_addedMax.clear();
+    m_ids.clear();
+    m_cells.clear();
+}
+
+void BatchFrustumCuller::add(const glm::vec3& min, const glm::vec3& max) {
+    m_addedMin.push_back(min);
+    m_addedMax.push_back(max);
+}
+
+void BatchFrustumCuller::build() {
+    const int count = static_cast<int>(m_addedMin.size());
+
+    // ⚡ Counting sort into cells by box centre - linear, no comparisons
+    std::vector<int> order(count);
+    m_cells.clear();
+    if (m_cellSize > 0.0f && count > 0) {
+        std::vector<glm::ivec2> cellOf(count);
+        glm::ivec2 low(std::numeric_limits<int>::max()), high(std::numeric_limits<int>::min());
+        for (int i = 0; i < count; ++i) {
+            glm::vec3 center = (m_addedMin[i] + m_addedMax[i]) * 0.5f;
+            cellOf[i] = glm::ivec2(static_cast<int>(std::floor(center.x / m_cellSize)),
+                                   static_cast<int>(std::floor(center.z / m_cellSize)));
+            low = glm::ivec2(std::min(low.x, cellOf[i].x), std::min(low.y, cellOf[i].y));
+            high = glm::ivec2(std::max(high.x, cellOf[i].x), std::max(high.y, cellOf[i].y));
+        }
+
+        int width = high.x - low.x + 1;
+        std::vector<int> start(static_cast<size_t>(width) * (high.y - low.y + 1) + 1, 0);
+        auto cellIndex = [&](int i) { return (cellOf[i].x - low.x) + (cellOf[i].y - low.y) * width; };
+        for (int i = 0; i < count; ++i) {
+            start[cellIndex(i) + 1]++;
+        }
+        for (size_t cell = 1; cell < start.size(); ++cell) {
+            start[cell] += start[cell - 1];
+        }
+        for (size_t cell = 0; cell + 1 < start.size(); ++cell) {
+            if (start[cell] != start[cell + 1]) {
+                m_cells.push_back({glm::vec3(0.0f), glm::vec3(0.0f), start[cell], start[cell + 1]});
+            }
+        }
+        std::vector<int> next(start.begin(), start.end() - 1);
+        for (int i = 0; i < count; ++i) {
+            order[next[cellIndex(i)]++] = i;
+        }
+    } else {
+        for (int i = 0; i < count; ++i) {
+            order[i] = i;
+        }
+        if (count > 0) {
+            m_cells.push_back({glm::vec3(0.0f), glm::vec3(0.0f), 0, count});
+        }
+    }
+
+    // Lay the boxes out in cell order, padded so whole SIMD blocks can be loaded
+    int padded = count + LANES;
+    for (std::vector<float>* lane : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ}) {
+        lane->assign(padded, 0.0f);
+    }
+    m_ids.resize(count);
+    for (int slot = 0; slot < count; ++slot) {
+        int i = order[slot];
+        m_ids[slot] = i;
+        m_minX[slot] = m_addedMin[i].x; m_minY[slot] = m_addedMin[i].y; m_minZ[slot] = m_addedMin[i].z;
+        m_maxX[slot] = m_addedMax[i].x; m_maxY[slot] = m_addedMax[i].y; m_maxZ[slot] = m_addedMax[i].z;
+    }
+
+    // Each cell's box is the union of its boxes, not the grid square
+    for (Cell& cell : m_cells) {
+        cell.min = glm::vec3(m_minX[cell.begin], m_minY[cell.begin], m_minZ[cell.begin]);
+        cell.max = glm::vec3(m_maxX[cell.begin], m_maxY[cell.begin], m_maxZ[cell.begin]);
+        for (int slot = cell.begin + 1; slot < cell.end; ++slot) {
+            cell.min = glm::min(cell.min, glm::vec3(m_minX[slot], m_minY[slot], m_minZ[slot]));
+            cell.max = glm::max(cell.max, glm::vec3(m_maxX[slot], m_maxY[slot], m_maxZ[slot]));
+        }
+    }
+
+    m_addedMin.clear();
+    m_addedMax.clear();
+}
+
+void BatchFrustumCuller::cull(const Frustum& frustum, std::vector<int>& visible) const {
+    visible.clear();
+    m_cellsRejected = 0;
+    m_cellsAccepted = 0;
+
+    for (const Cell& cell : m_cells) {
+        if (m_cellSize <= 0.0f) {
+            testRange(frustum, cell.begin, cell.end, visible);
+            continue;
+        }
+        switch (classify(frustum, cell.min, cell.max)) {
+            case Side::OUTSIDE:
+                m_cellsRejected++;
+                break;
+            case Side::INSIDE:
+                m_cellsAccepted++;
+                visible.insert(visible.end(), m_ids.begin() + cell.begin, m_ids.begin() + cell.end);
+                break;
+            case Side::INTERSECTING:
+                testRange(frustum, cell.begin, cell.end, visible);
+                break;
+        }
+    }
+}
+
+void BatchFrustumCuller::testRange(const Frustum& frustum, int begin, int end, std::vector<int>& visible) const {
+    // The positive vertex of each plane picks min or max per axis by the normal's sign
+    const float* positive[6][3];
+    for (int p = 0; p < 6; ++p) {
+        const glm::vec4& plane = frustum.planes[p];
+        positive[p][0] = plane.x >= 0.0f ? m_maxX.data() : m_minX.data();
+        positive[p][1] = plane.y >= 0.0f ? m_maxY.data() : m_minY.data();
+        positive[p][2] = plane.z >= 0.0f ? m_maxZ.data() : m_minZ.data();
+    }
+
+#if defined(FRUSTUM_AVX)
+    for (int slot = begin; slot < end; slot += LANES) {
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; ++p) {
+            const glm::vec4& plane = frustum.planes[p];
+            __m256 distance = _mm256_add_ps(
+                _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.x), _mm256_loadu_ps(positive[p][0] + slot)),
+                              _mm256_mul_ps(_mm256_set1_ps(plane.y), _mm256_loadu_ps(positive[p][1] + slot))),
+                _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.z), _mm256_loadu_ps(positive[p][2] + slot)),
+                              _mm256_set1_ps(plane.w)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        int mask = _mm256_movemask_ps(inside);
+        if (end - slot < LANES) mask &= (1 << (end - slot)) - 1;
+        for (int lane = 0; mask; ++lane, mask >>= 1) {
+            if (mask & 1) visible.push_back(m_ids[slot + lane]);
+        }
+    }
+#elif defined(FRUSTUM_SSE)
+    for (int slot = begin; slot < end; slot += LANES) {
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; ++p) {
+            const glm::vec4& plane = frustum.planes[p];
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), _mm_loadu_ps(positive[p][0] + slot)),
+                           _mm_mul_ps(_mm_set1_ps(plane.y), _mm_loadu_ps(positive[p][1] + slot))),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), _mm_loadu_ps(positive[p][2] + slot)),
+                           _mm_set1_ps(plane.w)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+        }
+        int mask = _mm_movemask_ps(inside);
+        if (end - slot < LANES) mask &= (1 << (end - slot)) - 1;
+        for (int lane = 0; mask; ++lane, mask >>= 1) {
+            if (mask & 1) visible.push_back(m_ids[slot + lane]);
+        }
+    }
+#else
+    for (int slot = begin; slot < end; ++slot) {
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p) {
+            const glm::vec4& plane = frustum.planes[p];
+            inside = plane.x * positive[p][0][slot] + plane.y * positive[p][1][slot] +
+                     plane.z * positive[p][2][slot] + plane.w >= 0.0f;
+        }
+        if (inside) visible.push_back(m_ids[slot]);
+    }
+#endif
+}
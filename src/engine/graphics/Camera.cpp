@@ -37,12 +37,15 @@ void Camera::processKeyboard(Camera_Movement direction, float deltaTime) {
         velocity = m_movementSpeed * deltaTime;
     }
     
+    // Walking follows the ground - looking up or down changes neither the direction nor the speed
+    glm::vec3 forward = m_isFlying ? m_front : glm::normalize(glm::vec3(m_front.x, 0.0f, m_front.z));
+    
     switch (direction) {
         case FORWARD:
-            m_position += m_front * velocity;
+            m_position += forward * velocity;
             break;
         case BACKWARD:
-            m_position -= m_front * velocity;
+            m_position -= forward * velocity;
             break;
         case LEFT:
             m_position -= m_right * velocity;
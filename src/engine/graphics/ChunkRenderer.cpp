@@ -5,6 +5,7 @@
 #include "world/Chunk.h"
 #include "world/BlockDefinition.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/Mesh.h"
 #include <iostream>
 
 ChunkRenderer::ChunkRenderer() 
@@ -75,9 +76,7 @@ bool ChunkRenderer::initialize() {
     return true;
 }
 
-void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const glm::mat4& projection) {
-    if (!m_shader) return;
-    
+void ChunkRenderer::useShader(const glm::mat4& view, const glm::mat4& projection) {
     // Activate shader
     m_shader->use();
     
@@ -91,6 +90,13 @@ void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const
     m_shader->setVec3("lightPos", m_lightPos);
     m_shader->setVec3("lightColor", m_lightColor);
     m_shader->setVec3("viewPos", glm::vec3(0.0f, 10.0f, 0.0f));
+}
+
+void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const glm::mat4& projection,
+                                unsigned int faceMask) {
+    if (!m_shader) return;
+    
+    useShader(view, projection);
     
     // Get all registered block types from BlockDefinitionRegistry
     auto& registry = BlockDefinitionRegistry::getInstance();
@@ -100,7 +106,7 @@ void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const
     if (m_grassTexture) {
         m_grassTexture->bind(0);
         m_shader->setInt("texture1", 0);
-        const_cast<Chunk&>(chunk).render(view, projection);
+        const_cast<Chunk&>(chunk).render(view, projection, faceMask);
     }
     
     // Render solid blocks that need separate meshes
@@ -108,7 +114,7 @@ void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const
         const auto& definition = registry.getDefinition(blockType);
         
         if (definition.needsSeparateMesh && !definition.transparent) {
-            renderBlockType(chunk, blockType, view, projection);
+            renderBlockType(chunk, blockType, view, projection, faceMask);
         }
     }
     
@@ -117,13 +123,13 @@ void ChunkRenderer::renderChunk(const Chunk& chunk, const glm::mat4& view, const
         const auto& definition = registry.getDefinition(blockType);
         
         if (definition.needsSeparateMesh && definition.transparent) {
-            renderBlockType(chunk, blockType, view, projection);
+            renderBlockType(chunk, blockType, view, projection, faceMask);
         }
     }
 }
 
 void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType, 
-                                          const glm::mat4& view, const glm::mat4& projection) {
+                                          const glm::mat4& view, const glm::mat4& projection, unsigned int faceMask) {
     const auto& definition = BlockDefinitionRegistry::getInstance().getDefinition(blockType);
     
     // Select appropriate texture and rendering method
@@ -135,7 +141,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawWaterMesh();
+                chunk.drawWaterMesh(faceMask);
             }
             break;
             
@@ -144,7 +150,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawOakMesh();
+                chunk.drawOakMesh(faceMask);
             }
             break;
             
@@ -153,7 +159,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawLeavesMesh();
+                chunk.drawLeavesMesh(faceMask);
             }
             break;
             
@@ -162,7 +168,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawStoneMesh();
+                chunk.drawStoneMesh(faceMask);
             }
             break;
             
@@ -171,7 +177,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawGravelMesh();
+                chunk.drawGravelMesh(faceMask);
             }
             break;
             
@@ -180,7 +186,7 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
             if (texture) {
                 texture->bind(0);
                 m_shader->setInt("texture1", 0);
-                chunk.drawSandMesh();
+                chunk.drawSandMesh(faceMask);
             }
             break;
             
@@ -190,6 +196,41 @@ void ChunkRenderer::renderBlockType(const Chunk& chunk, BlockType blockType,
     }
 }
 
+void ChunkRenderer::renderLODChunk(const ChunkLODManager::LODMeshes& meshes, const glm::mat4& view,
+                                   const glm::mat4& projection, unsigned int faceMask) {
+    if (!m_shader) return;
+    
+    useShader(view, projection);
+    
+    // Same order as renderChunk: solid layers first, transparent ones last
+    static const int drawOrder[ChunkMeshData::LAYER_COUNT] = {
+        ChunkMeshData::SOLID, ChunkMeshData::OAK, ChunkMeshData::STONE, ChunkMeshData::GRAVEL,
+        ChunkMeshData::SAND, ChunkMeshData::WATER, ChunkMeshData::LEAVES
+    };
+    
+    for (int layer : drawOrder) {
+        std::shared_ptr<Texture> texture = getLayerTexture(layer);
+        if (meshes.layers[layer] && texture) {
+            texture->bind(0);
+            m_shader->setInt("texture1", 0);
+            meshes.layers[layer]->renderGroups(faceMask);
+        }
+    }
+}
+
+std::shared_ptr<Texture> ChunkRenderer::getLayerTexture(int layer) const {
+    switch (layer) {
+        case ChunkMeshData::SOLID:  return m_grassTexture;
+        case ChunkMeshData::WATER:  return m_waterTexture;
+        case ChunkMeshData::OAK:    return m_oakTexture;
+        case ChunkMeshData::LEAVES: return m_oakLeavesTexture;
+        case ChunkMeshData::STONE:  return m_stoneTexture;
+        case ChunkMeshData::GRAVEL: return m_gravelTexture;
+        case ChunkMeshData::SAND:   return m_sandTexture;
+        default:                    return nullptr;
+    }
+}
+
 TextureCoords ChunkRenderer::getTextureCoords(BlockType blockType) const {
     auto it = m_textureCoords.find(blockType);
     if (it != m_textureCoords.end()) {
@@ -1,18 +1,123 @@
 #include "engine/graphics/CloudRenderer.h"
 #include "engine/graphics/Shader.h"
-#include "engine/graphics/Mesh.h"
 #include "engine/AssetManager.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include "world/WorldConfig.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <vector>
-#include <cmath>
-#include <random>
-#include <functional>
 
 // External reference to global world configuration
 extern WorldConfig g_worldConfig;
 
+namespace {
+
+// Unit cube with its base on the origin: position, normal
+const float CLOUD_CUBE_VERTICES[] = {
+    // Top face
+    0.0f, 1.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+    0.0f, 1.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+    1.0f, 1.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+    1.0f, 1.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+    // Bottom face
+    0.0f, 0.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+    1.0f, 0.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+    1.0f, 0.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+    0.0f, 0.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+    // Front face
+    0.0f, 0.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    1.0f, 0.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    1.0f, 1.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    0.0f, 1.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    // Back face
+    1.0f, 0.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    0.0f, 0.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    0.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    1.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    // Left face
+    0.0f, 0.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    0.0f, 0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    0.0f, 1.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    // Right face
+    1.0f, 0.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+    1.0f, 0.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+    1.0f, 1.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+    1.0f, 1.0f, 1.0f,   1.0f,  0.0f,  0.0f
+};
+
+const unsigned int CLOUD_CUBE_INDICES[] = {
+     0,  1,  2,   2,  3,  0,   // Top
+     4,  5,  6,   6,  7,  4,   // Bottom
+     8,  9, 10,  10, 11,  8,   // Front
+    12, 13, 14,  14, 15, 12,   // Back
+    16, 17, 18,  18, 19, 16,   // Left
+    20, 21, 22,  22, 23, 20    // Right
+};
+
+constexpr GLsizei CLOUD_CUBE_INDEX_COUNT = sizeof(CLOUD_CUBE_INDICES) / sizeof(CLOUD_CUBE_INDICES[0]);
+
+// Cells per side of the occupancy map - the sky repeats every
+// CLOUD_MAP_SIZE * spacing blocks, far enough that nobody notices
+constexpr int CLOUD_MAP_SIZE = 128;
+
+// Cloud thickness in blocks, like Minecraft's
+constexpr float CLOUD_THICKNESS = 4.0f;
+
+// Random value in [0, 1] for a lattice point, wrapped so the noise tiles
+float latticeValue(int x, int z, int period) {
+    x = ((x % period) + period) % period;
+    z = ((z % period) + period) % period;
+    uint32_t h = static_cast<uint32_t>(x) * 73856093u ^ static_cast<uint32_t>(z) * 19349663u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return static_cast<float>(h & 0xffffu) / 65535.0f;
+}
+
+// Smoothly interpolated value noise with lattice points 'scale' cells apart
+float tilingNoise(int x, int z, int scale) {
+    int period = CLOUD_MAP_SIZE / scale;
+    float fx = static_cast<float>(x) / scale, fz = static_cast<float>(z) / scale;
+    int x0 = static_cast<int>(std::floor(fx)), z0 = static_cast<int>(std::floor(fz));
+    float tx = fx - x0, tz = fz - z0;
+    tx = tx * tx * (3.0f - 2.0f * tx);
+    tz = tz * tz * (3.0f - 2.0f * tz);
+    float a = latticeValue(x0, z0, period) + (latticeValue(x0 + 1, z0, period) - latticeValue(x0, z0, period)) * tx;
+    float b = latticeValue(x0, z0 + 1, period) + (latticeValue(x0 + 1, z0 + 1, period) - latticeValue(x0, z0 + 1, period)) * tx;
+    return a + (b - a) * tz;
+}
+
+// One byte per cell, 255 where there is cloud. Density 1 covers half the sky
+std::vector<unsigned char> buildCloudMap(float density) {
+    std::vector<float> noise(CLOUD_MAP_SIZE * CLOUD_MAP_SIZE);
+    for (int z = 0; z < CLOUD_MAP_SIZE; z++) {
+        for (int x = 0; x < CLOUD_MAP_SIZE; x++) {
+            // Broad banks with ragged edges
+            noise[x + z * CLOUD_MAP_SIZE] = tilingNoise(x, z, 16) + tilingNoise(x, z, 8) * 0.5f +
+                                            tilingNoise(x, z, 4) * 0.25f + tilingNoise(x, z, 2) * 0.125f;
+        }
+    }
+
+    // Threshold at the quantile that leaves the wanted share of cells cloudy
+    float coverage = std::clamp(density, 0.0f, 1.0f) * 0.5f;
+    std::vector<float> sorted = noise;
+    size_t clear = std::min(sorted.size() - 1, static_cast<size_t>((1.0f - coverage) * sorted.size()));
+    std::nth_element(sorted.begin(), sorted.begin() + clear, sorted.end());
+    float threshold = sorted[clear];
+
+    std::vector<unsigned char> map(noise.size());
+    for (size_t i = 0; i < noise.size(); i++) {
+        map[i] = (coverage > 0.0f && noise[i] >= threshold) ? 255 : 0;
+    }
+    return map;
+}
+
+} // namespace
+
 CloudRenderer::CloudRenderer() {
 }
 
@@ -34,167 +139,70 @@ bool CloudRenderer::initialize() {
         return false;
     }
     
-    // Generate initial cloud mesh around origin
-    // This mesh will be reused and repositioned smoothly
-    generateCloudMeshAroundPosition(glm::vec3(0.0f));
+    m_cloudDensity = g_worldConfig.clouds.density;
+    m_cloudGridSize = g_worldConfig.clouds.gridSize;
+    m_cloudSpacing = g_worldConfig.clouds.spacing;
+    
+    // ⚡ The only geometry and texture uploads clouds ever make
+    createCubeMesh();
+    uploadCloudMap();
     
     std::cout << "CloudRenderer initialized successfully" << std::endl;
     return true;
 }
 
-
-void CloudRenderer::generateCloudMeshAroundPosition(const glm::vec3& centerPos) {
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
-    unsigned int vertexIndex = 0;
+void CloudRenderer::createCubeMesh() {
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
     
-    // Create a moderately sized grid - not too many clouds
-    const int cloudGridSize = g_worldConfig.clouds.gridSize * 2; // Reduced from 4x to 2x
-    const float cloudSpacing = g_worldConfig.clouds.spacing;
-    const float gridCenter = (cloudGridSize - 1) * cloudSpacing * 0.5f;
-    const int cloudLayers = g_worldConfig.clouds.layers;
-    const float layerSpacing = g_worldConfig.clouds.layerSpacing;
+    glBindVertexArray(m_VAO);
     
-    // Use position-based seeding for perfectly consistent, repeating cloud patterns
-    // Create single layer of 3D cloud cubes like Minecraft
-    float cloudLayerHeight = g_worldConfig.clouds.height;
-    float layerDensity = g_worldConfig.clouds.density * 0.2f; // Sparse distribution
-        
-        for (int x = 0; x < cloudGridSize; x++) {
-            for (int z = 0; z < cloudGridSize; z++) {
-                float worldX = centerPos.x + (x * cloudSpacing - gridCenter);
-                float worldZ = centerPos.z + (z * cloudSpacing - gridCenter);
-                
-                // Add random offset to break the grid pattern
-                float randomX = sin(worldX * 0.1f + worldZ * 0.07f) * cloudSpacing * 0.4f;
-                float randomZ = cos(worldX * 0.08f + worldZ * 0.12f) * cloudSpacing * 0.4f;
-                worldX += randomX;
-                worldZ += randomZ;
-                
-                // Use larger spacing for bigger, more Minecraft-like cloud areas
-                float patternX = fmod(worldX + 1000.0f, 16.0f); // Minecraft-style spacing
-                float patternZ = fmod(worldZ + 1000.0f, 16.0f);
-                
-                // Multiple noise layers for more natural cloud shapes like Minecraft
-                float cloudNoise1 = sin(patternX * 0.3f) * cos(patternZ * 0.3f);
-                float cloudNoise2 = sin(patternX * 0.6f + 50.0f) * cos(patternZ * 0.6f + 50.0f) * 0.5f;
-                float cloudNoise3 = sin(patternX * 0.15f + 100.0f) * cos(patternZ * 0.15f + 100.0f) * 0.3f;
-                float combinedNoise = cloudNoise1 + cloudNoise2 + cloudNoise3;
-                
-                // Balanced threshold for nice scattered clouds like Minecraft
-                float threshold = 0.2f; // Moderate threshold for good cloud coverage
-                
-                // Place clouds based on the noise value and layer density
-                if (combinedNoise > threshold) {
-                    // Create larger Minecraft-style cloud cubes that connect naturally
-                    float cloudSize = 6.0f; // Larger size like Minecraft
-                    float cloudHeight = 4.0f; // Taller clouds for more presence
-                    
-                    createCloudCube(worldX, worldZ, cloudLayerHeight, cloudSize, cloudHeight, vertices, indices, vertexIndex);
-                }
-            }
-        }
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(CLOUD_CUBE_VERTICES), CLOUD_CUBE_VERTICES, GL_STATIC_DRAW);
     
-    // Create mesh
-    m_cloudMesh = std::make_unique<Mesh>();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(CLOUD_CUBE_INDICES), CLOUD_CUBE_INDICES, GL_STATIC_DRAW);
     
-    // Convert vertices to proper Vertex format
-    std::vector<Vertex> meshVertices;
-    for (size_t i = 0; i < vertices.size(); i += 5) {
-        glm::vec3 position(vertices[i], vertices[i + 1], vertices[i + 2]);
-        glm::vec2 texCoords(vertices[i + 3], vertices[i + 4]);
-        glm::vec3 normal(0.0f, 1.0f, 0.0f); // Clouds face up
-        meshVertices.emplace_back(position, texCoords, normal);
-    }
+    // Position
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    // Normal
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
     
-    m_cloudMesh->setVertices(meshVertices);
-    m_cloudMesh->setIndices(indices);
-    m_cloudMesh->upload();
+    glBindVertexArray(0);
 }
 
-void CloudRenderer::createCloudCube(float x, float z, float baseHeight, float size, float height, std::vector<float>& vertices, std::vector<unsigned int>& indices, unsigned int& vertexIndex) {
-    float halfSize = size * 0.5f;
-    float halfHeight = height * 0.5f;
-    
-    // Create a 3D cube for each cloud - 6 faces like a Minecraft block
-    
-    // Top face (most important - what you see from below)
-    vertices.insert(vertices.end(), {
-        x - halfSize, baseHeight + halfHeight, z - halfSize, 0.0f, 0.0f,  // Bottom-left
-        x + halfSize, baseHeight + halfHeight, z - halfSize, 1.0f, 0.0f,  // Bottom-right
-        x + halfSize, baseHeight + halfHeight, z + halfSize, 1.0f, 1.0f,  // Top-right
-        x - halfSize, baseHeight + halfHeight, z + halfSize, 0.0f, 1.0f   // Top-left
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
-    
-    // Bottom face
-    vertices.insert(vertices.end(), {
-        x - halfSize, baseHeight - halfHeight, z - halfSize, 0.0f, 0.0f,
-        x - halfSize, baseHeight - halfHeight, z + halfSize, 0.0f, 1.0f,
-        x + halfSize, baseHeight - halfHeight, z + halfSize, 1.0f, 1.0f,
-        x + halfSize, baseHeight - halfHeight, z - halfSize, 1.0f, 0.0f
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
+void CloudRenderer::uploadCloudMap() {
+    std::vector<unsigned char> map = buildCloudMap(m_cloudDensity);
     
-    // Front face
-    vertices.insert(vertices.end(), {
-        x - halfSize, baseHeight - halfHeight, z + halfSize, 0.0f, 0.0f,
-        x - halfSize, baseHeight + halfHeight, z + halfSize, 0.0f, 1.0f,
-        x + halfSize, baseHeight + halfHeight, z + halfSize, 1.0f, 1.0f,
-        x + halfSize, baseHeight - halfHeight, z + halfSize, 1.0f, 0.0f
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
-    
-    // Back face
-    vertices.insert(vertices.end(), {
-        x + halfSize, baseHeight - halfHeight, z - halfSize, 0.0f, 0.0f,
-        x + halfSize, baseHeight + halfHeight, z - halfSize, 0.0f, 1.0f,
-        x - halfSize, baseHeight + halfHeight, z - halfSize, 1.0f, 1.0f,
-        x - halfSize, baseHeight - halfHeight, z - halfSize, 1.0f, 0.0f
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
+    if (m_cloudMap == 0) {
+        glGenTextures(1, &m_cloudMap);
+        glBindTexture(GL_TEXTURE_2D, m_cloudMap);
+        // Repeat so the map wraps around the camera without any CPU bookkeeping
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, CLOUD_MAP_SIZE, CLOUD_MAP_SIZE, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+    } else {
+        glBindTexture(GL_TEXTURE_2D, m_cloudMap);
+    }
     
-    // Left face
-    vertices.insert(vertices.end(), {
-        x - halfSize, baseHeight - halfHeight, z - halfSize, 0.0f, 0.0f,
-        x - halfSize, baseHeight + halfHeight, z - halfSize, 0.0f, 1.0f,
-        x - halfSize, baseHeight + halfHeight, z + halfSize, 1.0f, 1.0f,
-        x - halfSize, baseHeight - halfHeight, z + halfSize, 1.0f, 0.0f
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
+    // Rows are one byte per texel - not a multiple of the default 4-byte alignment in general
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, CLOUD_MAP_SIZE, CLOUD_MAP_SIZE, GL_RED, GL_UNSIGNED_BYTE, map.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
     
-    // Right face
-    vertices.insert(vertices.end(), {
-        x + halfSize, baseHeight - halfHeight, z + halfSize, 0.0f, 0.0f,
-        x + halfSize, baseHeight + halfHeight, z + halfSize, 0.0f, 1.0f,
-        x + halfSize, baseHeight + halfHeight, z - halfSize, 1.0f, 1.0f,
-        x + halfSize, baseHeight - halfHeight, z - halfSize, 1.0f, 0.0f
-    });
-    indices.insert(indices.end(), {
-        vertexIndex, vertexIndex + 1, vertexIndex + 2,
-        vertexIndex, vertexIndex + 2, vertexIndex + 3
-    });
-    vertexIndex += 4;
+    m_cloudMapDirty = false;
+}
+
+void CloudRenderer::setCloudDensity(float density) {
+    if (density == m_cloudDensity) return;
+    m_cloudDensity = density;
+    m_cloudMapDirty = true;
 }
 
 void CloudRenderer::update(float deltaTime) {
@@ -202,16 +210,13 @@ void CloudRenderer::update(float deltaTime) {
 }
 
 void CloudRenderer::render(const glm::mat4& view, const glm::mat4& projection, float time, const glm::vec3& playerPos) {
-    if (!m_shader || !m_cloudMesh) {
+    if (!m_shader || m_VAO == 0) {
         return;
     }
     
-    // Only regenerate mesh if player moved VERY far (like switching worlds or teleporting)
-    float distanceFromLastUpdate = glm::length(playerPos - m_lastPlayerPos);
-    if (distanceFromLastUpdate > g_worldConfig.clouds.updateDistance * 3.0f) {
-        generateCloudMeshAroundPosition(playerPos);
-        m_lastPlayerPos = playerPos;
-        m_lastUpdateTime = time;
+    // A density change only refills the occupancy map; the geometry never changes
+    if (m_cloudMapDirty) {
+        uploadCloudMap();
     }
     
     // Enable alpha blending for cloud transparency
@@ -221,47 +226,55 @@ void CloudRenderer::render(const glm::mat4& view, const glm::mat4& projection, f
     
     m_shader->use();
     
-    // Create model matrix with smooth world-space movement like Minecraft
-    glm::mat4 model = glm::mat4(1.0f);
-    
-    // Add smooth, continuous movement in world space like Minecraft
-    // Clouds drift very slowly across the world at a peaceful pace
-    float cloudSpeed = g_worldConfig.clouds.speed * 1.5f; // Moderate speed for Minecraft feel
-    float cloudOffsetX = time * cloudSpeed;
-    float cloudOffsetZ = time * cloudSpeed * 0.15f; // Very slight diagonal like Minecraft
-    
-    // Apply the movement translation - this makes clouds float across the world
-    model = glm::translate(model, glm::vec3(cloudOffsetX, 0.0f, cloudOffsetZ));
+    // Clouds drift very slowly across the world at a peaceful pace,
+    // with a very slight diagonal like Minecraft
+    float cloudSpeed = m_cloudSpeed * 1.5f;
+    glm::vec2 windOffset(time * cloudSpeed, time * cloudSpeed * 0.15f);
     
     // Set matrices
-    m_shader->setMat4("model", model);
     m_shader->setMat4("view", view);
     m_shader->setMat4("projection", projection);
     
+    // Cloud grid - the shader places every cell from these
+    int gridSide = std::max(1, m_cloudGridSize * 2);
+    m_shader->setInt("cloudMap", 0);
+    m_shader->setVec3("cameraPos", playerPos);
+    m_shader->setVec2("windOffset", windOffset);
+    m_shader->setFloat("cellSize", m_cloudSpacing);
+    m_shader->setFloat("cloudHeight", m_cloudHeight);
+    m_shader->setFloat("thickness", CLOUD_THICKNESS);
+    m_shader->setInt("gridSide", gridSide);
+    
     // Set simple lighting (clouds should be bright)
     m_shader->setVec3("lightPos", glm::vec3(100.0f, 100.0f, 100.0f));
     m_shader->setVec3("lightColor", glm::vec3(1.0f, 1.0f, 1.0f));
     m_shader->setVec3("viewPos", playerPos);
     
-    // Pass time for smooth animated cloud movement - the shader handles all movement
-    m_shader->setFloat("time", time * g_worldConfig.clouds.speed);
-    
-    // Pass player position for advanced effects if needed
-    m_shader->setVec3("playerPos", playerPos);
-    
-    // No texture needed - shader creates procedural cloud patterns
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindTexture(GL_TEXTURE_2D, m_cloudMap);
     
-    // Render cloud mesh
-    m_cloudMesh->render();
+    // ⚡ One draw for the whole sky
+    glBindVertexArray(m_VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, CLOUD_CUBE_INDEX_COUNT, GL_UNSIGNED_INT, 0, gridSide * gridSide);
+    g_drawStats.recordTriangles(CLOUD_CUBE_INDEX_COUNT, gridSide * gridSide);
+    glBindVertexArray(0);
     
     // Restore render state
+    glBindTexture(GL_TEXTURE_2D, 0);
     glDepthMask(GL_TRUE);
     glDisable(GL_BLEND);
 }
 
 void CloudRenderer::cleanup() {
-    m_cloudMesh.reset();
+    if (m_VAO != 0) {
+        glDeleteVertexArrays(1, &m_VAO);
+        glDeleteBuffers(1, &m_VBO);
+        glDeleteBuffers(1, &m_EBO);
+        m_VAO = m_VBO = m_EBO = 0;
+    }
+    if (m_cloudMap != 0) {
+        glDeleteTextures(1, &m_cloudMap);
+        m_cloudMap = 0;
+    }
     m_shader.reset();
 }
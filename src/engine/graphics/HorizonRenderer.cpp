@@ -0,0 +1,171 @@
+#include "engine/graphics/HorizonRenderer.h"
+#include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
+#include "engine/AssetManager.h"
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+HorizonRenderer::HorizonRenderer()
+    : m_radius(0.0f), m_innerRadius(0.0f), m_initialized(false) {
+}
+
+HorizonRenderer::~HorizonRenderer() {
+    cleanup();
+}
+
+bool HorizonRenderer::initialize(const ModularWorldGenerator* generator, float radius) {
+    if (m_initialized) {
+        return true;
+    }
+
+    std::cout << "Initializing horizon renderer..." << std::endl;
+
+    m_shader = AssetManager::getInstance().loadShader(
+        "assets/shaders/horizon.vert",
+        "assets/shaders/horizon.frag"
+    );
+
+    if (!m_shader || !generator) {
+        std::cerr << "Failed to load horizon shader!" << std::endl;
+        return false;
+    }
+
+    m_radius = radius;
+    m_field = std::make_unique<HorizonField>(generator, radius);
+    resizeLevels();
+
+    m_initialized = true;
+    std::cout << "Horizon renderer initialized: " << m_field->getLevelCount() << " levels out to "
+              << radius << " blocks" << std::endl;
+    return true;
+}
+
+void HorizonRenderer::setRadius(float radius) {
+    m_radius = radius;
+    if (m_field) {
+        m_field->setRadius(radius);
+        resizeLevels();
+    }
+}
+
+void HorizonRenderer::update(const glm::vec3& cameraPos) {
+    if (!m_initialized) {
+        return;
+    }
+
+    // ⚡ Only levels that scrolled get resampled and re-uploaded
+    if (m_field->update(cameraPos) == 0) {
+        return;
+    }
+    for (int level = 0; level < m_field->getLevelCount(); ++level) {
+        if (m_field->isLevelDirty(level)) {
+            uploadLevel(level);
+        }
+    }
+}
+
+void HorizonRenderer::render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPos) {
+    if (!m_initialized) {
+        return;
+    }
+
+    // The hole follows the same chunk-to-chunk distance World::render uses
+    glm::vec2 cameraChunk(std::floor(cameraPos.x / CHUNK_SIZE), std::floor(cameraPos.z / CHUNK_SIZE));
+    glm::vec2 innerCenter = (cameraChunk + glm::vec2(0.5f)) * static_cast<float>(CHUNK_SIZE);
+
+    m_shader->use();
+    m_shader->setMat4("view", view);
+    m_shader->setMat4("projection", projection);
+    m_shader->setVec3("cameraPos", cameraPos);
+    m_shader->setVec2("innerCenter", innerCenter);
+    m_shader->setFloat("innerRadius", m_innerRadius);
+    m_shader->setFloat("outerRadius", m_radius);
+    // Sky colour halfway up skybox.frag's gradient - where the far edge meets it
+    m_shader->setVec3("hazeColor", glm::vec3(104.5f / 255.0f, 175.0f / 255.0f, 230.5f / 255.0f));
+    m_shader->setVec3("lightDir", glm::normalize(glm::vec3(0.3f, 1.0f, 0.2f)));
+
+    for (const LevelBuffers& level : m_levels) {
+        if (level.indexCount == 0) continue;
+        glBindVertexArray(level.VAO);
+        glDrawElements(GL_TRIANGLES, level.indexCount, GL_UNSIGNED_INT, 0);
+        g_drawStats.recordTriangles(level.indexCount);
+    }
+    glBindVertexArray(0);
+}
+
+void HorizonRenderer::cleanup() {
+    for (LevelBuffers& level : m_levels) {
+        if (level.VAO != 0) glDeleteVertexArrays(1, &level.VAO);
+        if (level.VBO != 0) glDeleteBuffers(1, &level.VBO);
+        if (level.EBO != 0) glDeleteBuffers(1, &level.EBO);
+    }
+    m_levels.clear();
+    m_field.reset();
+    m_shader.reset();
+    m_initialized = false;
+}
+
+size_t HorizonRenderer::getTriangleCount() const {
+    size_t triangles = 0;
+    for (const LevelBuffers& level : m_levels) {
+        triangles += level.indexCount / 3;
+    }
+    return triangles;
+}
+
+void HorizonRenderer::resizeLevels() {
+    int levelCount = m_field->getLevelCount();
+    while (static_cast<int>(m_levels.size()) > levelCount) {
+        LevelBuffers& level = m_levels.back();
+        glDeleteVertexArrays(1, &level.VAO);
+        glDeleteBuffers(1, &level.VBO);
+        glDeleteBuffers(1, &level.EBO);
+        m_levels.pop_back();
+    }
+
+    while (static_cast<int>(m_levels.size()) < levelCount) {
+        LevelBuffers level;
+        glGenVertexArrays(1, &level.VAO);
+        glGenBuffers(1, &level.VBO);
+        glGenBuffers(1, &level.EBO);
+
+        glBindVertexArray(level.VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, level.VBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, level.EBO);
+
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(HorizonVertex),
+                              (void*)offsetof(HorizonVertex, position));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(HorizonVertex),
+                              (void*)offsetof(HorizonVertex, normal));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(HorizonVertex),
+                              (void*)offsetof(HorizonVertex, color));
+
+        glBindVertexArray(0);
+        m_levels.push_back(level);
+    }
+
+    // Every level resamples on the next update
+    for (LevelBuffers& level : m_levels) {
+        level.indexCount = 0;
+    }
+}
+
+void HorizonRenderer::uploadLevel(int levelIndex) {
+    m_field->buildLevelMesh(levelIndex, m_meshData);
+
+    LevelBuffers& level = m_levels[levelIndex];
+    glBindVertexArray(level.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, level.VBO);
+    glBufferData(GL_ARRAY_BUFFER, m_meshData.vertices.size() * sizeof(HorizonVertex),
+                 m_meshData.vertices.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, level.EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_meshData.indices.size() * sizeof(unsigned int),
+                 m_meshData.indices.data(), GL_DYNAMIC_DRAW);
+    glBindVertexArray(0);
+
+    level.indexCount = static_cast<int>(m_meshData.indices.size());
+}
@@ -0,0 +1,260 @@
+#include "engine/graphics/InstancedRenderer.h"
+#include "engine/AssetManager.h"
+#include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
+#include "engine/graphics/Shader.h"
+#include "engine/graphics/Texture.h"
+#include <cstddef>
+#include <iostream>
+
+namespace {
+
+// Unit cube centred on the origin: position, texture coordinates, normal
+const float CUBE_VERTICES[] = {
+    // Front face
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   0.0f,  0.0f,  1.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,   0.0f,  0.0f,  1.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    // Back face
+    -0.5f, -0.5f, -0.5f,  1.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   0.0f,  0.0f, -1.0f,
+     0.5f,  0.5f, -0.5f,  0.0f, 1.0f,   0.0f,  0.0f, -1.0f,
+     0.5f, -0.5f, -0.5f,  0.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+    // Left face
+    -0.5f,  0.5f,  0.5f,  1.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f, -0.5f,  0.5f,  1.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    // Right face
+     0.5f,  0.5f,  0.5f,  0.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+     0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+    // Top face
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+    // Bottom face
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 1.0f,   0.0f, -1.0f,  0.0f
+};
+
+const unsigned int CUBE_INDICES[] = {
+     0,  1,  2,   2,  3,  0,   // Front
+     4,  5,  6,   6,  7,  4,   // Back
+     8,  9, 10,  10, 11,  8,   // Left
+    12, 13, 14,  14, 15, 12,   // Right
+    16, 17, 18,  18, 19, 16,   // Top
+    20, 21, 22,  22, 23, 20    // Bottom
+};
+
+constexpr GLsizei CUBE_INDEX_COUNT = sizeof(CUBE_INDICES) / sizeof(CUBE_INDICES[0]);
+
+std::shared_ptr<Texture> getBlockTexture(BlockType blockType) {
+    auto& assetManager = AssetManager::getInstance();
+
+    switch (blockType) {
+        case BlockType::GRASS:
+        case BlockType::DIRT:  // Grass texture stands in for dirt
+            return assetManager.loadTexture("assets/textures/grass.png");
+        case BlockType::SAND:
+            return assetManager.loadTexture("assets/textures/sand.png");
+        case BlockType::WOOD:
+        case BlockType::OAK_LOG:
+            return assetManager.loadTexture("assets/textures/oak.png");
+        case BlockType::LEAVES:
+            return assetManager.loadTexture("assets/textures/oakleave.png");
+        case BlockType::GRAVEL:
+            return assetManager.loadTexture("assets/textures/gravel.png");
+        case BlockType::WATER:
+            return assetManager.loadTexture("assets/textures/water.webp");
+        default:
+            return assetManager.loadTexture("assets/textures/stone.png");
+    }
+}
+
+} // namespace
+
+InstancedRenderer::InstancedRenderer()
+    : m_lightPos(100.0f, 100.0f, 100.0f)
+    , m_lightColor(1.0f, 1.0f, 0.9f)
+    , m_drawCalls(0)
+    , m_initialized(false) {
+}
+
+InstancedRenderer::~InstancedRenderer() {
+    cleanup();
+}
+
+bool InstancedRenderer::initialize() {
+    m_instancedShader = AssetManager::getInstance().loadShader(
+        "assets/shaders/instanced.vert",
+        "assets/shaders/instanced.frag"
+    );
+    if (!m_instancedShader) {
+        std::cout << "Failed to load instanced shader!" << std::endl;
+        return false;
+    }
+
+    m_initialized = true;
+    return true;
+}
+
+void InstancedRenderer::cleanup() {
+    for (auto& [blockType, group] : m_instanceGroups) {
+        if (group->VAO) glDeleteVertexArrays(1, &group->VAO);
+        if (group->VBO) glDeleteBuffers(1, &group->VBO);
+        if (group->EBO) glDeleteBuffers(1, &group->EBO);
+        if (group->instanceVBO) glDeleteBuffers(1, &group->instanceVBO);
+    }
+    m_instanceGroups.clear();
+    m_initialized = false;
+}
+
+void InstancedRenderer::addInstance(BlockType blockType, const glm::mat4& transform,
+                                    const glm::vec4& color, const glm::vec2& texOffset) {
+    std::unique_ptr<InstanceGroup>& group = m_instanceGroups[blockType];
+    if (!group) {
+        group = std::make_unique<InstanceGroup>();
+        createBlockGeometry(blockType, *group);
+    }
+
+    group->instances.push_back({transform, color, texOffset});
+    group->needsUpdate = true;
+}
+
+void InstancedRenderer::clear() {
+    for (auto& [blockType, group] : m_instanceGroups) {
+        if (!group->instances.empty()) {
+            group->instances.clear();
+            group->needsUpdate = true;
+        }
+    }
+}
+
+void InstancedRenderer::updateInstanceData() {
+    for (auto& [blockType, group] : m_instanceGroups) {
+        if (group->needsUpdate) {
+            updateInstanceGroup(*group);
+        }
+    }
+}
+
+void InstancedRenderer::renderAll(const glm::mat4& view, const glm::mat4& projection) {
+    m_drawCalls = 0;
+    if (!m_initialized) return;
+
+    for (auto& [blockType, group] : m_instanceGroups) {
+        renderBlockType(blockType, view, projection);
+    }
+}
+
+void InstancedRenderer::renderBlockType(BlockType blockType, const glm::mat4& view, const glm::mat4& projection) {
+    if (!m_initialized) return;
+
+    auto it = m_instanceGroups.find(blockType);
+    if (it == m_instanceGroups.end() || it->second->instances.empty() || !it->second->texture) return;
+    InstanceGroup& group = *it->second;
+
+    if (group.needsUpdate) {
+        updateInstanceGroup(group);
+    }
+
+    m_instancedShader->use();
+    m_instancedShader->setMat4("view", view);
+    m_instancedShader->setMat4("projection", projection);
+    m_instancedShader->setVec3("lightPos", m_lightPos);
+    m_instancedShader->setVec3("lightColor", m_lightColor);
+
+    group.texture->bind(0);
+    m_instancedShader->setInt("texture1", 0);
+
+    // ⚡ Every instance of this type in one call
+    glBindVertexArray(group.VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, CUBE_INDEX_COUNT, GL_UNSIGNED_INT, 0,
+                            static_cast<GLsizei>(group.instances.size()));
+    glBindVertexArray(0);
+    m_drawCalls++;
+    g_drawStats.recordTriangles(CUBE_INDEX_COUNT, group.instances.size());
+}
+
+int InstancedRenderer::getTotalInstances() const {
+    size_t total = 0;
+    for (const auto& [blockType, group] : m_instanceGroups) {
+        total += group->instances.size();
+    }
+    return static_cast<int>(total);
+}
+
+void InstancedRenderer::createBlockGeometry(BlockType blockType, InstanceGroup& group) {
+    group.texture = getBlockTexture(blockType);
+
+    glGenVertexArrays(1, &group.VAO);
+    glGenBuffers(1, &group.VBO);
+    glGenBuffers(1, &group.EBO);
+    glGenBuffers(1, &group.instanceVBO);
+
+    glBindVertexArray(group.VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, group.VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_VERTICES), CUBE_VERTICES, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, group.EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(CUBE_INDICES), CUBE_INDICES, GL_STATIC_DRAW);
+
+    // Same per-vertex layout as Mesh: position, texture coordinates, normal
+    const GLsizei stride = 8 * sizeof(float);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (void*)(5 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    setupInstanceAttributes(group);
+
+    glBindVertexArray(0);
+}
+
+void InstancedRenderer::setupInstanceAttributes(InstanceGroup& group) {
+    glBindBuffer(GL_ARRAY_BUFFER, group.instanceVBO);
+
+    // A mat4 attribute takes four vec4 slots (3-6)
+    const GLsizei stride = sizeof(InstanceData);
+    for (int column = 0; column < 4; ++column) {
+        GLuint location = 3 + column;
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride,
+                              (void*)(offsetof(InstanceData, modelMatrix) + column * sizeof(glm::vec4)));
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+
+    glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(InstanceData, color));
+    glEnableVertexAttribArray(7);
+    glVertexAttribDivisor(7, 1);
+
+    glVertexAttribPointer(8, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(InstanceData, texOffset));
+    glEnableVertexAttribArray(8);
+    glVertexAttribDivisor(8, 1);
+}
+
+void InstancedRenderer::updateInstanceGroup(InstanceGroup& group) {
+    group.needsUpdate = false;
+    if (group.instances.empty()) return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, group.instanceVBO);
+
+    // ⚡ Streamed: re-specifying the store each frame lets the driver hand out
+    // fresh memory instead of waiting for last frame's draw to finish reading
+    if (group.instances.size() > group.capacity) {
+        group.capacity = group.instances.size() * 2;
+    }
+    glBufferData(GL_ARRAY_BUFFER, group.capacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, group.instances.size() * sizeof(InstanceData), group.instances.data());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -1,10 +1,14 @@
 #include "engine/graphics/Mesh.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
+#include <algorithm>
+#include <cstdint>
+
+// 📊 Frame totals across every renderer, not only meshes
+DrawStats g_drawStats;
 
 Mesh::Mesh() : m_VAO(0), m_VBO(0), m_EBO(0), m_uploaded(false) {
-    glGenVertexArrays(1, &m_VAO);
-    glGenBuffers(1, &m_VBO);
-    glGenBuffers(1, &m_EBO);
+    // GPU objects are created on first upload, so meshes can be built without a GL context
 }
 
 Mesh::~Mesh() {
@@ -26,6 +30,12 @@ void Mesh::setIndices(const std::vector<unsigned int>& indices) {
 void Mesh::upload() {
     if (m_vertices.empty()) return;
     
+    if (!m_VAO) {
+        glGenVertexArrays(1, &m_VAO);
+        glGenBuffers(1, &m_VBO);
+        glGenBuffers(1, &m_EBO);
+    }
+    
     glBindVertexArray(m_VAO);
     
     // Upload vertex data
@@ -51,8 +61,10 @@ void Mesh::render() const {
     
     if (!m_indices.empty()) {
         glDrawElements(GL_TRIANGLES, m_indices.size(), GL_UNSIGNED_INT, 0);
+        g_drawStats.recordTriangles(m_indices.size());
     } else {
         glDrawArrays(GL_TRIANGLES, 0, m_vertices.size());
+        g_drawStats.recordTriangles(m_vertices.size());
     }
     
     glBindVertexArray(0);
@@ -61,9 +73,57 @@ void Mesh::render() const {
 void Mesh::clear() {
     m_vertices.clear();
     m_indices.clear();
+    m_groupStarts.clear();
     m_uploaded = false;
 }
 
+void Mesh::setIndexGroups(const unsigned int* starts, int groupCount) {
+    m_groupStarts.assign(starts, starts + std::min(groupCount, MAX_GROUPS) + 1);
+}
+
+void Mesh::renderGroups(unsigned int groupMask) const {
+    if (m_groupStarts.empty() || m_indices.empty()) {
+        render();
+        return;
+    }
+    if (!m_uploaded) return;
+    
+    // Neighbouring groups merge into one range - at most every other group starts one
+    GLsizei counts[MAX_GROUPS / 2 + 1];
+    const void* offsets[MAX_GROUPS / 2 + 1];
+    unsigned int rangeEnd = 0;
+    int ranges = 0;
+    for (size_t group = 0; group + 1 < m_groupStarts.size(); ++group) {
+        unsigned int begin = m_groupStarts[group];
+        unsigned int end = m_groupStarts[group + 1];
+        if (!(groupMask & (1u << group)) || begin == end) continue;
+        
+        if (ranges > 0 && rangeEnd == begin) {
+            counts[ranges - 1] += static_cast<GLsizei>(end - begin);
+        } else {
+            counts[ranges] = static_cast<GLsizei>(end - begin);
+            offsets[ranges] = reinterpret_cast<const void*>(static_cast<uintptr_t>(begin) * sizeof(unsigned int));
+            ranges++;
+        }
+        rangeEnd = end;
+    }
+    if (ranges == 0) return;
+    
+    glBindVertexArray(m_VAO);
+    if (ranges == 1) {
+        glDrawElements(GL_TRIANGLES, counts[0], GL_UNSIGNED_INT, offsets[0]);
+    } else {
+        glMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, offsets, ranges);
+    }
+    // One call, however many ranges it draws
+    uint64_t indexCount = 0;
+    for (int i = 0; i < ranges; i++) {
+        indexCount += counts[i];
+    }
+    g_drawStats.recordTriangles(indexCount);
+    glBindVertexArray(0);
+}
+
 void Mesh::setupMesh() {
     // Position attribute
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
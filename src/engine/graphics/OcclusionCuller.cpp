@@ -0,0 +1,380 @@
+#include "engine/graphics/OcclusionCuller.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OCCLUSION_SSE 1
+#endif
+
+namespace {
+
+constexpr float NEAR_W = 0.1f;                 // Camera near plane
+constexpr float VALID_MOVE_SQUARED = 1.0f;     // Blocks² the camera may move before a result is stale
+constexpr float VALID_FORWARD_DOT = 0.995f;    // ~6 degrees of turn
+
+} // namespace
+
+bool OcclusionCuller::Result::isValidFor(const glm::vec3& position, const glm::vec3& forward) const {
+    glm::vec3 moved = position - cameraPos;
+    return glm::dot(moved, moved) <= VALID_MOVE_SQUARED && glm::dot(forward, cameraForward) >= VALID_FORWARD_DOT;
+}
+
+OcclusionCuller::OcclusionCuller()
+    : m_depth(WIDTH * HEIGHT, 0.0f)
+    , m_viewProjection(1.0f)
+    , m_cameraPos(0.0f)
+    , m_occluderQuads(0)
+    , m_hasPendingFrame(false)
+    , m_running(false)
+    , m_hasFinishedResult(false)
+    , m_stop(false) {
+}
+
+OcclusionCuller::~OcclusionCuller() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+void OcclusionCuller::beginFrame(const glm::mat4& viewProjection, const glm::vec3& cameraPos) {
+    m_viewProjection = viewProjection;
+    m_cameraPos = cameraPos;
+    m_occluderQuads = 0;
+    std::fill(m_depth.begin(), m_depth.end(), 0.0f);
+}
+
+void OcclusionCuller::addOccluder(const glm::ivec2& chunkPos, const ChunkOccluder& shape) {
+    constexpr int TILES = ChunkOccluder::TILES;
+    constexpr float TILE = static_cast<float>(ChunkOccluder::TILE);
+
+    // Blocks are centred on their coordinates, so solid runs start half a block down
+    auto heightAt = [&](int tx, int tz) -> float {
+        if (tx < 0 || tx >= TILES || tz < 0 || tz >= TILES) return -0.5f;
+        return shape.tileHeight[tx][tz] - 0.5f;
+    };
+
+    // Only the faces turned towards the camera, and of side faces only the part
+    // above the neighbouring tile - the rest is buried in solid blocks
+    for (int tx = 0; tx < TILES; ++tx) {
+        for (int tz = 0; tz < TILES; ++tz) {
+            if (shape.tileHeight[tx][tz] == 0) continue;
+            float height = heightAt(tx, tz);
+
+            float x0 = chunkPos.x * CHUNK_SIZE + tx * TILE - 0.5f, x1 = x0 + TILE;
+            float z0 = chunkPos.y * CHUNK_SIZE + tz * TILE - 0.5f, z1 = z0 + TILE;
+
+            if (m_cameraPos.y > height) {
+                const glm::vec3 top[4] = {{x0, height, z0}, {x1, height, z0}, {x1, height, z1}, {x0, height, z1}};
+                rasterizeQuad(top);
+            }
+
+            float bottom = heightAt(tx - 1, tz);
+            if (m_cameraPos.x < x0 && bottom < height) {
+                const glm::vec3 side[4] = {{x0, bottom, z0}, {x0, bottom, z1}, {x0, height, z1}, {x0, height, z0}};
+                rasterizeQuad(side);
+            }
+            bottom = heightAt(tx + 1, tz);
+            if (m_cameraPos.x > x1 && bottom < height) {
+                const glm::vec3 side[4] = {{x1, bottom, z0}, {x1, bottom, z1}, {x1, height, z1}, {x1, height, z0}};
+                rasterizeQuad(side);
+            }
+            bottom = heightAt(tx, tz - 1);
+            if (m_cameraPos.z < z0 && bottom < height) {
+                const glm::vec3 side[4] = {{x0, bottom, z0}, {x1, bottom, z0}, {x1, height, z0}, {x0, height, z0}};
+                rasterizeQuad(side);
+            }
+            bottom = heightAt(tx, tz + 1);
+            if (m_cameraPos.z > z1 && bottom < height) {
+                const glm::vec3 side[4] = {{x0, bottom, z1}, {x1, bottom, z1}, {x1, height, z1}, {x0, height, z1}};
+                rasterizeQuad(side);
+            }
+        }
+    }
+}
+
+void OcclusionCuller::rasterizeQuad(const glm::vec3 corners[4]) {
+    glm::vec4 clip[4];
+    for (int i = 0; i < 4; ++i) {
+        clip[i] = m_viewProjection * glm::vec4(corners[i], 1.0f);
+    }
+
+    // Clip against the near plane - a quad loses a corner or gains one, never more
+    glm::vec4 clipped[5];
+    int count = 0;
+    for (int i = 0; i < 4; ++i) {
+        const glm::vec4& current = clip[i];
+        const glm::vec4& next = clip[(i + 1) % 4];
+        bool currentInside = current.w >= NEAR_W;
+        bool nextInside = next.w >= NEAR_W;
+        if (currentInside) {
+            clipped[count++] = current;
+        }
+        if (currentInside != nextInside) {
+            float t = (NEAR_W - current.w) / (next.w - current.w);
+            clipped[count++] = current + (next - current) * t;
+        }
+    }
+    if (count < 3) {
+        return;
+    }
+
+    ScreenVertex vertices[5];
+    for (int i = 0; i < count; ++i) {
+        float invW = 1.0f / clipped[i].w;
+        vertices[i].x = (clipped[i].x * invW * 0.5f + 0.5f) * WIDTH;
+        vertices[i].y = (clipped[i].y * invW * 0.5f + 0.5f) * HEIGHT;
+        vertices[i].depth = invW;
+    }
+    m_occluderQuads++;
+    rasterizePolygon(vertices, count);
+}
+
+void OcclusionCuller::rasterizePolygon(const ScreenVertex* vertices, int count) {
+    // Depth plane from the widest corner triangle - the polygon is flat
+    float bestArea = 0.0f;
+    float dzdx = 0.0f, dzdy = 0.0f;
+    float minX = vertices[0].x, maxX = vertices[0].x;
+    float minY = vertices[0].y, maxY = vertices[0].y;
+    float signedArea = 0.0f;
+    const ScreenVertex& a = vertices[0];
+    for (int i = 0; i < count; ++i) {
+        const ScreenVertex& p = vertices[i];
+        const ScreenVertex& q = vertices[(i + 1) % count];
+        signedArea += p.x * q.y - q.x * p.y;
+        minX = std::min(minX, p.x); maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y); maxY = std::max(maxY, p.y);
+
+        if (i >= 1 && i + 1 < count) {
+            float area = (p.x - a.x) * (q.y - a.y) - (p.y - a.y) * (q.x - a.x);
+            if (std::abs(area) > std::abs(bestArea)) {
+                bestArea = area;
+                dzdx = ((p.depth - a.depth) * (q.y - a.y) - (q.depth - a.depth) * (p.y - a.y)) / area;
+                dzdy = ((q.depth - a.depth) * (p.x - a.x) - (p.depth - a.depth) * (q.x - a.x)) / area;
+            }
+        }
+    }
+    if (std::abs(bestArea) < 1e-6f) {
+        return;  // Edge-on
+    }
+
+    int x0 = std::max(0, static_cast<int>(std::ceil(minX - 0.5f)));
+    int x1 = std::min(WIDTH - 1, static_cast<int>(std::floor(maxX - 0.5f)));
+    int y0 = std::max(0, static_cast<int>(std::ceil(minY - 0.5f)));
+    int y1 = std::min(HEIGHT - 1, static_cast<int>(std::floor(maxY - 0.5f)));
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    // Edge functions, signed so the inside is positive whichever way the polygon winds
+    float sign = signedArea > 0.0f ? 1.0f : -1.0f;
+    float edgeA[5], edgeB[5], edgeC[5];
+    for (int i = 0; i < count; ++i) {
+        const ScreenVertex& p = vertices[i];
+        const ScreenVertex& q = vertices[(i + 1) % count];
+        edgeA[i] = -(q.y - p.y) * sign;
+        edgeB[i] = (q.x - p.x) * sign;
+        edgeC[i] = -(edgeA[i] * p.x + edgeB[i] * p.y);
+    }
+
+    // Each pixel keeps the farthest depth the plane reaches inside it
+    float depthBias = 0.5f * (std::abs(dzdx) + std::abs(dzdy));
+    float depthOrigin = a.depth - dzdx * a.x - dzdy * a.y - depthBias;
+
+#ifdef OCCLUSION_SSE
+    int xStart = x0 & ~3;  // Rows are a multiple of 4 wide, so whole lanes stay in the row
+    const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 stepA[5];
+    for (int i = 0; i < count; ++i) {
+        stepA[i] = _mm_set1_ps(edgeA[i]);
+    }
+    const __m128 stepDepth = _mm_set1_ps(dzdx);
+
+    for (int y = y0; y <= y1; ++y) {
+        float py = y + 0.5f;
+        __m128 rowC[5];
+        for (int i = 0; i < count; ++i) {
+            rowC[i] = _mm_set1_ps(edgeB[i] * py + edgeC[i]);
+        }
+        __m128 rowDepth = _mm_set1_ps(depthOrigin + dzdy * py);
+        float* row = &m_depth[y * WIDTH];
+
+        for (int x = xStart; x <= x1; x += 4) {
+            __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepA[0], px), rowC[0]), zero);
+            for (int i = 1; i < count; ++i) {
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepA[i], px), rowC[i]), zero));
+            }
+            if (_mm_movemask_ps(inside) == 0) continue;
+
+            __m128 depth = _mm_add_ps(_mm_mul_ps(stepDepth, px), rowDepth);
+            __m128 current = _mm_loadu_ps(row + x);
+            __m128 nearest = _mm_max_ps(current, depth);
+            _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+        }
+    }
+#else
+    for (int y = y0; y <= y1; ++y) {
+        float py = y + 0.5f;
+        float* row = &m_depth[y * WIDTH];
+        for (int x = x0; x <= x1; ++x) {
+            float px = x + 0.5f;
+            bool inside = true;
+            for (int i = 0; i < count && inside; ++i) {
+                inside = edgeA[i] * px + edgeB[i] * py + edgeC[i] >= 0.0f;
+            }
+            if (inside) {
+                row[x] = std::max(row[x], depthOrigin + dzdx * px + dzdy * py);
+            }
+        }
+    }
+#endif
+}
+
+bool OcclusionCuller::isBoxVisible(const glm::vec3& min, const glm::vec3& max) const {
+    float minX = static_cast<float>(WIDTH), maxX = 0.0f;
+    float minY = static_cast<float>(HEIGHT), maxY = 0.0f;
+    float nearestDepth = 0.0f;
+
+    for (int corner = 0; corner < 8; ++corner) {
+        glm::vec4 point((corner & 1) ? max.x : min.x, (corner & 2) ? max.y : min.y, (corner & 4) ? max.z : min.z, 1.0f);
+        glm::vec4 clip = m_viewProjection * point;
+        if (clip.w < NEAR_W) {
+            return true;  // Reaches past the near plane - around the camera
+        }
+        float invW = 1.0f / clip.w;
+        float x = (clip.x * invW * 0.5f + 0.5f) * WIDTH;
+        float y = (clip.y * invW * 0.5f + 0.5f) * HEIGHT;
+        minX = std::min(minX, x); maxX = std::max(maxX, x);
+        minY = std::min(minY, y); maxY = std::max(maxY, y);
+        nearestDepth = std::max(nearestDepth, invW);
+    }
+
+    // Every pixel the box touches, grown by one for occluder edges sampled at pixel centres
+    int x0 = std::max(0, static_cast<int>(std::floor(minX)) - 1);
+    int x1 = std::min(WIDTH - 1, static_cast<int>(std::floor(maxX)) + 1);
+    int y0 = std::max(0, static_cast<int>(std::floor(minY)) - 1);
+    int y1 = std::min(HEIGHT - 1, static_cast<int>(std::floor(maxY)) + 1);
+    if (x0 > x1 || y0 > y1) {
+        return false;  // Off screen
+    }
+
+#ifdef OCCLUSION_SSE
+    const __m128 laneOffsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 first = _mm_set1_ps(static_cast<float>(x0));
+    const __m128 last = _mm_set1_ps(static_cast<float>(x1));
+    const __m128 boxDepth = _mm_set1_ps(nearestDepth);
+    int xStart = x0 & ~3;
+
+    for (int y = y0; y <= y1; ++y) {
+        const float* row = &m_depth[y * WIDTH];
+        for (int x = xStart; x <= x1; x += 4) {
+            __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m128 inRect = _mm_and_ps(_mm_cmpge_ps(px, first), _mm_cmple_ps(px, last));
+            __m128 inFront = _mm_cmple_ps(_mm_loadu_ps(row + x), boxDepth);
+            if (_mm_movemask_ps(_mm_and_ps(inRect, inFront))) {
+                return true;
+            }
+        }
+    }
+#else
+    for (int y = y0; y <= y1; ++y) {
+        const float* row = &m_depth[y * WIDTH];
+        for (int x = x0; x <= x1; ++x) {
+            if (row[x] <= nearestDepth) {
+                return true;
+            }
+        }
+    }
+#endif
+    return false;
+}
+
+void OcclusionCuller::run(const Frame& frame, Result& result) {
+    auto start = std::chrono::steady_clock::now();
+
+    beginFrame(frame.viewProjection, frame.cameraPos);
+    for (const Occluder& occluder : frame.occluders) {
+        addOccluder(occluder.chunkPos, occluder.shape);
+    }
+
+    result.hidden.clear();
+    for (const Candidate& candidate : frame.candidates) {
+        if (!isBoxVisible(candidate.min, candidate.max)) {
+            result.hidden.push_back(candidate.chunkPos);
+        }
+    }
+
+    result.cameraPos = frame.cameraPos;
+    result.cameraForward = frame.cameraForward;
+    result.tested = static_cast<int>(frame.candidates.size());
+    result.occluderQuads = m_occluderQuads;
+    result.milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void OcclusionCuller::submit(Frame&& frame) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingFrame = std::move(frame);
+        m_hasPendingFrame = true;
+        if (!m_worker.joinable()) {
+            m_worker = std::thread(&OcclusionCuller::workerLoop, this);
+        }
+    }
+    m_condition.notify_one();
+}
+
+bool OcclusionCuller::takeResult(Result& result) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_hasFinishedResult) {
+        return false;
+    }
+    std::swap(result, m_finishedResult);
+    m_hasFinishedResult = false;
+    return true;
+}
+
+bool OcclusionCuller::waitForResult(Result& result) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return !m_hasPendingFrame && !m_running; });
+    if (!m_hasFinishedResult) {
+        return false;
+    }
+    std::swap(result, m_finishedResult);
+    m_hasFinishedResult = false;
+    return true;
+}
+
+void OcclusionCuller::workerLoop() {
+    Frame frame;
+    Result result;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stop || m_hasPendingFrame; });
+            if (m_stop) {
+                return;
+            }
+            std::swap(frame, m_pendingFrame);
+            m_hasPendingFrame = false;
+            m_running = true;
+        }
+
+        run(frame, result);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::swap(m_finishedResult, result);
+            m_hasFinishedResult = true;
+            m_running = false;
+        }
+        m_condition.notify_all();  // Wakes waitForResult
+    }
+}
@@ -0,0 +1,126 @@
+#include "engine/graphics/ProgramBinaryCache.h"
+#include "engine/graphics/Shader.h"
+#include "engine/graphics/OpenGL.h"
+#include "utils/ModernCpp.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+// Hashes one key part, then a separator, so "ab"+"c" and "a"+"bc" differ
+uint64_t hashPart(uint64_t hash, const std::string& part) {
+    const char separator = '\0';
+    hash = Utils::fnv1a64(part.data(), part.size(), hash);
+    return Utils::fnv1a64(&separator, 1, hash);
+}
+
+std::string glString(GLenum name) {
+    const GLubyte* value = glGetString(name);
+    return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+} // namespace
+
+ProgramBinaryCache::ProgramBinaryCache(std::string directory)
+    : m_directory(std::move(directory)), m_checked(false), m_supported(false), m_hits(0), m_misses(0) {
+}
+
+bool ProgramBinaryCache::isSupported() {
+    if (!m_checked) {
+        m_checked = true;
+        GLint formats = 0;
+        if (Shader::supportsBinaries()) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        m_supported = formats > 0;
+        m_driver = glString(GL_VENDOR) + "|" + glString(GL_RENDERER) + "|" + glString(GL_VERSION);
+        if (!m_supported) {
+            std::cout << "ProgramBinaryCache: driver offers no program binary formats - shaders compile every launch" << std::endl;
+        }
+    }
+    return m_supported;
+}
+
+bool ProgramBinaryCache::load(Shader& shader, const std::string& vertexSource, const std::string& fragmentSource) {
+    if (!isSupported()) {
+        return false;
+    }
+
+    uint64_t key = makeKey(vertexSource, fragmentSource);
+    std::string path = pathFor(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        m_misses++;
+        return false;
+    }
+
+    Header header;
+    std::vector<uint8_t> binary;
+    bool valid = file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                 header.magic == MAGIC && header.version == VERSION && header.key == key &&
+                 header.length <= MAX_BINARY_SIZE;
+    if (valid) {
+        binary.resize(header.length);
+        valid = static_cast<bool>(file.read(reinterpret_cast<char*>(binary.data()), binary.size()));
+    }
+    file.close();
+
+    if (!valid || !shader.loadFromBinary(header.format, binary)) {
+        // Unreadable, or the driver no longer accepts it - compile again and replace it
+        std::remove(path.c_str());
+        m_misses++;
+        return false;
+    }
+    m_hits++;
+    return true;
+}
+
+void ProgramBinaryCache::store(const Shader& shader, const std::string& vertexSource, const std::string& fragmentSource) {
+    if (!isSupported()) {
+        return;
+    }
+
+    unsigned int format = 0;
+    std::vector<uint8_t> binary;
+    if (!shader.getBinary(format, binary)) {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+
+    uint64_t key = makeKey(vertexSource, fragmentSource);
+    std::string path = pathFor(key);
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        Header header{MAGIC, VERSION, format, static_cast<uint32_t>(binary.size()), key};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+        if (!file) {
+            std::cout << "ProgramBinaryCache: cannot write " << tempPath << std::endl;
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+    // Renamed into place, so a concurrent launch never reads half a binary
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::remove(tempPath.c_str());
+    }
+}
+
+uint64_t ProgramBinaryCache::makeKey(const std::string& vertexSource, const std::string& fragmentSource) const {
+    uint64_t hash = hashPart(Utils::fnv1a64(nullptr, 0), m_driver);
+    hash = hashPart(hash, vertexSource);
+    return hashPart(hash, fragmentSource);
+}
+
+std::string ProgramBinaryCache::pathFor(uint64_t key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return m_directory + "/" + name;
+}
@@ -38,6 +38,9 @@ bool Shader::loadFromString(const std::string& vertexSource, const std::string&
     m_program = glCreateProgram();
     glAttachShader(m_program, vertexShader);
     glAttachShader(m_program, fragmentShader);
+    if (supportsBinaries()) {
+        glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glLinkProgram(m_program);
     
     // Check for linking errors
@@ -62,6 +65,48 @@ bool Shader::loadFromString(const std::string& vertexSource, const std::string&
     return true;
 }
 
+bool Shader::loadFromBinary(unsigned int format, const std::vector<uint8_t>& binary) {
+    if (binary.empty() || !supportsBinaries()) {
+        return false;
+    }
+    
+    m_program = glCreateProgram();
+    glProgramBinary(m_program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+    
+    // A driver update or a different GPU makes old binaries fail here - not an error
+    int success;
+    glGetProgramiv(m_program, GL_LINK_STATUS, &success);
+    if (!success) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+        return false;
+    }
+    return true;
+}
+
+bool Shader::getBinary(unsigned int& format, std::vector<uint8_t>& binary) const {
+    if (!m_program || !supportsBinaries()) {
+        return false;
+    }
+    
+    int length = 0;
+    glGetProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return false;
+    }
+    binary.resize(length);
+    GLsizei written = 0;
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(m_program, length, &written, &binaryFormat, binary.data());
+    binary.resize(written);
+    format = binaryFormat;
+    return written > 0;
+}
+
+bool Shader::supportsBinaries() {
+    return GLEW_ARB_get_program_binary || GLEW_VERSION_4_1;
+}
+
 void Shader::use() const {
     if (m_program) {
         glUseProgram(m_program);
@@ -1,5 +1,6 @@
 #include "engine/graphics/SkyboxRenderer.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include "engine/AssetManager.h"
 #include <iostream>
 
@@ -117,6 +118,7 @@ void SkyboxRenderer::render(const glm::mat4& view, const glm::mat4& projection,
     // Render skybox cube
     glBindVertexArray(m_VAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
+    g_drawStats.recordTriangles(36);
     glBindVertexArray(0);
     
     // Set depth function back to default
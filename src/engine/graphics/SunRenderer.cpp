@@ -3,6 +3,7 @@
 #include "engine/graphics/Texture.h"
 #include "engine/AssetManager.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include <iostream>
 #include <cmath>
 
@@ -178,6 +179,7 @@ void SunRenderer::render(const glm::mat4& view, const glm::mat4& projection, flo
     // Render sun quad
     glBindVertexArray(m_VAO);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    g_drawStats.recordTriangles(6);
     glBindVertexArray(0);
     
     // Restore render state
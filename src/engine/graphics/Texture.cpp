@@ -1,10 +1,12 @@
 #include "engine/graphics/Texture.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/AssetBundle.h"
 
 // Using stb_image for image loading
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
 
+#include <algorithm>
 #include <iostream>
 
 Texture::Texture() 
@@ -18,31 +20,51 @@ Texture::~Texture() {
     }
 }
 
-bool Texture::loadFromFile(const std::string& filePath) {
-    // Set stb_image to flip loaded texture's on the y-axis (since OpenGL expects 0.0 coordinate on the bottom)
-    stbi_set_flip_vertically_on_load(true);
-    
-    unsigned char* data = stbi_load(filePath.c_str(), &m_width, &m_height, &m_channels, 0);
+bool Texture::decodeFile(const std::string& filePath, ImageData& image) {
+    // Always top row first - stb's flip switch is global state, unsafe with decodes on several threads
+    unsigned char* data = stbi_load(filePath.c_str(), &image.width, &image.height, &image.channels, 4);
     if (!data) {
         std::cout << "Failed to load texture: " << filePath << std::endl;
         std::cout << "STB Image error: " << stbi_failure_reason() << std::endl;
         return false;
     }
+    image.pixels.assign(data, data + static_cast<size_t>(image.width) * image.height * 4);
+    stbi_image_free(data);
+    return true;
+}
+
+bool Texture::loadFromFile(const std::string& filePath) {
+    ImageData image;
+    if (!decodeFile(filePath, image)) {
+        return false;
+    }
+    if (!loadFromImage(image)) {
+        return false;
+    }
     
-    bind();
+    std::cout << "Loaded texture: " << filePath << " (" << m_width << "x" << m_height << ", " << m_channels << " channels)" << std::endl;
+    return true;
+}
+
+bool Texture::loadFromImage(const ImageData& image) {
+    if (image.pixels.empty()) {
+        return false;
+    }
+    m_width = image.width;
+    m_height = image.height;
+    m_channels = image.channels;
     
-    // Determine format
-    GLenum format = GL_RGB;
-    if (m_channels == 1) {
-        format = GL_RED;
-    } else if (m_channels == 3) {
-        format = GL_RGB;
-    } else if (m_channels == 4) {
-        format = GL_RGBA;
+    // OpenGL expects the 0.0 texture coordinate at the bottom, so rows go bottom to top
+    const size_t rowBytes = static_cast<size_t>(m_width) * 4;
+    std::vector<unsigned char> flipped(image.pixels.size());
+    for (int row = 0; row < m_height; row++) {
+        std::copy_n(&image.pixels[row * rowBytes], rowBytes, &flipped[(m_height - 1 - row) * rowBytes]);
     }
     
-    // Upload texture data
-    glTexImage2D(GL_TEXTURE_2D, 0, format, m_width, m_height, 0, format, GL_UNSIGNED_BYTE, data);
+    bind();
+    
+    // Upload texture data - decoded images are always RGBA
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, flipped.data());
     glGenerateMipmap(GL_TEXTURE_2D);
     
     // Set texture parameters
@@ -52,11 +74,33 @@ bool Texture::loadFromFile(const std::string& filePath) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     
     unbind();
+    return true;
+}
+
+bool Texture::loadFromPacked(const PackedTexture& packed) {
+    if (!packed.pixels || packed.levels < 1) {
+        return false;
+    }
+    m_width = packed.width;
+    m_height = packed.height;
+    m_channels = 4;
     
-    // Free image data
-    stbi_image_free(data);
+    bind();
     
-    std::cout << "Loaded texture: " << filePath << " (" << m_width << "x" << m_height << ", " << m_channels << " channels)" << std::endl;
+    // Rows are already bottom to top and every level is baked, so each is a plain copy
+    for (int level = 0; level < packed.levels; level++) {
+        int levelWidth, levelHeight;
+        const uint8_t* pixels = packed.level(level, levelWidth, levelHeight);
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, levelWidth, levelHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, packed.levels - 1);
+    
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    
+    unbind();
     return true;
 }
 
@@ -3,7 +3,14 @@
 #include <stdexcept>
 #include <iostream>
 
-Window::Window(int width, int height, const char* title) {
+#ifdef HAVE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+Window::Window(int width, int height, const char* title)
+    : m_window(nullptr), m_headless(false), m_width(width), m_height(height), m_eglDisplay(nullptr),
+      m_eglContext(nullptr), m_framebuffer(0), m_colorBuffer(0), m_depthBuffer(0) {
     // Initialize GLFW if not already done
     if (!glfwInit()) {
         throw std::runtime_error("Failed to initialize GLFW");
@@ -45,42 +52,166 @@ Window::Window(int width, int height, const char* title) {
     std::cout << "Window created successfully: " << width << "x" << height << std::endl;
 }
 
+Window::Window(int width, int height, Headless)
+    : m_window(nullptr), m_headless(true), m_width(width), m_height(height), m_eglDisplay(nullptr),
+      m_eglContext(nullptr), m_framebuffer(0), m_colorBuffer(0), m_depthBuffer(0) {
+#ifdef HAVE_EGL
+    auto fail = [this](const char* message) {
+        if (m_eglContext) {
+            eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(m_eglDisplay, m_eglContext);
+        }
+        if (m_eglDisplay) {
+            eglTerminate(m_eglDisplay);
+        }
+        throw std::runtime_error(message);
+    };
+    
+    // Mesa's surfaceless platform needs no X11, Wayland or GPU - llvmpipe renders on the CPU
+    EGLDisplay display = EGL_NO_DISPLAY;
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        fail("Failed to initialize EGL");
+    }
+    m_eglDisplay = display;
+    
+    // Same version and profile as the window's context, with no surface at all
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    m_eglContext = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+    if (m_eglContext == EGL_NO_CONTEXT) {
+        m_eglContext = nullptr;
+        fail("Failed to create headless OpenGL context");
+    }
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_eglContext)) {
+        fail("Failed to make the headless context current");
+    }
+    
+    // GLEW built for GLX loads the entry points, then complains there is no X display
+    glewExperimental = GL_TRUE;
+    GLenum status = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (status == GLEW_ERROR_NO_GLX_DISPLAY) {
+        status = GLEW_OK;
+    }
+#endif
+    if (status != GLEW_OK) {
+        fail("Failed to initialize GLEW");
+    }
+    
+    // There is no default framebuffer - every pass draws into this one, which stays bound
+    glGenFramebuffers(1, &m_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+    glGenRenderbuffers(1, &m_colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorBuffer);
+    glGenRenderbuffers(1, &m_depthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fail("Headless framebuffer is incomplete");
+    }
+    
+    std::cout << "Headless context created: " << width << "x" << height << " - "
+              << glGetString(GL_RENDERER) << ", " << glGetString(GL_VERSION) << std::endl;
+#else
+    (void)width;
+    (void)height;
+    throw std::runtime_error("Headless mode needs EGL, and this build was made without it");
+#endif
+}
+
 Window::~Window() {
     if (m_window) {
         glfwDestroyWindow(m_window);
     }
+#ifdef HAVE_EGL
+    if (m_eglContext) {
+        glDeleteFramebuffers(1, &m_framebuffer);
+        glDeleteRenderbuffers(1, &m_colorBuffer);
+        glDeleteRenderbuffers(1, &m_depthBuffer);
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(m_eglDisplay, m_eglContext);
+    }
+    if (m_eglDisplay) {
+        eglTerminate(m_eglDisplay);
+    }
+#endif
+}
+
+void Window::readPixels(std::vector<uint8_t>& pixels) const {
+    int width, height;
+    getFramebufferSize(width, height);
+    pixels.resize(static_cast<size_t>(width) * height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
 }
 
 bool Window::shouldClose() const {
-    return glfwWindowShouldClose(m_window);
+    return !m_headless && glfwWindowShouldClose(m_window);
 }
 
 void Window::swapBuffers() {
+    if (m_headless) {
+        // Nothing to present - wait for the frame instead, so frame times include the rendering
+        glFinish();
+        return;
+    }
     glfwSwapBuffers(m_window);
 }
 
 void Window::pollEvents() {
+    if (m_headless) return;
     glfwPollEvents();
 }
 
+void Window::setTitle(const std::string& title) {
+    if (m_headless) return;
+    glfwSetWindowTitle(m_window, title.c_str());
+}
+
 void Window::setMouseCallback(void(*callback)(GLFWwindow*, double, double)) {
+    if (m_headless) return;
     glfwSetCursorPosCallback(m_window, callback);
 }
 
 void Window::setMouseButtonCallback(void(*callback)(GLFWwindow*, int, int, int)) {
+    if (m_headless) return;
     glfwSetMouseButtonCallback(m_window, callback);
 }
 
 void Window::enableMouseCapture() {
+    if (m_headless) return;
     glfwSetInputMode(m_window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 }
 
 void Window::disableMouseCapture() {
+    if (m_headless) return;
     glfwSetInputMode(m_window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 }
 
 // 📏 Window scalability methods
 void Window::getFramebufferSize(int& width, int& height) const {
+    if (m_headless) {
+        width = m_width;
+        height = m_height;
+        return;
+    }
     glfwGetFramebufferSize(m_window, &width, &height);
 }
 
@@ -91,5 +222,6 @@ float Window::getAspectRatio() const {
 }
 
 void Window::setFramebufferSizeCallback(void(*callback)(GLFWwindow*, int, int)) {
+    if (m_headless) return;
     glfwSetFramebufferSizeCallback(m_window, callback);
 }
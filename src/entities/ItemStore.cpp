@@ -0,0 +1,324 @@
+#include "entities/ItemStore.h"
+#include "world/ChunkView.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+const float GRAVITY = -9.81f;
+const float TERMINAL_VELOCITY = -10.0f;
+const float GROUND_FRICTION = 0.9f;
+const float AIR_RESISTANCE = 0.98f;
+const float SPIN_SPEED = 90.0f;   // Degrees per second
+const float BOB_SPEED = 2.0f;
+const float BOB_HEIGHT = 0.02f;
+const float ITEM_SIZE = 0.25f;
+
+// Block whose +-0.5 span holds a coordinate
+int blockOf(float coordinate) {
+    return static_cast<int>(std::floor(coordinate + 0.5f));
+}
+
+int cellOf(float coordinate) {
+    return static_cast<int>(std::floor(coordinate / ItemStore::CELL_SIZE));
+}
+
+} // namespace
+
+ItemStore::ItemStore()
+    : m_bucketMask(0)
+    , m_mergingEnabled(true) {
+}
+
+void ItemStore::spawn(const glm::vec3& position, BlockType type, int count) {
+    // Tossed up with some random horizontal spread
+    float randomX = ((rand() % 100) / 100.0f - 0.5f) * 0.5f;
+    float randomZ = ((rand() % 100) / 100.0f - 0.5f) * 0.5f;
+    spawn(position, glm::vec3(randomX, 0.2f, randomZ), type, count);
+}
+
+void ItemStore::spawn(const glm::vec3& position, const glm::vec3& velocity, BlockType type, int count) {
+    while (count > 0) {
+        int stack = std::min(count, MAX_STACK);
+        m_posX.push_back(position.x);
+        m_posY.push_back(position.y);
+        m_posZ.push_back(position.z);
+        m_velX.push_back(velocity.x);
+        m_velY.push_back(velocity.y);
+        m_velZ.push_back(velocity.z);
+        m_age.push_back(0.0f);
+        m_type.push_back(type);
+        m_count.push_back(static_cast<std::uint16_t>(stack));
+        m_onGround.push_back(0);
+        m_settled.push_back(0);
+        count -= stack;
+    }
+}
+
+void ItemStore::reserve(size_t capacity) {
+    for (std::vector<float>* component : {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ, &m_age}) {
+        component->reserve(capacity);
+    }
+    m_type.reserve(capacity);
+    m_count.reserve(capacity);
+    m_onGround.reserve(capacity);
+    m_settled.reserve(capacity);
+}
+
+void ItemStore::clear() {
+    for (std::vector<float>* component : {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ, &m_age}) {
+        component->clear();
+    }
+    m_type.clear();
+    m_count.clear();
+    m_onGround.clear();
+    m_settled.clear();
+    m_cellStart.clear();
+    m_cellItems.clear();
+}
+
+void ItemStore::update(float deltaTime, ChunkView& view) {
+    applyPhysics(deltaTime, view);
+    buildSpatialHash();
+
+    if (m_mergingEnabled) {
+        mergeStacks();
+    }
+}
+
+void ItemStore::applyPhysics(float deltaTime, ChunkView& view) {
+    const float half = ITEM_SIZE * 0.5f;
+    const size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        m_age[i] += deltaTime;
+
+        glm::vec3 position = getPosition(i);
+        if (!view.getChunkAt(blockOf(position.x), blockOf(position.z))) {
+            continue;  // Chunk not ready - hold still rather than fall through it
+        }
+
+        if (m_onGround[i] && m_velX[i] == 0.0f && m_velZ[i] == 0.0f) {
+            // ⚡ At rest: only check something still holds it up - the block under
+            // its centre, or failing that any block under its footprint
+            BlockType below = BlockType::AIR;
+            view.getBlock(blockOf(position.x), blockOf(position.y - half - 0.01f), blockOf(position.z), below);
+            if (VoxelCollider::isSolid(below)) continue;
+            AABB support{position - half - glm::vec3(0.0f, 0.01f, 0.0f), position + half};
+            if (m_collider.intersects(view, support)) continue;
+            m_onGround[i] = 0;
+        }
+
+        glm::vec3 velocity = getVelocity(i);
+        velocity.y = std::max(velocity.y + GRAVITY * deltaTime, TERMINAL_VELOCITY);
+        if (m_onGround[i]) {
+            velocity.x *= GROUND_FRICTION;
+            velocity.z *= GROUND_FRICTION;
+            if (velocity.x * velocity.x + velocity.z * velocity.z < 0.01f * 0.01f) {
+                velocity.x = 0.0f;
+                velocity.z = 0.0f;
+            }
+        } else {
+            velocity.x *= AIR_RESISTANCE;
+            velocity.z *= AIR_RESISTANCE;
+        }
+
+        AABB box{position - half, position + half};
+        CollisionResult result = m_collider.move(view, box, velocity * deltaTime);
+        if (result.collidedX) velocity.x = 0.0f;
+        if (result.collidedY) velocity.y = 0.0f;
+        if (result.collidedZ) velocity.z = 0.0f;
+        m_onGround[i] = result.onGround ? 1 : 0;
+        m_settled[i] = 0;
+
+        position = box.center();
+        m_posX[i] = position.x;
+        m_posY[i] = position.y;
+        m_posZ[i] = position.z;
+        m_velX[i] = velocity.x;
+        m_velY[i] = velocity.y;
+        m_velZ[i] = velocity.z;
+    }
+}
+
+std::uint32_t ItemStore::bucketFor(int cellX, int cellY, int cellZ) const {
+    std::uint32_t hash = (static_cast<std::uint32_t>(cellX) * 73856093u) ^
+                         (static_cast<std::uint32_t>(cellY) * 19349663u) ^
+                         (static_cast<std::uint32_t>(cellZ) * 83492791u);
+    return hash & m_bucketMask;
+}
+
+void ItemStore::buildSpatialHash() {
+    const size_t count = size();
+
+    // Twice as many buckets as items keeps most buckets to one cell
+    std::uint32_t buckets = 64;
+    while (buckets < count * 2) {
+        buckets <<= 1;
+    }
+    m_bucketMask = buckets - 1;
+
+    // ⚡ Counting sort by bucket - count, sum to each bucket's end, then fill
+    // backwards so every end walks down to its bucket's start. No extra arrays.
+    m_bucketOf.resize(count);
+    m_cellStart.assign(buckets + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        m_bucketOf[i] = bucketFor(cellOf(m_posX[i]), cellOf(m_posY[i]), cellOf(m_posZ[i]));
+        m_cellStart[m_bucketOf[i]]++;
+    }
+    for (size_t bucket = 1; bucket <= buckets; ++bucket) {
+        m_cellStart[bucket] += m_cellStart[bucket - 1];
+    }
+    m_cellItems.resize(count);
+    for (size_t i = count; i-- > 0;) {
+        m_cellItems[--m_cellStart[m_bucketOf[i]]] = static_cast<int>(i);
+    }
+}
+
+void ItemStore::query(const glm::vec3& point, float radius, std::vector<int>& result) const {
+    result.clear();
+    if (m_cellStart.empty()) return;
+
+    const int minX = cellOf(point.x - radius), maxX = cellOf(point.x + radius);
+    const int minY = cellOf(point.y - radius), maxY = cellOf(point.y + radius);
+    const int minZ = cellOf(point.z - radius), maxZ = cellOf(point.z + radius);
+
+    // A radius up to one cell spans at most three cells per axis - larger ones go to the heap
+    const size_t cellCount = static_cast<size_t>(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+    std::uint32_t localVisited[27];
+    std::vector<std::uint32_t> heapVisited;
+    std::uint32_t* visited = localVisited;
+    if (cellCount > 27) {
+        heapVisited.resize(cellCount);
+        visited = heapVisited.data();
+    }
+    int visitedCount = 0;
+    const float radiusSquared = radius * radius;
+
+    for (int cx = minX; cx <= maxX; ++cx) {
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cz = minZ; cz <= maxZ; ++cz) {
+                // Cells that collide into one bucket would list its items twice
+                std::uint32_t bucket = bucketFor(cx, cy, cz);
+                if (std::find(visited, visited + visitedCount, bucket) != visited + visitedCount) continue;
+                visited[visitedCount++] = bucket;
+
+                for (int slot = m_cellStart[bucket]; slot < m_cellStart[bucket + 1]; ++slot) {
+                    int i = m_cellItems[slot];
+                    float dx = m_posX[i] - point.x, dy = m_posY[i] - point.y, dz = m_posZ[i] - point.z;
+                    if (dx * dx + dy * dy + dz * dz <= radiusSquared) {
+                        result.push_back(i);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ItemStore::mergeStacks() {
+    const size_t count = size();
+    m_removed.assign(count, 0);
+    bool anyRemoved = false;
+    std::vector<int> nearby;
+
+    // Only resting stacks merge, so falling drops keep their own paths
+    for (size_t i = 0; i < count; ++i) {
+        if (m_settled[i] || m_removed[i] || !m_onGround[i]) continue;
+        m_settled[i] = 1;
+        if (m_count[i] >= MAX_STACK) continue;
+
+        query(getPosition(i), MERGE_RADIUS, nearby);
+        for (int j : nearby) {
+            if (static_cast<size_t>(j) == i || m_removed[j] || !m_onGround[j] || m_type[j] != m_type[i]) continue;
+
+            int moved = std::min<int>(m_count[j], MAX_STACK - m_count[i]);
+            m_count[i] = static_cast<std::uint16_t>(m_count[i] + moved);
+            m_count[j] = static_cast<std::uint16_t>(m_count[j] - moved);
+            if (m_count[j] == 0) {
+                m_removed[j] = 1;
+                anyRemoved = true;
+            }
+            if (m_count[i] >= MAX_STACK) break;
+        }
+    }
+
+    if (anyRemoved) {
+        removeMarked();
+        buildSpatialHash();
+    }
+}
+
+int ItemStore::collect(const glm::vec3& point, const TakeFunction& take) {
+    std::vector<int> nearby;
+    query(point, COLLECTION_RADIUS, nearby);
+
+    int taken = 0;
+    bool anyRemoved = false;
+    m_removed.assign(size(), 0);
+    for (int i : nearby) {
+        if (m_age[i] <= PICKUP_DELAY) continue;
+
+        int accepted = std::min<int>(take(m_type[i], m_count[i]), m_count[i]);
+        if (accepted <= 0) continue;
+        taken += accepted;
+        m_count[i] = static_cast<std::uint16_t>(m_count[i] - accepted);
+        if (m_count[i] == 0) {
+            m_removed[i] = 1;
+            anyRemoved = true;
+        }
+    }
+
+    if (anyRemoved) {
+        removeMarked();
+        buildSpatialHash();
+    }
+    return taken;
+}
+
+void ItemStore::removeMarked() {
+    // Swap-and-pop: order doesn't matter, so nothing after a removal shifts
+    size_t count = size();
+    for (size_t i = 0; i < count;) {
+        if (!m_removed[i]) {
+            ++i;
+            continue;
+        }
+        size_t last = --count;
+        m_posX[i] = m_posX[last]; m_posY[i] = m_posY[last]; m_posZ[i] = m_posZ[last];
+        m_velX[i] = m_velX[last]; m_velY[i] = m_velY[last]; m_velZ[i] = m_velZ[last];
+        m_age[i] = m_age[last];
+        m_type[i] = m_type[last];
+        m_count[i] = m_count[last];
+        m_onGround[i] = m_onGround[last];
+        m_settled[i] = m_settled[last];
+        m_removed[i] = m_removed[last];
+    }
+    for (std::vector<float>* component : {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ, &m_age}) {
+        component->resize(count);
+    }
+    m_type.resize(count);
+    m_count.resize(count);
+    m_onGround.resize(count);
+    m_settled.resize(count);
+    m_removed.resize(count);
+}
+
+int ItemStore::getItemCount() const {
+    int total = 0;
+    for (std::uint16_t stack : m_count) {
+        total += stack;
+    }
+    return total;
+}
+
+glm::mat4 ItemStore::getModelMatrix(size_t i) const {
+    float bob = m_onGround[i] ? std::sin(m_age[i] * BOB_SPEED) * BOB_HEIGHT : 0.0f;
+    float spin = std::fmod(m_age[i] * SPIN_SPEED, 360.0f);
+
+    glm::mat4 model = glm::mat4(1.0f);
+    model = glm::translate(model, getPosition(i) + glm::vec3(0.0f, bob, 0.0f));
+    model = glm::rotate(model, glm::radians(spin), glm::vec3(0.0f, 1.0f, 0.0f));
+    model = glm::scale(model, glm::vec3(ITEM_SIZE));
+    return model;
+}
@@ -1,14 +1,65 @@
 #include "core/Game.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const char* USAGE =
+    "Usage: MinecraftClone [--headless [--frames N] [--size WxH] [--path orbit|flyover] [--checksum F1,F2,...]]\n"
+    "  --headless  render offscreen (EGL, no display needed) along a scripted camera path and print frame statistics\n"
+    "  --frames    measured frames, default 600\n"
+    "  --size      framebuffer size, default 1280x720\n"
+    "  --path      orbit turns on the spot, flyover streams new chunks in; default orbit\n"
+    "  --checksum  frames whose pixels are hashed and printed - orbit runs repeat them exactly, flyover streams chunks and may not\n";
+
+bool parseArguments(int argc, char** argv, HeadlessOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            options.enabled = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && hasValue) {
+            options.frames = std::atoi(argv[++i]);
+            if (options.frames < 1) return false;
+        } else if (std::strcmp(argv[i], "--size") == 0 && hasValue) {
+            if (std::sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 ||
+                options.width < 1 || options.height < 1) {
+                return false;
+            }
+        } else if (std::strcmp(argv[i], "--path") == 0 && hasValue) {
+            if (!CameraPath::parse(argv[++i], options.path)) return false;
+        } else if (std::strcmp(argv[i], "--checksum") == 0 && hasValue) {
+            std::stringstream list(argv[++i]);
+            std::string frame;
+            while (std::getline(list, frame, ',')) {
+                options.checksumFrames.push_back(std::atoi(frame.c_str()));
+            }
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    HeadlessOptions headless;
+    if (!parseArguments(argc, argv, headless)) {
+        std::cerr << USAGE;
+        return 1;
+    }
 
-int main() {
     try {
-        Game game;
+        Game game(headless);
         game.run();
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return -1;
     }
-    
+
     return 0;
 }
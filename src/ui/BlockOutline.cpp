@@ -1,6 +1,7 @@
 #include "ui/BlockOutline.h"
 #include "engine/graphics/Shader.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include "engine/graphics/Camera.h"
 #include "world/World.h"
 #include "world/Chunk.h"
@@ -165,6 +166,7 @@ void BlockOutline::render(const glm::mat4& view, const glm::mat4& projection, co
     
     glBindVertexArray(m_VAO);
     glDrawElements(GL_LINES, INDEX_COUNT, GL_UNSIGNED_INT, 0);
+    g_drawStats.recordOther();
     glBindVertexArray(0);
     
     glLineWidth(1.0f);
@@ -1,87 +1,26 @@
 #include "ui/LoadingScreen.h"
-#include "engine/graphics/Shader.h"
-#include "engine/graphics/OpenGL.h"
-#include <glm/gtc/matrix_transform.hpp>
-#include <iostream>
+#include "ui/UIBatch.h"
 
-LoadingScreen::LoadingScreen() {
+LoadingScreen::LoadingScreen() : m_batch(nullptr) {
 }
 
 LoadingScreen::~LoadingScreen() {
-    // RAII handles cleanup automatically
 }
 
-bool LoadingScreen::initialize() {
-    // Create shader for simple 2D rendering
-    m_shader = std::make_unique<Shader>();
-    
-    const char* vertexShaderSource = R"(
-        #version 330 core
-        layout (location = 0) in vec2 aPos;
-        
-        uniform mat4 projection;
-        
-        void main() {
-            gl_Position = projection * vec4(aPos, 0.0, 1.0);
-        }
-    )";
-    
-    const char* fragmentShaderSource = R"(
-        #version 330 core
-        out vec4 FragColor;
-        
-        uniform vec3 color;
-        
-        void main() {
-            FragColor = vec4(color, 1.0);
-        }
-    )";
-    
-    if (!m_shader->loadFromString(vertexShaderSource, fragmentShaderSource)) {
-        std::cerr << "Failed to compile loading screen shader" << std::endl;
-        return false;
-    }
-    
-    // VAO and VBO are automatically generated in their constructors
-    m_vao.bind();
-    m_vbo.bind(GL_ARRAY_BUFFER);
-    
-    // Enable position attribute
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    m_vao.unbind();
-    
+bool LoadingScreen::initialize(UIBatch& batch) {
+    // Flat quads and the batch's dotted digit glyphs - nothing to add to the atlas
+    m_batch = &batch;
     return true;
 }
 
 void LoadingScreen::render(int windowWidth, int windowHeight, int chunksLoaded, int totalChunks, const std::string& status) {
-    // Set up orthographic projection for 2D rendering
-    glm::mat4 projection = glm::ortho(0.0f, (float)windowWidth, (float)windowHeight, 0.0f);
-    
-    // Disable depth testing for overlay
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    m_shader->use();
-    m_shader->setMat4("projection", projection);
+    if (!m_batch) {
+        return;
+    }
     
-    // Draw semi-transparent dark background
+    // Draw dark background
     glm::vec3 backgroundColor(0.0f, 0.0f, 0.0f);
-    m_shader->setVec3("color", backgroundColor);
-    
-    float vertices[] = {
-        0.0f, 0.0f,
-        (float)windowWidth, 0.0f,
-        (float)windowWidth, (float)windowHeight,
-        0.0f, (float)windowHeight
-    };
-    
-    m_vao.bind();
-    m_vbo.bind(GL_ARRAY_BUFFER);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    renderRect(0.0f, 0.0f, (float)windowWidth, (float)windowHeight, backgroundColor, windowHeight);
     
     // Colors
     glm::vec3 whiteColor(1.0f, 1.0f, 1.0f);
@@ -135,47 +74,24 @@ void LoadingScreen::render(int windowWidth, int windowHeight, int chunksLoaded,
     int percentage = (int)(progress * 100.0f);
     std::string percentText = std::to_string(percentage) + "%";
     renderCenteredText(percentText, centerY, 2.0f, greenColor, windowWidth, windowHeight);
-    
-    // Restore OpenGL state
-    glEnable(GL_DEPTH_TEST);
-    glDisable(GL_BLEND);
 }
 
 void LoadingScreen::renderProgressBar(float x, float y, float width, float height, float progress, int windowWidth, int windowHeight) {
     // Background bar (gray)
     glm::vec3 grayColor(0.3f, 0.3f, 0.3f);
-    m_shader->setVec3("color", grayColor);
-    
-    float bgVertices[] = {
-        x, y,
-        x + width, y,
-        x + width, y + height,
-        x, y + height
-    };
-    
-    m_vao.bind();
-    m_vbo.bind(GL_ARRAY_BUFFER);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(bgVertices), bgVertices, GL_DYNAMIC_DRAW);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    renderRect(x, y, width, height, grayColor, windowHeight);
     
     // Progress bar (green)
     if (progress > 0.0f) {
         glm::vec3 greenColor(0.0f, 1.0f, 0.0f);
-        m_shader->setVec3("color", greenColor);
-        
-        float progressWidth = width * progress;
-        float fgVertices[] = {
-            x, y,
-            x + progressWidth, y,
-            x + progressWidth, y + height,
-            x, y + height
-        };
-        
-        glBufferData(GL_ARRAY_BUFFER, sizeof(fgVertices), fgVertices, GL_DYNAMIC_DRAW);
-        glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+        renderRect(x, y, width * progress, height, greenColor, windowHeight);
     }
 }
 
+void LoadingScreen::renderRect(float x, float y, float width, float height, const glm::vec3& color, int windowHeight) {
+    m_batch->rect(glm::vec2(x, windowHeight - y - height), glm::vec2(width, height), glm::vec4(color, 1.0f));
+}
+
 void LoadingScreen::renderText(const std::string& text, float x, float y, float scale, const glm::vec3& color, int windowWidth, int windowHeight) {
     float currentX = x;
     for (char c : text) {
@@ -224,34 +140,11 @@ void LoadingScreen::renderNumber(int number, float x, float y, float scale, cons
 void LoadingScreen::renderDigit(int digit, float x, float y, float scale, const glm::vec3& color, int windowWidth, int windowHeight) {
     if (digit < 0 || digit > 9) return;
     
-    m_shader->setVec3("color", color);
-    
-    m_vao.bind();
-    
-    // Render each pixel of the digit
-    for (int row = 0; row < 7; row++) {
-        for (int col = 0; col < 5; col++) {
-            if (UI::getDigitPixel(digit, col, row)) {
-                float pixelX = x + col * 4.0f * scale;
-                float pixelY = y + row * 4.0f * scale;
-                float pixelSize = 3.0f * scale;
-                
-                float vertices[] = {
-                    pixelX, pixelY,
-                    pixelX + pixelSize, pixelY,
-                    pixelX + pixelSize, pixelY + pixelSize,
-                    pixelX, pixelY + pixelSize
-                };
-                
-                m_vbo.bind(GL_ARRAY_BUFFER);
-                glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-                glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-            }
-        }
-    }
+    // One glyph quad: 3x3 dots on a 4-pixel pitch, scaled
+    float glyphHeight = UIBatch::glyphSize(UIBatch::Font::DOTTED).y * scale;
+    m_batch->digit(UIBatch::Font::DOTTED, digit, glm::vec2(x, windowHeight - y - glyphHeight), scale, glm::vec4(color, 1.0f));
 }
 
 void LoadingScreen::cleanup() {
-    // RAII handles OpenGL resource cleanup automatically
-    m_shader.reset();
+    m_batch = nullptr;
 }
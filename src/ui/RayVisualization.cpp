@@ -1,6 +1,7 @@
 #include "ui/RayVisualization.h"
 #include "engine/graphics/Shader.h"
 #include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -146,6 +147,7 @@ void RayVisualization::render(const glm::mat4& view, const glm::mat4& projection
     
     glBindVertexArray(m_VAO);
     glDrawArrays(GL_LINES, 0, 2);
+    g_drawStats.recordOther();
     glBindVertexArray(0);
     
     // Restore previous line width and depth test
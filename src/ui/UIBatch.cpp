@@ -0,0 +1,290 @@
+#include "ui/UIBatch.h"
+#include "ui/DigitRenderer.h"
+#include "engine/AssetManager.h"
+#include "engine/graphics/Shader.h"
+#include "engine/graphics/Texture.h"
+#include "engine/graphics/OpenGL.h"
+#include "engine/graphics/DrawStats.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+namespace {
+
+constexpr int ATLAS_WIDTH = 1024;
+constexpr int ATLAS_PADDING = 1;   // Transparent texels between images so none bleeds into its neighbour
+
+// Dotted glyphs: each pattern pixel is a 3x3 dot in a 4x4 cell
+constexpr int DOT_CELL = 4;
+constexpr int DOT_SIZE = 3;
+
+// An RGBA image waiting for its place in the atlas
+struct AtlasImage {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+    int x = 0;
+    int y = 0;
+};
+
+AtlasImage bakeGlyph(UIBatch::Font font, int digit) {
+    AtlasImage image;
+    bool dotted = font == UIBatch::Font::DOTTED;
+    int cell = dotted ? DOT_CELL : 1;
+    image.width = UI::DIGIT_WIDTH * cell;
+    image.height = UI::DIGIT_HEIGHT * cell;
+    image.pixels.assign(image.width * image.height * 4, 0);
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            int col = x / cell, row = y / cell;
+            bool lit = dotted ? UI::getDigitPixel(digit, col, row) : UI::getBoldDigitPixel(digit, col, row);
+            if (dotted && (x % cell >= DOT_SIZE || y % cell >= DOT_SIZE)) lit = false;
+            if (lit) std::fill_n(&image.pixels[(x + y * image.width) * 4], 4, uint8_t(255));
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+UIBatch::UIBatch()
+    : m_VAO(0), m_VBO(0), m_EBO(0), m_atlas(0), m_initialized(false), m_lastQuads(0), m_lastDraws(0) {
+}
+
+UIBatch::~UIBatch() {
+    cleanup();
+}
+
+void UIBatch::addImage(const std::string& path) {
+    if (std::find(m_imagePaths.begin(), m_imagePaths.end(), path) == m_imagePaths.end()) {
+        m_imagePaths.push_back(path);
+    }
+}
+
+bool UIBatch::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    m_shader = AssetManager::getInstance().loadShader("assets/shaders/ui.vert", "assets/shaders/ui.frag");
+    if (!m_shader) {
+        std::cout << "Failed to create UI shader!" << std::endl;
+        return false;
+    }
+
+    // Everything the atlas will hold: the added images, a white block, then the glyphs
+    std::vector<AtlasImage> images;
+    std::vector<std::string> loadedPaths;
+    for (const auto& path : m_imagePaths) {
+        // Usually decoded on a worker thread by AssetManager::preloadAssets already
+        auto decoded = AssetManager::getInstance().loadImage(path);
+        if (!decoded) {
+            std::cout << "Failed to load UI image: " << path << std::endl;
+            continue;
+        }
+        if (decoded->width > ATLAS_WIDTH) {
+            // Would run past its row of the atlas - draws nothing, like an image that failed to load
+            std::cout << "UI image too wide for the atlas (" << decoded->width << " > " << ATLAS_WIDTH
+                      << " px), skipping: " << path << std::endl;
+            continue;
+        }
+        AtlasImage image;
+        image.width = decoded->width;
+        image.height = decoded->height;
+        image.pixels = decoded->pixels;
+        images.push_back(std::move(image));
+        loadedPaths.push_back(path);
+    }
+    const size_t whiteIndex = images.size();
+    AtlasImage white;
+    white.width = white.height = 2;  // Sampled in its middle, well clear of the padding
+    white.pixels.assign(white.width * white.height * 4, 255);
+    images.push_back(std::move(white));
+    const size_t glyphIndex = images.size();
+    for (int font = 0; font < 2; font++) {
+        for (int d = 0; d < 10; d++) {
+            images.push_back(bakeGlyph(static_cast<Font>(font), d));
+        }
+    }
+
+    // Shelf packing, tallest first
+    std::vector<size_t> order(images.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return images[a].height > images[b].height; });
+    int shelfX = 0, shelfY = 0, shelfHeight = 0;
+    for (size_t i : order) {
+        AtlasImage& image = images[i];
+        if (shelfX + image.width > ATLAS_WIDTH) {
+            shelfX = 0;
+            shelfY += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        image.x = shelfX;
+        image.y = shelfY;
+        shelfX += image.width + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, image.height);
+    }
+    int atlasHeight = 1;
+    while (atlasHeight < shelfY + shelfHeight) atlasHeight *= 2;
+
+    std::vector<uint8_t> atlas(ATLAS_WIDTH * atlasHeight * 4, 0);
+    auto place = [&](const AtlasImage& image) {
+        for (int row = 0; row < image.height; row++) {
+            std::copy_n(&image.pixels[row * image.width * 4], image.width * 4,
+                        &atlas[((image.y + row) * ATLAS_WIDTH + image.x) * 4]);
+        }
+        Sprite sprite;
+        sprite.uvMin = glm::vec2(image.x / float(ATLAS_WIDTH), image.y / float(atlasHeight));
+        sprite.uvMax = glm::vec2((image.x + image.width) / float(ATLAS_WIDTH), (image.y + image.height) / float(atlasHeight));
+        return sprite;
+    };
+    for (size_t i = 0; i < loadedPaths.size(); i++) {
+        m_sprites[loadedPaths[i]] = place(images[i]);
+    }
+    m_white = place(images[whiteIndex]);
+    for (int font = 0; font < 2; font++) {
+        for (int d = 0; d < 10; d++) {
+            m_glyphs[font][d] = place(images[glyphIndex + font * 10 + d]);
+        }
+    }
+
+    glGenTextures(1, &m_atlas);
+    glBindTexture(GL_TEXTURE_2D, m_atlas);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, ATLAS_WIDTH, atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, atlas.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Every quad is two triangles over its four vertices, so one index buffer serves any batch
+    std::vector<unsigned int> indices(MAX_QUADS * 6);
+    for (unsigned int q = 0; q < MAX_QUADS; q++) {
+        const unsigned int quadIndices[] = {0, 1, 2, 2, 3, 0};
+        for (int i = 0; i < 6; i++) indices[q * 6 + i] = q * 4 + quadIndices[i];
+    }
+
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
+
+    glBindVertexArray(m_VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, MAX_QUADS * 4 * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+    // Position, texture coordinates, colour
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    glEnableVertexAttribArray(2);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    std::cout << "UI atlas: " << loadedPaths.size() << " images and 20 digit glyphs in "
+              << ATLAS_WIDTH << "x" << atlasHeight << std::endl;
+    m_initialized = true;
+    return true;
+}
+
+const UIBatch::Sprite* UIBatch::findSprite(const std::string& path) const {
+    auto it = m_sprites.find(path);
+    return it != m_sprites.end() ? &it->second : nullptr;
+}
+
+void UIBatch::quad(const glm::vec2& position, const glm::vec2& size, const Sprite& sprite, const glm::vec4& color) {
+    // Bottom-left origin on screen, top-left in the atlas
+    const glm::vec2 lo = position, hi = position + size;
+    m_vertices.push_back({glm::vec2(lo.x, lo.y), glm::vec2(sprite.uvMin.x, sprite.uvMax.y), color});
+    m_vertices.push_back({glm::vec2(hi.x, lo.y), glm::vec2(sprite.uvMax.x, sprite.uvMax.y), color});
+    m_vertices.push_back({glm::vec2(hi.x, hi.y), glm::vec2(sprite.uvMax.x, sprite.uvMin.y), color});
+    m_vertices.push_back({glm::vec2(lo.x, hi.y), glm::vec2(sprite.uvMin.x, sprite.uvMin.y), color});
+}
+
+void UIBatch::rect(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
+    quad(position, size, m_white, color);
+}
+
+void UIBatch::digit(Font font, int digit, const glm::vec2& position, float texelSize, const glm::vec4& color) {
+    if (digit < 0 || digit > 9) return;
+    quad(position, glyphSize(font) * texelSize, m_glyphs[static_cast<int>(font)][digit], color);
+}
+
+glm::vec2 UIBatch::glyphSize(Font font) {
+    int cell = font == Font::DOTTED ? DOT_CELL : 1;
+    return glm::vec2(UI::DIGIT_WIDTH * cell, UI::DIGIT_HEIGHT * cell);
+}
+
+void UIBatch::flush(int screenWidth, int screenHeight) {
+    const size_t quads = m_vertices.size() / 4;
+    m_lastQuads = static_cast<int>(quads);
+    m_lastDraws = 0;
+    if (!m_initialized || quads == 0) {
+        m_vertices.clear();
+        return;
+    }
+
+    // Enable blending for transparency
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_DEPTH_TEST);  // UI elements should be on top
+
+    m_shader->use();
+    m_shader->setMat4("projection", glm::ortho(0.0f, (float)screenWidth, 0.0f, (float)screenHeight));
+    m_shader->setInt("uiAtlas", 0);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_atlas);
+    glBindVertexArray(m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    // ⚡ One draw per MAX_QUADS quads - a single one for any normal frame
+    for (size_t first = 0; first < quads; first += MAX_QUADS) {
+        size_t count = std::min<size_t>(MAX_QUADS, quads - first);
+        // Orphan the buffer rather than wait for the GPU to finish reading the last part
+        glBufferData(GL_ARRAY_BUFFER, MAX_QUADS * 4 * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * 4 * sizeof(Vertex), &m_vertices[first * 4]);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count * 6), GL_UNSIGNED_INT, 0);
+        m_lastDraws++;
+        g_drawStats.recordTriangles(count * 6);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glEnable(GL_DEPTH_TEST);  // Re-enable depth testing
+    glDisable(GL_BLEND);
+
+    m_vertices.clear();
+}
+
+void UIBatch::cleanup() {
+    if (m_VAO != 0) {
+        glDeleteVertexArrays(1, &m_VAO);
+        m_VAO = 0;
+    }
+    if (m_VBO != 0) {
+        glDeleteBuffers(1, &m_VBO);
+        m_VBO = 0;
+    }
+    if (m_EBO != 0) {
+        glDeleteBuffers(1, &m_EBO);
+        m_EBO = 0;
+    }
+    if (m_atlas != 0) {
+        glDeleteTextures(1, &m_atlas);
+        m_atlas = 0;
+    }
+    m_sprites.clear();
+    m_vertices.clear();
+    m_shader.reset();
+    m_initialized = false;
+}
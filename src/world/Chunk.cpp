@@ -6,76 +6,174 @@
 #include <iostream>
 #include <chrono>
 
-Chunk::Chunk(const glm::ivec2& position, ModularWorldGenerator* terrainGen, bool autoGenerate) 
+namespace {
+
+// Heightfield side walls: surface material this deep, stone below
+constexpr int HEIGHTFIELD_SOIL_DEPTH = 3;
+// Chunk-edge walls reach this far below the lowest column, hiding cracks
+// against neighbours of a different height or detail level
+constexpr int HEIGHTFIELD_SKIRT_DEPTH = 4;
+
+// Axis and sign of each face direction, in addFaceToMesh order (+Z, -Z, -X, +X, +Y, -Y)
+constexpr int FACE_AXIS[ChunkFacePlanes::FACE_COUNT] = {2, 2, 0, 0, 1, 1};
+constexpr bool FACE_POSITIVE[ChunkFacePlanes::FACE_COUNT] = {true, false, false, true, true, false};
+
+int getFaceDirection(const glm::vec3& normal) {
+    if (normal.z > 0.5f) return 0;
+    if (normal.z < -0.5f) return 1;
+    if (normal.x < -0.5f) return 2;
+    if (normal.x > 0.5f) return 3;
+    return normal.y > 0.5f ? 4 : 5;
+}
+
+} // namespace
+
+Chunk::Chunk(const glm::ivec2& position, ModularWorldGenerator* terrainGen, bool autoGenerate, ChunkDetail detail) 
     : m_position(position)
     , m_needsRebuild(true)
-    , m_terrainGenerator(terrainGen) {
-    
-    
-    m_blockTypes.resize(CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE, BlockType::AIR);
-    
-    
-    m_blocks.resize(CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE);
-    
-    
-    m_mesh = std::make_unique<Mesh>();
+    , m_terrainGenerator(terrainGen)
+    , m_detail(detail) {
     
-    m_waterMesh = std::make_unique<Mesh>();
-    
-    m_oakMesh = std::make_unique<Mesh>();
-    
-    m_leavesMesh = std::make_unique<Mesh>();
-    
-    m_stoneMesh = std::make_unique<Mesh>();
+    // ⚡ MEMORY: Far chunks keep ~1KB of columns instead of the full voxel arrays
+    if (m_detail == ChunkDetail::HEIGHTFIELD) {
+        m_heightfield = std::make_unique<ChunkHeightfield>();
+    } else {
+        m_blockTypes.resize(CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE, BlockType::AIR);
+        m_blocks.resize(CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE);
+        m_occupancy = std::make_unique<ChunkOccupancy>();
+    }
     
-    m_gravelMesh = std::make_unique<Mesh>();
     
-    m_sandMesh = std::make_unique<Mesh>();
+    // GPU meshes are created on first upload (ChunkMeshUpload.cpp)
     
-    // Initialize mesh building flag
     if (autoGenerate) {
         generate();
     }
 }
 
 
-void Chunk::drawWaterMesh() const {
-    if (m_waterMesh) {
-        m_waterMesh->render();
+int ChunkMeshData::getLayer(BlockType blockType) {
+    switch (blockType) {
+        case BlockType::WATER:   return WATER;
+        case BlockType::OAK_LOG: return OAK;
+        case BlockType::LEAVES:  return LEAVES;
+        case BlockType::STONE:   return STONE;
+        case BlockType::GRAVEL:  return GRAVEL;
+        case BlockType::SAND:    return SAND;
+        default:                 return SOLID;
     }
 }
 
-
-void Chunk::drawOakMesh() const {
-    if (m_oakMesh) {
-        m_oakMesh->render();
+void ChunkMeshData::computeBounds() {
+    bool empty = true;
+    for (const std::vector<Vertex>& layer : vertices) {
+        for (const Vertex& vertex : layer) {
+            minY = empty ? vertex.position.y : std::min(minY, vertex.position.y);
+            maxY = empty ? vertex.position.y : std::max(maxY, vertex.position.y);
+            empty = false;
+        }
     }
+    if (empty) {
+        minY = maxY = -0.5f;
+        return;
+    }
+    
+    // Widened to whole 4-block cells: a downsampled face lies on the boundary of a
+    // cell holding full-detail geometry, so the coarsest LOD stays inside too
+    constexpr float CELL = 4.0f;
+    minY = std::floor((minY + 0.5f) / CELL) * CELL - 0.5f;
+    maxY = std::ceil((maxY + 0.5f) / CELL) * CELL - 0.5f;
 }
 
-void Chunk::drawLeavesMesh() const {
-    if (m_leavesMesh) {
-        m_leavesMesh->render();
+void ChunkMeshData::groupByFace() {
+    constexpr int FACE_COUNT = ChunkFacePlanes::FACE_COUNT;
+    for (int face = 0; face < FACE_COUNT; ++face) {
+        facePlanes.limit[face] = FACE_POSITIVE[face] ? 1e30f : -1e30f;  // No faces - never shows
+    }
+    
+    // Counting sort of whole quads (4 vertices, 6 indices each) by their normal
+    std::vector<unsigned char> direction;
+    std::vector<unsigned int> grouped;
+    for (int layer = 0; layer < LAYER_COUNT; ++layer) {
+        std::vector<unsigned int>& layerIndices = indices[layer];
+        size_t faces = layerIndices.size() / 6;
+        direction.resize(faces);
+        unsigned int count[FACE_COUNT] = {};
+        for (size_t face = 0; face < faces; ++face) {
+            const Vertex& corner = vertices[layer][layerIndices[face * 6]];
+            int d = getFaceDirection(corner.normal);
+            direction[face] = static_cast<unsigned char>(d);
+            count[d] += 6;
+            
+            float plane = corner.position[FACE_AXIS[d]];
+            float& limit = facePlanes.limit[d];
+            limit = FACE_POSITIVE[d] ? std::min(limit, plane) : std::max(limit, plane);
+        }
+        
+        unsigned int next[FACE_COUNT];
+        faceStart[layer][0] = 0;
+        for (int d = 0; d < FACE_COUNT; ++d) {
+            next[d] = faceStart[layer][d];
+            faceStart[layer][d + 1] = faceStart[layer][d] + count[d];
+        }
+        grouped.resize(layerIndices.size());
+        for (size_t face = 0; face < faces; ++face) {
+            std::copy_n(layerIndices.begin() + face * 6, 6, grouped.begin() + next[direction[face]]);
+            next[direction[face]] += 6;
+        }
+        layerIndices.swap(grouped);
     }
 }
 
-void Chunk::drawStoneMesh() const {
-    if (m_stoneMesh) {
-        m_stoneMesh->render();
+unsigned int ChunkFacePlanes::getVisibleFaces(const glm::vec3& cameraPos) const {
+    unsigned int mask = 0;
+    for (int face = 0; face < FACE_COUNT; ++face) {
+        float camera = cameraPos[FACE_AXIS[face]];
+        if (FACE_POSITIVE[face] ? camera > limit[face] : camera < limit[face]) {
+            mask |= 1u << face;
+        }
     }
+    return mask;
 }
 
-void Chunk::drawGravelMesh() const {
-    if (m_gravelMesh) {
-        m_gravelMesh->render();
+void ChunkOccupancy::rebuild(const std::vector<BlockType>& blocks) {
+    *this = ChunkOccupancy();
+    for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            for (int x = 0; x < CHUNK_SIZE; ++x) {
+                set(x, y, z, blocks[x + z * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE]);
+            }
+        }
     }
+    // set() only ever marks sections that have a block, so just the full bits are missing
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        refreshSection(section);
+    }
+}
+
+void ChunkOccupancy::update(int x, int y, int z, BlockType type) {
+    set(x, y, z, type);
+    refreshSection(y / SectionVisibility::SIZE);
 }
 
-void Chunk::drawSandMesh() const {
-    if (m_sandMesh) {
-        m_sandMesh->render();
+void ChunkOccupancy::refreshSection(int section) {
+    // The section's 16 bits of every column
+    const std::uint64_t slice = ((1ull << SectionVisibility::SIZE) - 1) << (section * SectionVisibility::SIZE);
+    bool any = false, all = true;
+    for (std::uint64_t column : m_columns[FILLED]) {
+        any |= (column & slice) != 0;
+        all &= (column & slice) == slice;
     }
+    const std::uint8_t bit = static_cast<std::uint8_t>(1u << section);
+    m_sectionAny = any ? m_sectionAny | bit : m_sectionAny & ~bit;
+    m_sectionAll = all ? m_sectionAll | bit : m_sectionAll & ~bit;
 }
 
+void Chunk::getBounds(glm::vec3& min, glm::vec3& max) const {
+    glm::vec3 origin = getWorldPosition();
+    min = glm::vec3(origin.x - 0.5f, m_minY, origin.z - 0.5f);
+    max = glm::vec3(origin.x + CHUNK_SIZE - 0.5f, m_maxY, origin.z + CHUNK_SIZE - 0.5f);
+}
 
 void Chunk::markReadyForUpload() {
     m_readyForUpload = true;
@@ -90,138 +188,148 @@ bool Chunk::needsUpload() const {
 void Chunk::generateTerrainOnly() {
     
     bool expected = false;
-    if (!m_generated.compare_exchange_strong(expected, true)) {
+    if (!m_generationClaimed.compare_exchange_strong(expected, true)) {
         return;  
     }
     
     if (!m_terrainGenerator) {
         generateFlatTerrain();
-        return;
+    } else if (m_heightfield) {
+        m_terrainGenerator->generateHeightfield(m_position, *m_heightfield);
+    } else {
+        m_terrainGenerator->generateChunk(*this);
+        m_occupancy->rebuild(m_blockTypes);  // Generation only kept the mips conservative
     }
     
-    
-    m_terrainGenerator->generateChunk(*this);
-    
-    
+    // Published last - the main thread meshes generated chunks, and must not see half of one
     m_needsRebuild = true;
+    m_generated.store(true);
 }
 
 
-void Chunk::buildMeshData() {
+bool Chunk::loadBlockData(std::vector<BlockType>&& blocks) {
+    if (blocks.size() != m_blockTypes.size()) {
+        return false;
+    }
     
+    bool expected = false;
+    if (!m_generationClaimed.compare_exchange_strong(expected, true)) {
+        return false;
+    }
     
+    m_blockTypes = std::move(blocks);
+    m_occupancy->rebuild(m_blockTypes);
     m_needsRebuild = true;
+    m_generated.store(true);
+    return true;
 }
 
 
-void Chunk::uploadMesh() {
-    
-    
-    if (m_needsRebuild) {
-        buildMesh();
-    }
-}
-
-Chunk::~Chunk() {
-    
-    m_mesh.reset();
-}
-
-void Chunk::setBlock(int x, int y, int z, BlockType type) {
-    
-    if (!isValidPosition(x, y, z)) {
+void Chunk::buildMeshData(ChunkMeshData& meshData) const {
+    if (m_heightfield) {
+        // No voxels to fill - far chunks never hide anything
+        std::fill(std::begin(meshData.visibility), std::end(meshData.visibility), SectionVisibility());
+        
+        // Caves are unknown, so no solid core
+        meshData.occluder = ChunkOccluder();
+        
+        buildHeightfieldMeshData(meshData);
+        meshData.computeBounds();
+        meshData.groupByFace();
         return;
     }
     
-    
-    int index = getIndex(x, y, z);
-    
-    
-    m_blockTypes[index] = type;
-    
-    
-    if (!m_blocks[index]) {
-        m_blocks[index] = BlockRegistry::getInstance().createBlock(type);
-    } else {
-        
-        m_blocks[index] = BlockRegistry::getInstance().createBlock(type);
+    // 👁️ Which section faces see each other, for the visibility graph
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        meshData.visibility[section] = SectionVisibility::compute(m_blockTypes, section);
     }
     
-    
-    m_needsRebuild = true;
-}
-
-BlockType Chunk::getBlock(int x, int y, int z) const {
-    if (!isValidPosition(x, y, z)) return BlockType::AIR;
-    
-    int index = getIndex(x, y, z);
-    return m_blockTypes[index];  
-}
-
-const Block& Chunk::getBlockObject(int x, int y, int z) const {
-    if (!isValidPosition(x, y, z)) {
-        static Block airBlock(BlockType::AIR);
-        return airBlock;
+    const ChunkOccupancy& occupancy = *m_occupancy;
+    
+    // 🧱 Occluder: the solid run at the bottom of each column, lowest per tile
+    meshData.occluder = ChunkOccluder();
+    for (int tx = 0; tx < ChunkOccluder::TILES; ++tx) {
+        for (int tz = 0; tz < ChunkOccluder::TILES; ++tz) {
+            int tileHeight = CHUNK_HEIGHT;
+            for (int x = tx * ChunkOccluder::TILE; x < (tx + 1) * ChunkOccluder::TILE; ++x) {
+                for (int z = tz * ChunkOccluder::TILE; z < (tz + 1) * ChunkOccluder::TILE; ++z) {
+                    std::uint64_t open = ~occupancy.getColumn(ChunkOccupancy::OPAQUE, x, z);
+                    int solid = open ? ChunkOccupancy::lowestBit(open) : CHUNK_HEIGHT;
+                    tileHeight = std::min(tileHeight, solid);
+                }
+            }
+            meshData.occluder.tileHeight[tx][tz] = static_cast<uint8_t>(tileHeight);
+        }
     }
     
-    int index = getIndex(x, y, z);
-    return *m_blocks[index];
-}
-
-void Chunk::generate() {
-    if (m_generated) return;  
-    
-    //Create the basic terrain (grass on top, dirt below, stone at bottom)
-    generateTerrain();
-    
-    //Build the 3D mesh that the graphics card will render
-    buildMesh();
-    
-    m_generated.store(true);  //Mark as generated
-}
-
-void Chunk::buildMesh() {
-    
-    if (!m_needsRebuild) return;
-    
-    
-    std::vector<Vertex> solidVertices;
-    std::vector<unsigned int> solidIndices;
-    std::vector<Vertex> waterVertices;
-    std::vector<unsigned int> waterIndices;
-    std::vector<Vertex> oakVertices;
-    std::vector<unsigned int> oakIndices;
-    std::vector<Vertex> leavesVertices;
-    std::vector<unsigned int> leavesIndices;
-    std::vector<Vertex> stoneVertices;
-    std::vector<unsigned int> stoneIndices;
-    std::vector<Vertex> gravelVertices;
-    std::vector<unsigned int> gravelIndices;
-    std::vector<Vertex> sandVertices;
-    std::vector<unsigned int> sandIndices;
+    // ⚡ Blocks that can have a face, 64 per column at a time. Left out are air,
+    // blocks boxed in on all six sides by opaque ones, and blocks deep in a solid
+    // formation - every one of the 26 around them solid - whose faces would be
+    // dropped as buried. Edge columns and the top and bottom layers keep every block.
+    std::uint64_t candidates[CHUNK_SIZE][CHUNK_SIZE];
+    // Per face direction, the blocks whose neighbour that way is air or outside the chunk
+    std::uint64_t exposed[ChunkFacePlanes::FACE_COUNT][CHUNK_SIZE][CHUNK_SIZE];
+    {
+        auto column = [&](ChunkOccupancy::Kind kind, int x, int z) { return occupancy.getColumn(kind, x, z); };
+        const std::uint64_t hiddenRows = ~0ull << 2 & ~0ull >> 2;         // y 2 .. CHUNK_HEIGHT - 3
+        const std::uint64_t formationRows = (1ull << 60) - 1;              // y below 60
+        for (int x = 0; x < CHUNK_SIZE; ++x) {
+            for (int z = 0; z < CHUNK_SIZE; ++z) {
+                std::uint64_t drawn = column(ChunkOccupancy::FILLED, x, z);
+                if (x > 0 && x < CHUNK_SIZE - 1 && z > 0 && z < CHUNK_SIZE - 1) {
+                    std::uint64_t opaque = column(ChunkOccupancy::OPAQUE, x, z);
+                    std::uint64_t hidden = opaque & (opaque << 1) & (opaque >> 1) &
+                                           column(ChunkOccupancy::OPAQUE, x - 1, z) &
+                                           column(ChunkOccupancy::OPAQUE, x + 1, z) &
+                                           column(ChunkOccupancy::OPAQUE, x, z - 1) &
+                                           column(ChunkOccupancy::OPAQUE, x, z + 1) & hiddenRows;
+                    drawn &= ~hidden;
+                }
+                if (x > 1 && x < CHUNK_SIZE - 2 && z > 1 && z < CHUNK_SIZE - 2) {
+                    std::uint64_t formation = formationRows;
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        for (int dz = -1; dz <= 1; ++dz) {
+                            std::uint64_t solid = column(ChunkOccupancy::SOLID, x + dx, z + dz);
+                            // Below and above always; the block itself only for its neighbours
+                            std::uint64_t around = (solid << 1) & (solid >> 1);
+                            formation &= (dx == 0 && dz == 0) ? around : around & solid;
+                        }
+                    }
+                    drawn &= ~formation;
+                }
+                candidates[x][z] = drawn;
+                
+                // In addFaceToMesh order (+Z, -Z, -X, +X, +Y, -Y); the bit shifted in from
+                // outside the column is empty, so the top and bottom layers are open too
+                std::uint64_t filled = column(ChunkOccupancy::FILLED, x, z);
+                exposed[0][x][z] = z < CHUNK_SIZE - 1 ? ~column(ChunkOccupancy::FILLED, x, z + 1) : ~0ull;
+                exposed[1][x][z] = z > 0 ? ~column(ChunkOccupancy::FILLED, x, z - 1) : ~0ull;
+                exposed[2][x][z] = x > 0 ? ~column(ChunkOccupancy::FILLED, x - 1, z) : ~0ull;
+                exposed[3][x][z] = x < CHUNK_SIZE - 1 ? ~column(ChunkOccupancy::FILLED, x + 1, z) : ~0ull;
+                exposed[4][x][z] = ~(filled >> 1);
+                exposed[5][x][z] = ~(filled << 1);
+            }
+        }
+    }
     
     // ⚡ PERFORMANCE: Reserve larger memory for fewer reallocations
-    solidVertices.reserve(16384);    // Double the size to reduce reallocations
-    solidIndices.reserve(24576);     
-    waterVertices.reserve(4096);     // Increase water capacity
-    waterIndices.reserve(6144);      
-    oakVertices.reserve(2048);       // More space for trees
-    oakIndices.reserve(3072);        
-    leavesVertices.reserve(4096);    // Leaves are common
-    leavesIndices.reserve(6144);     
-    stoneVertices.reserve(8192);     // Stone is very common
-    stoneIndices.reserve(12288);     
-    gravelVertices.reserve(2048);    
-    gravelIndices.reserve(3072);
-    sandVertices.reserve(2048);      // Reserve space for sand blocks
-    sandIndices.reserve(3072);
-    unsigned int solidVertexIndex = 0;
-    unsigned int waterVertexIndex = 0;
-    unsigned int oakVertexIndex = 0;
-    unsigned int leavesVertexIndex = 0;
-    unsigned int stoneVertexIndex = 0;
-    unsigned int gravelVertexIndex = 0;
-    unsigned int sandVertexIndex = 0;
+    static const size_t vertexReserve[ChunkMeshData::LAYER_COUNT] = {
+        16384,  // Solid - double the size to reduce reallocations
+        4096,   // Water
+        2048,   // Oak - more space for trees
+        4096,   // Leaves are common
+        8192,   // Stone is very common
+        2048,   // Gravel
+        2048    // Sand
+    };
+    unsigned int vertexIndex[ChunkMeshData::LAYER_COUNT];
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        meshData.vertices[layer].clear();
+        meshData.indices[layer].clear();
+        meshData.vertices[layer].reserve(vertexReserve[layer]);
+        meshData.indices[layer].reserve(vertexReserve[layer] * 3 / 2);
+        vertexIndex[layer] = 0;
+    }
     
     // Static face direction and normal arrays for cube face generation
     static const glm::ivec3 faceDirections[6] = {
@@ -238,88 +346,22 @@ void Chunk::buildMesh() {
     for (int x = 0; x < CHUNK_SIZE; ++x) {
         for (int y = 0; y < CHUNK_HEIGHT; ++y) {
             for (int z = 0; z < CHUNK_SIZE; ++z) {
+                if (!(candidates[x][z] >> y & 1)) continue;
                 
                 BlockType blockType = getBlockFast(x, y, z);
                 
-                // Skip air blocks
-                if (blockType == BlockType::AIR) continue;
-                
-                bool completelyHidden = true;
-                
-                
-                if (x > 0 && x < CHUNK_SIZE - 1 && y > 1 && y < CHUNK_HEIGHT - 2 && z > 0 && z < CHUNK_SIZE - 1) {
-                    
-                    BlockType neighbors[6] = {
-                        getBlockFast(x-1, y, z), getBlockFast(x+1, y, z),  
-                        getBlockFast(x, y-1, z), getBlockFast(x, y+1, z),  
-                        getBlockFast(x, y, z-1), getBlockFast(x, y, z+1)   
-                    };
-                    
-                    
-                    for (int i = 0; i < 6; ++i) {
-                        BlockType neighborType = neighbors[i];
-                        
-                        
-                        if (neighborType == BlockType::AIR || 
-                            neighborType == BlockType::WATER || 
-                            neighborType == BlockType::LEAVES) {
-                            completelyHidden = false;
-                            break;
-                        }
-                    }
-                    
-                    
-                    if (blockType == BlockType::WATER || blockType == BlockType::LEAVES) {
-                        completelyHidden = false;
-                    }
-                } else {
-                    
-                    completelyHidden = false;
-                }
-                
-                
-                if (completelyHidden) continue;
-                
-                
                 glm::vec3 blockWorldPos = getWorldPosition() + glm::vec3(x, y, z);
                 
                 // Generate cube faces for this block
                 for (int faceIndex = 0; faceIndex < 6; ++faceIndex) {
-                    int nx = x + faceDirections[faceIndex].x;
-                    int ny = y + faceDirections[faceIndex].y;
-                    int nz = z + faceDirections[faceIndex].z;
-                    
-                    
-                    BlockType neighborType = BlockType::AIR;
-                    bool isChunkBoundary = false;
-                    
-                    if (nx >= 0 && nx < CHUNK_SIZE && ny >= 0 && ny < CHUNK_HEIGHT && nz >= 0 && nz < CHUNK_SIZE) {
-                        
-                        neighborType = getBlockFast(nx, ny, nz);
-                    } else {
-                        
-                        isChunkBoundary = true;
-                        
-                        
-                        
-                        
-                        neighborType = BlockType::AIR;
-                        
-                        
-                        if (ny < 0) {
-                            neighborType = BlockType::STONE;
-                        }
-                    }
-                    
-                    
-                    bool shouldRenderFace = false;
+                    // ⚡ Open to air or the chunk's edge: drawn without reading the neighbour
+                    bool shouldRenderFace = exposed[faceIndex][x][z] >> y & 1;
+                    BlockType neighborType = shouldRenderFace ? BlockType::AIR :
+                        getBlockFast(x + faceDirections[faceIndex].x, y + faceDirections[faceIndex].y,
+                                     z + faceDirections[faceIndex].z);
                     
-                    if (isChunkBoundary) {
-                        
-                        shouldRenderFace = true;
-                    } else if (neighborType == BlockType::AIR) {
-                        
-                        shouldRenderFace = true;
+                    if (shouldRenderFace) {
+                        // Nothing to compare against
                     } else if (blockType == neighborType) {
                         
                         shouldRenderFace = false;
@@ -339,7 +381,7 @@ void Chunk::buildMesh() {
                         bool shouldRenderInteriorFace = true; 
                         
                         
-                        if (y < 40 && !isChunkBoundary) { 
+                        if (y < 40) { 
                             
                             bool similarMaterials = 
                                 (blockType == BlockType::STONE && neighborType == BlockType::DIRT) ||
@@ -368,196 +410,137 @@ void Chunk::buildMesh() {
                     }
                     
                     
-                    bool isEdgeBlock = (x == 0 || x == CHUNK_SIZE-1 || z == 0 || z == CHUNK_SIZE-1);
-                    
-                    
-                    
-                    if (shouldRenderFace && !isEdgeBlock) {
-                        
-                        glm::vec3 faceCenter = blockWorldPos + glm::vec3(faceDirections[faceIndex]) * 0.5f;
-                        glm::vec3 faceNormal = faceNormals[faceIndex];
-                        
-                        
-                        bool likelyBackface = false;
-                        
-                        
-                        if (y < 30) { 
-                            
-                            if (faceIndex == 5 && y < 20) { 
-                                likelyBackface = true;
-                            }
-                        }
-                        
-                        
-                        if (y > 120) { 
-                            
-                            if (faceIndex == 4) { 
-                                likelyBackface = true;
-                            }
-                        }
-                        
-                        
-                        
-                        
-                        
-                        
-                        
-                        if (!likelyBackface && y < 60 && !isEdgeBlock && 
-                            x > 1 && x < CHUNK_SIZE-2 && z > 1 && z < CHUNK_SIZE-2) { 
-                            
-                            bool inSolidFormation = true;
-                            for (int dx = -1; dx <= 1 && inSolidFormation; dx++) {
-                                for (int dy = -1; dy <= 1 && inSolidFormation; dy++) {
-                                    for (int dz = -1; dz <= 1 && inSolidFormation; dz++) {
-                                        if (dx == 0 && dy == 0 && dz == 0) continue; 
-                                        
-                                        int checkX = x + dx, checkY = y + dy, checkZ = z + dz;
-                                        if (checkX >= 0 && checkX < CHUNK_SIZE && 
-                                            checkY >= 0 && checkY < CHUNK_HEIGHT && 
-                                            checkZ >= 0 && checkZ < CHUNK_SIZE) {
-                                            BlockType checkType = getBlockFast(checkX, checkY, checkZ);
-                                            if (checkType == BlockType::AIR || checkType == BlockType::WATER) {
-                                                inSolidFormation = false;
-                                            }
-                                        } else {
-                                            
-                                            inSolidFormation = false;
-                                        }
-                                    }
-                                }
-                            }
-                            
-                            
-                            if (inSolidFormation) {
-                                likelyBackface = true;
-                            }
-                        }
-                        
-                        
-                        if (likelyBackface) {
-                            shouldRenderFace = false;
-                        }
-                    }
-                    
-                    
                     if (!shouldRenderFace) continue;
                     
                     
-                    if (blockType == BlockType::WATER) {
-                        addFaceToMesh(waterVertices, waterIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], waterVertexIndex);
-                    } else if (blockType == BlockType::OAK_LOG) {
-                        addFaceToMesh(oakVertices, oakIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], oakVertexIndex);
-                    } else if (blockType == BlockType::LEAVES) {
-                        addFaceToMesh(leavesVertices, leavesIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], leavesVertexIndex);
-                    } else if (blockType == BlockType::STONE) {
-                        addFaceToMesh(stoneVertices, stoneIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], stoneVertexIndex);
-                    } else if (blockType == BlockType::GRAVEL) {
-                        addFaceToMesh(gravelVertices, gravelIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], gravelVertexIndex);
-                    } else if (blockType == BlockType::SAND) {
-                        addFaceToMesh(sandVertices, sandIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], sandVertexIndex);
-                    } else {
-                        
-                        addFaceToMesh(solidVertices, solidIndices, blockWorldPos, faceIndex,
-                                      faceNormals[faceIndex], solidVertexIndex);
-                    }
+                    int layer = ChunkMeshData::getLayer(blockType);
+                    addFaceToMesh(meshData.vertices[layer], meshData.indices[layer], blockWorldPos, faceIndex,
+                                  faceNormals[faceIndex], vertexIndex[layer]);
                 }
             }
         }
     }
     
-    
-    
-    
-    m_mesh->clear();
-    if (!solidVertices.empty()) {
-        m_mesh->setVertices(solidVertices);
-        m_mesh->setIndices(solidIndices);
+    meshData.computeBounds();
+    meshData.groupByFace();
+}
+
+void Chunk::buildHeightfieldMeshData(ChunkMeshData& meshData) const {
+    unsigned int vertexIndex[ChunkMeshData::LAYER_COUNT];
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        meshData.vertices[layer].clear();
+        meshData.indices[layer].clear();
+        vertexIndex[layer] = 0;
     }
-    m_mesh->upload();
     
+    // Side faces in addFaceToMesh order (+Z, -Z, -X, +X) as (dx, dz)
+    static const glm::ivec2 sideDirections[4] = { {0, 1}, {0, -1}, {-1, 0}, {1, 0} };
+    static const glm::vec3 sideNormals[4] = {
+        {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}
+    };
+    const glm::vec3 up(0.0f, 1.0f, 0.0f);
     
-    m_waterMesh->clear();
-    if (!waterVertices.empty()) {
-        m_waterMesh->setVertices(waterVertices);
-        m_waterMesh->setIndices(waterIndices);
+    const ChunkHeightfield& field = *m_heightfield;
+    int minHeight = CHUNK_HEIGHT;
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            minHeight = std::min(minHeight, field.height[x][z]);
+        }
     }
-    m_waterMesh->upload();
-    
+    int skirtBottom = std::max(-1, minHeight - HEIGHTFIELD_SKIRT_DEPTH);
     
-    m_oakMesh->clear();
-    if (!oakVertices.empty()) {
-        m_oakMesh->setVertices(oakVertices);
-        m_oakMesh->setIndices(oakIndices);
+    // One top face per column, water on top of anything below the water level,
+    // and walls down to each lower neighbour - a silhouette, not a voxel mesh
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            BlockType surface = field.surface[x][z];
+            if (surface == BlockType::AIR) continue;
+            
+            int height = field.height[x][z];
+            int surfaceLayer = ChunkMeshData::getLayer(surface);
+            glm::vec3 columnPos = getWorldPosition() + glm::vec3(x, 0, z);
+            
+            addFaceToMesh(meshData.vertices[surfaceLayer], meshData.indices[surfaceLayer],
+                          columnPos + glm::vec3(0, height, 0), 4, up, vertexIndex[surfaceLayer]);
+            
+            if (height < field.waterLevel) {
+                addFaceToMesh(meshData.vertices[ChunkMeshData::WATER], meshData.indices[ChunkMeshData::WATER],
+                              columnPos + glm::vec3(0, field.waterLevel, 0), 4, up,
+                              vertexIndex[ChunkMeshData::WATER]);
+            }
+            
+            for (int side = 0; side < 4; ++side) {
+                int nx = x + sideDirections[side].x;
+                int nz = z + sideDirections[side].y;
+                bool inside = nx >= 0 && nx < CHUNK_SIZE && nz >= 0 && nz < CHUNK_SIZE;
+                int bottom = inside ? field.height[nx][nz] : skirtBottom;
+                
+                for (int y = height; y > bottom; --y) {
+                    int layer = y > height - HEIGHTFIELD_SOIL_DEPTH ? surfaceLayer : ChunkMeshData::STONE;
+                    addFaceToMesh(meshData.vertices[layer], meshData.indices[layer],
+                                  columnPos + glm::vec3(0, y, 0), side, sideNormals[side], vertexIndex[layer]);
+                }
+            }
+        }
     }
-    m_oakMesh->upload();
+}
+
+Chunk::~Chunk() {
     
+    m_mesh.reset();
+}
+
+void Chunk::generate() {
+    bool expected = false;
+    if (!m_generationClaimed.compare_exchange_strong(expected, true)) return;  
     
-    m_leavesMesh->clear();
-    if (!leavesVertices.empty()) {
-        m_leavesMesh->setVertices(leavesVertices);
-        m_leavesMesh->setIndices(leavesIndices);
-    }
-    m_leavesMesh->upload();
+    //Create the basic terrain (grass on top, dirt below, stone at bottom)
+    //The mesh is built on the render thread once m_needsRebuild is seen
+    generateTerrain();
     
+    m_generated.store(true);  //Mark as generated
+}
+
+void Chunk::setBlock(int x, int y, int z, BlockType type) {
     
-    m_stoneMesh->clear();
-    if (!stoneVertices.empty()) {
-        m_stoneMesh->setVertices(stoneVertices);
-        m_stoneMesh->setIndices(stoneIndices);
+    if (!isValidPosition(x, y, z) || m_blockTypes.empty()) {
+        return;
     }
-    m_stoneMesh->upload();
     
     
-    m_gravelMesh->clear();
-    if (!gravelVertices.empty()) {
-        m_gravelMesh->setVertices(gravelVertices);
-        m_gravelMesh->setIndices(gravelIndices);
-    }
-    m_gravelMesh->upload();
+    int index = getIndex(x, y, z);
     
     
-    m_sandMesh->clear();
-    if (!sandVertices.empty()) {
-        m_sandMesh->setVertices(sandVertices);
-        m_sandMesh->setIndices(sandIndices);
-    }
-    m_sandMesh->upload();
+    m_blockTypes[index] = type;
+    m_occupancy->update(x, y, z, type);
     
-    m_needsRebuild = false;
-}
-
-void Chunk::render(const glm::mat4& view, const glm::mat4& projection) {
     
-    if (!m_generated) {
-        return;  
+    if (!m_blocks[index]) {
+        m_blocks[index] = BlockRegistry::getInstance().createBlock(type);
+    } else {
+        
+        m_blocks[index] = BlockRegistry::getInstance().createBlock(type);
     }
     
     
-    if (needsUpload()) {
-        uploadMesh();
-        m_readyForUpload = false;  
-    }
-    
+    m_needsRebuild = true;
+}
+
+BlockType Chunk::getBlock(int x, int y, int z) const {
+    if (!isValidPosition(x, y, z) || m_blockTypes.empty()) return BlockType::AIR;
     
-    if (m_needsRebuild) {
-        buildMesh();
+    int index = getIndex(x, y, z);
+    return m_blockTypes[index];  
+}
+
+const Block& Chunk::getBlockObject(int x, int y, int z) const {
+    if (!isValidPosition(x, y, z) || m_blocks.empty()) {
+        static Block airBlock(BlockType::AIR);
+        return airBlock;
     }
     
-    if (m_mesh) {
-        
-        
-        glm::mat4 model = glm::mat4(1.0f); 
-        
-        
-        
-        m_mesh->render();
-    }
+    int index = getIndex(x, y, z);
+    return *m_blocks[index];
 }
 
 bool Chunk::isValidPosition(int x, int y, int z) const {
@@ -582,6 +565,7 @@ void Chunk::generateTerrain() {
     
     
     m_terrainGenerator->generateChunk(*this);
+    m_occupancy->rebuild(m_blockTypes);
     
     
     m_generated.store(true);
@@ -620,7 +604,7 @@ void Chunk::addTerrainVariation(int x, int z, int surfaceHeight) {
 
 void Chunk::addFaceToMesh(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, 
                           const glm::vec3& blockPos, int faceIndex, const glm::vec3& normal, 
-                          unsigned int& vertexIndex) {
+                          unsigned int& vertexIndex) const {
     
     float size = 0.5f; 
     glm::vec3 pos = blockPos;
@@ -0,0 +1,277 @@
+#include "world/ChunkLODManager.h"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+// Corner signs and texture coordinates of each face, in the same order and
+// winding as Chunk::addFaceToMesh (+Z, -Z, -X, +X, +Y, -Y)
+struct FaceCorner {
+    glm::vec3 sign;
+    glm::vec2 uv;
+};
+
+const FaceCorner FACE_CORNERS[6][4] = {
+    {{{-1, -1,  1}, {0, 0}}, {{ 1, -1,  1}, {1, 0}}, {{ 1,  1,  1}, {1, 1}}, {{-1,  1,  1}, {0, 1}}},
+    {{{-1, -1, -1}, {1, 0}}, {{-1,  1, -1}, {1, 1}}, {{ 1,  1, -1}, {0, 1}}, {{ 1, -1, -1}, {0, 0}}},
+    {{{-1,  1,  1}, {1, 1}}, {{-1,  1, -1}, {0, 1}}, {{-1, -1, -1}, {0, 0}}, {{-1, -1,  1}, {1, 0}}},
+    {{{ 1,  1,  1}, {0, 1}}, {{ 1, -1,  1}, {0, 0}}, {{ 1, -1, -1}, {1, 0}}, {{ 1,  1, -1}, {1, 1}}},
+    {{{-1,  1, -1}, {0, 1}}, {{-1,  1,  1}, {0, 0}}, {{ 1,  1,  1}, {1, 0}}, {{ 1,  1, -1}, {1, 1}}},
+    {{{-1, -1, -1}, {0, 0}}, {{ 1, -1, -1}, {1, 0}}, {{ 1, -1,  1}, {1, 1}}, {{-1, -1,  1}, {0, 1}}}
+};
+
+const glm::ivec3 FACE_DIRECTIONS[6] = {
+    { 0,  0,  1}, { 0,  0, -1}, {-1,  0,  0},
+    { 1,  0,  0}, { 0,  1,  0}, { 0, -1,  0}
+};
+
+// One face of a coarse voxel. Textures repeat once per block, like full-detail faces
+void addScaledFace(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                   const glm::vec3& center, float scale, int faceIndex, unsigned int& vertexIndex) {
+    glm::vec3 normal(FACE_DIRECTIONS[faceIndex]);
+    for (const FaceCorner& corner : FACE_CORNERS[faceIndex]) {
+        vertices.emplace_back(center + corner.sign * (scale * 0.5f), corner.uv * scale, normal);
+    }
+    indices.insert(indices.end(), {
+        vertexIndex + 0, vertexIndex + 1, vertexIndex + 2,
+        vertexIndex + 2, vertexIndex + 3, vertexIndex + 0
+    });
+    vertexIndex += 4;
+}
+
+// Same rules as the full mesher: water only shows against air, and see-through
+// blocks show whatever is behind them
+bool isFaceVisible(BlockType self, BlockType neighbour) {
+    if (neighbour == BlockType::AIR) return true;
+    if (self == BlockType::WATER) return false;
+    if (neighbour == BlockType::WATER || neighbour == BlockType::LEAVES) return self != neighbour;
+    return false;
+}
+
+} // namespace
+
+ChunkLODManager::ChunkLODManager(int workerCount)
+    : m_mediumDetailDistance(8.0f)
+    , m_lowDetailDistance(16.0f)
+    , m_hysteresis(1.0f)
+    , m_stopWorkers(false) {
+    for (int i = 0; i < std::max(1, workerCount); ++i) {
+        m_workers.emplace_back(&ChunkLODManager::buildWorker, this);
+    }
+}
+
+ChunkLODManager::~ChunkLODManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopWorkers = true;
+    }
+    m_jobCondition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ChunkLODManager::setLODDistances(float medium, float low) {
+    m_mediumDetailDistance = medium;
+    m_lowDetailDistance = std::max(medium, low);
+}
+
+ChunkLODManager::LODLevel ChunkLODManager::calculateLODLevel(float distance, LODLevel current) const {
+    // Boundary between level i and i + 1. A chunk must cross a boundary by the
+    // hysteresis band before it switches, so small camera moves can't make it pop.
+    const float thresholds[LEVEL_COUNT - 1] = { m_mediumDetailDistance, m_lowDetailDistance };
+
+    int level = static_cast<int>(current);
+    while (level < LEVEL_COUNT - 1 && distance > thresholds[level] + m_hysteresis) {
+        level++;
+    }
+    while (level > 0 && distance < thresholds[level - 1] - m_hysteresis) {
+        level--;
+    }
+    return static_cast<LODLevel>(level);
+}
+
+ChunkLODManager::LODLevel ChunkLODManager::updateLOD(const Chunk& chunk, float distanceInChunks) {
+    LODChunk& lodChunk = m_lodChunks[chunk.getPosition()];
+    lodChunk.targetLevel = calculateLODLevel(distanceInChunks, lodChunk.targetLevel);
+
+    int target = static_cast<int>(lodChunk.targetLevel);
+    if (target != 0 && !lodChunk.ready[target] && !lodChunk.pending[target]) {
+        requestBuild(chunk, lodChunk, lodChunk.targetLevel);
+    }
+
+    // Switch once the target is on the GPU - until then keep what is on screen
+    if (target == 0 || lodChunk.ready[target]) {
+        lodChunk.drawLevel = lodChunk.targetLevel;
+    } else if (!lodChunk.ready[static_cast<int>(lodChunk.drawLevel)]) {
+        lodChunk.drawLevel = LODLevel::FULL_DETAIL;
+    }
+    return lodChunk.drawLevel;
+}
+
+void ChunkLODManager::invalidateChunk(const glm::ivec2& chunkPos) {
+    auto it = m_lodChunks.find(chunkPos);
+    if (it == m_lodChunks.end()) {
+        return;
+    }
+
+    // The chunk's own mesh was just rebuilt, so it is the only current one
+    LODChunk& lodChunk = it->second;
+    lodChunk.version++;
+    std::fill(std::begin(lodChunk.ready), std::end(lodChunk.ready), false);
+    std::fill(std::begin(lodChunk.pending), std::end(lodChunk.pending), false);
+    lodChunk.drawLevel = LODLevel::FULL_DETAIL;
+}
+
+void ChunkLODManager::removeChunk(const glm::ivec2& chunkPos) {
+    // Builds still in flight find no entry and are dropped on upload
+    m_lodChunks.erase(chunkPos);
+}
+
+const ChunkLODManager::LODMeshes* ChunkLODManager::getChunkMeshes(const glm::ivec2& chunkPos) const {
+    auto it = m_lodChunks.find(chunkPos);
+    if (it == m_lodChunks.end()) {
+        return nullptr;
+    }
+
+    int level = static_cast<int>(it->second.drawLevel);
+    return level != 0 && it->second.ready[level] ? &it->second.meshes[level] : nullptr;
+}
+
+void ChunkLODManager::requestBuild(const Chunk& chunk, LODChunk& lodChunk, LODLevel level) {
+    lodChunk.pending[static_cast<int>(level)] = true;
+
+    auto blocks = std::make_shared<const std::vector<BlockType>>(chunk.getBlockData());
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_jobs.push_back({chunk.getPosition(), level, lodChunk.version, std::move(blocks)});
+    }
+    m_jobCondition.notify_one();
+}
+
+void ChunkLODManager::buildWorker() {
+    while (true) {
+        BuildJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobCondition.wait(lock, [this] { return m_stopWorkers || !m_jobs.empty(); });
+            if (m_stopWorkers) {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        BuildResult result{job.chunkPos, job.level, job.version, ChunkMeshData()};
+        buildLODMeshData(*job.blocks, job.chunkPos, getScale(job.level), result.meshData);
+
+        std::lock_guard<std::mutex> lock(m_resultMutex);
+        m_results.push_back(std::move(result));
+    }
+}
+
+void ChunkLODManager::buildLODMeshData(const std::vector<BlockType>& blocks, const glm::ivec2& chunkPos,
+                                       int scale, ChunkMeshData& meshData) {
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        meshData.vertices[layer].clear();
+        meshData.indices[layer].clear();
+    }
+    if (blocks.size() != static_cast<size_t>(CHUNK_SIZE * CHUNK_SIZE * CHUNK_HEIGHT)) {
+        return;
+    }
+
+    const int sizeXZ = CHUNK_SIZE / scale;
+    const int sizeY = CHUNK_HEIGHT / scale;
+    const int fillThreshold = scale * scale * scale / 2;
+    auto cellIndex = [sizeXZ](int x, int y, int z) { return x + z * sizeXZ + y * sizeXZ * sizeXZ; };
+
+    // A coarse voxel is filled if at least half its blocks are, and takes the
+    // type of its highest block - the one seen from above (grass, not dirt)
+    std::vector<BlockType> cells(sizeXZ * sizeXZ * sizeY, BlockType::AIR);
+    for (int cy = 0; cy < sizeY; ++cy) {
+        for (int cz = 0; cz < sizeXZ; ++cz) {
+            for (int cx = 0; cx < sizeXZ; ++cx) {
+                int filled = 0;
+                BlockType top = BlockType::AIR;
+                for (int y = cy * scale + scale - 1; y >= cy * scale; --y) {
+                    for (int z = cz * scale; z < cz * scale + scale; ++z) {
+                        for (int x = cx * scale; x < cx * scale + scale; ++x) {
+                            BlockType type = blocks[x + z * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE];
+                            if (type != BlockType::AIR) {
+                                filled++;
+                                if (top == BlockType::AIR) top = type;
+                            }
+                        }
+                    }
+                }
+                if (filled >= fillThreshold) {
+                    cells[cellIndex(cx, cy, cz)] = top;
+                }
+            }
+        }
+    }
+
+    unsigned int vertexIndex[ChunkMeshData::LAYER_COUNT] = {};
+    glm::vec3 chunkOrigin(chunkPos.x * CHUNK_SIZE, 0.0f, chunkPos.y * CHUNK_SIZE);
+    float centerOffset = (scale - 1) * 0.5f;
+
+    for (int cy = 0; cy < sizeY; ++cy) {
+        for (int cz = 0; cz < sizeXZ; ++cz) {
+            for (int cx = 0; cx < sizeXZ; ++cx) {
+                BlockType type = cells[cellIndex(cx, cy, cz)];
+                if (type == BlockType::AIR) continue;
+
+                int layer = ChunkMeshData::getLayer(type);
+                glm::vec3 center = chunkOrigin + glm::vec3(cx * scale + centerOffset, cy * scale + centerOffset,
+                                                           cz * scale + centerOffset);
+
+                for (int faceIndex = 0; faceIndex < 6; ++faceIndex) {
+                    int nx = cx + FACE_DIRECTIONS[faceIndex].x;
+                    int ny = cy + FACE_DIRECTIONS[faceIndex].y;
+                    int nz = cz + FACE_DIRECTIONS[faceIndex].z;
+
+                    if (ny < 0) continue;  // World bottom is never seen
+
+                    // Seams: chunk-edge walls are always closed, whatever level the neighbour is at
+                    bool visible = nx < 0 || nx >= sizeXZ || nz < 0 || nz >= sizeXZ || ny >= sizeY ||
+                                   isFaceVisible(type, cells[cellIndex(nx, ny, nz)]);
+                    if (visible) {
+                        addScaledFace(meshData.vertices[layer], meshData.indices[layer], center,
+                                      static_cast<float>(scale), faceIndex, vertexIndex[layer]);
+                    }
+                }
+            }
+        }
+    }
+    meshData.groupByFace();
+}
+
+int ChunkLODManager::getChunksAtLOD(LODLevel level) const {
+    int count = 0;
+    for (const auto& [pos, lodChunk] : m_lodChunks) {
+        if (lodChunk.drawLevel == level) count++;
+    }
+    return count;
+}
+
+size_t ChunkLODManager::getLODTriangles() const {
+    size_t triangles = 0;
+    for (const auto& [pos, lodChunk] : m_lodChunks) {
+        triangles += lodChunk.triangles[static_cast<int>(lodChunk.drawLevel)];
+    }
+    return triangles;
+}
+
+int ChunkLODManager::getPendingBuilds() const {
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    return static_cast<int>(m_jobs.size());
+}
+
+bool ChunkLODManager::hasPendingLevels() const {
+    for (const auto& [pos, lodChunk] : m_lodChunks) {
+        if (std::find(std::begin(lodChunk.pending), std::end(lodChunk.pending), true) != std::end(lodChunk.pending)) {
+            return true;
+        }
+    }
+    return false;
+}
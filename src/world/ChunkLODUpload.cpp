@@ -0,0 +1,51 @@
+#include "world/ChunkLODManager.h"
+#include "engine/graphics/Mesh.h"
+
+// GPU side of ChunkLODManager - kept out of ChunkLODManager.cpp so the world core links without GL
+
+int ChunkLODManager::uploadReadyMeshes(int maxUploads) {
+    int uploaded = 0;
+    while (uploaded < maxUploads) {
+        BuildResult result;
+        {
+            std::lock_guard<std::mutex> lock(m_resultMutex);
+            if (m_results.empty()) {
+                break;
+            }
+            result = std::move(m_results.front());
+            m_results.pop_front();
+        }
+
+        // Chunk unloaded or changed since the build was queued
+        auto it = m_lodChunks.find(result.chunkPos);
+        if (it == m_lodChunks.end() || it->second.version != result.version) {
+            continue;
+        }
+
+        int level = static_cast<int>(result.level);
+        LODChunk& lodChunk = it->second;
+        size_t triangles = 0;
+        for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+            std::shared_ptr<Mesh>& mesh = lodChunk.meshes[level].layers[layer];
+            if (!mesh) {
+                mesh = std::make_shared<Mesh>();
+            }
+
+            mesh->clear();
+            if (!result.meshData.vertices[layer].empty()) {
+                mesh->setVertices(result.meshData.vertices[layer]);
+                mesh->setIndices(result.meshData.indices[layer]);
+                mesh->setIndexGroups(result.meshData.faceStart[layer], ChunkFacePlanes::FACE_COUNT);
+            }
+            mesh->upload();
+            triangles += result.meshData.indices[layer].size() / 3;
+        }
+
+        lodChunk.meshes[level].facePlanes = result.meshData.facePlanes;
+        lodChunk.ready[level] = true;
+        lodChunk.pending[level] = false;
+        lodChunk.triangles[level] = triangles;
+        uploaded++;
+    }
+    return uploaded;
+}
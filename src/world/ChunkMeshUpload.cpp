@@ -0,0 +1,100 @@
+#include "world/Chunk.h"
+#include "engine/graphics/Mesh.h"
+#include <algorithm>
+#include <iterator>
+
+// GPU side of Chunk - kept out of Chunk.cpp so the world core links without GL
+
+void Chunk::buildMesh() {
+    // Cleared before reading the blocks - a write that lands mid-build asks for another one
+    if (!m_needsRebuild.exchange(false)) return;
+
+    ChunkMeshData meshData;
+    buildMeshData(meshData);
+
+    std::shared_ptr<Mesh>* meshes[ChunkMeshData::LAYER_COUNT] = {
+        &m_mesh, &m_waterMesh, &m_oakMesh, &m_leavesMesh, &m_stoneMesh, &m_gravelMesh, &m_sandMesh
+    };
+
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        std::shared_ptr<Mesh>& mesh = *meshes[layer];
+        if (!mesh) {
+            mesh = std::make_shared<Mesh>();
+        }
+
+        mesh->clear();
+        if (!meshData.vertices[layer].empty()) {
+            mesh->setVertices(meshData.vertices[layer]);
+            mesh->setIndices(meshData.indices[layer]);
+            mesh->setIndexGroups(meshData.faceStart[layer], ChunkFacePlanes::FACE_COUNT);
+        }
+        mesh->upload();
+    }
+
+    std::copy(std::begin(meshData.visibility), std::end(meshData.visibility), std::begin(m_sectionVisibility));
+    m_occluder = meshData.occluder;
+    m_minY = meshData.minY;
+    m_maxY = meshData.maxY;
+    m_facePlanes = meshData.facePlanes;
+}
+
+void Chunk::uploadMesh() {
+    if (m_needsRebuild) {
+        buildMesh();
+    }
+}
+
+void Chunk::render(const glm::mat4& view, const glm::mat4& projection, unsigned int faceMask) {
+    if (!m_generated) {
+        return;
+    }
+
+    if (needsUpload()) {
+        uploadMesh();
+        m_readyForUpload = false;
+    }
+
+    if (m_needsRebuild) {
+        buildMesh();
+    }
+
+    if (m_mesh) {
+        m_mesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawWaterMesh(unsigned int faceMask) const {
+    if (m_waterMesh) {
+        m_waterMesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawOakMesh(unsigned int faceMask) const {
+    if (m_oakMesh) {
+        m_oakMesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawLeavesMesh(unsigned int faceMask) const {
+    if (m_leavesMesh) {
+        m_leavesMesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawStoneMesh(unsigned int faceMask) const {
+    if (m_stoneMesh) {
+        m_stoneMesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawGravelMesh(unsigned int faceMask) const {
+    if (m_gravelMesh) {
+        m_gravelMesh->renderGroups(faceMask);
+    }
+}
+
+void Chunk::drawSandMesh(unsigned int faceMask) const {
+    if (m_sandMesh) {
+        m_sandMesh->renderGroups(faceMask);
+    }
+}
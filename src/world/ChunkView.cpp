@@ -0,0 +1,26 @@
+#include "world/ChunkView.h"
+#include <utility>
+
+ChunkView::ChunkView(Lookup lookup)
+    : m_lookup(std::move(lookup))
+    , m_lookups(0) {
+    for (Entry& entry : m_table) {
+        entry.valid = false;
+    }
+}
+
+const Chunk* ChunkView::getChunkAt(int worldX, int worldZ) {
+    // Arithmetic shift floors negative coordinates, unlike division
+    glm::ivec2 chunkPos(worldX >> 4, worldZ >> 4);
+    static_assert(CHUNK_SIZE == 16, "chunk position shift assumes 16-block chunks");
+
+    Entry& entry = m_table[(chunkPos.x & (TABLE_SIDE - 1)) + (chunkPos.y & (TABLE_SIDE - 1)) * TABLE_SIDE];
+    if (!entry.valid || entry.chunkPos != chunkPos) {
+        // Unavailable chunks are remembered too, so they are not looked up again
+        entry.chunkPos = chunkPos;
+        entry.chunk = m_lookup(chunkPos);
+        entry.valid = true;
+        m_lookups++;
+    }
+    return entry.chunk;
+}
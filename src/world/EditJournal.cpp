@@ -0,0 +1,207 @@
+#include "world/EditJournal.h"
+#include <unistd.h>
+#include <filesystem>
+#include <iostream>
+
+EditJournal::EditJournal(const std::string& directory, unsigned int seed)
+    : m_path((std::filesystem::path(directory) / "edits.journal").string())
+    , m_seed(seed)
+    , m_file(nullptr)
+    , m_recordCount(0) {
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    if (replay()) {
+        std::cout << "EditJournal: Restored " << getEditCount() << " edited blocks in "
+                  << m_edits.size() << " chunks" << std::endl;
+    }
+    openForAppend();
+}
+
+EditJournal::~EditJournal() {
+    flush();
+    if (m_file) {
+        std::fclose(m_file);
+    }
+}
+
+void EditJournal::recordEdit(const glm::ivec2& chunkPos, int index, BlockType type) {
+    if (index < 0 || index >= CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_edits[chunkPos][static_cast<uint16_t>(index)] = type;
+    m_pendingRecords.push_back({chunkPos.x, chunkPos.y, static_cast<uint16_t>(index), static_cast<uint16_t>(type)});
+    m_recordCount++;
+}
+
+int EditJournal::applyEdits(const glm::ivec2& chunkPos, Chunk& chunk) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_edits.find(chunkPos);
+    if (it == m_edits.end()) {
+        return 0;
+    }
+
+    for (const auto& [index, type] : it->second) {
+        int x = index % CHUNK_SIZE;
+        int z = (index / CHUNK_SIZE) % CHUNK_SIZE;
+        int y = index / (CHUNK_SIZE * CHUNK_SIZE);
+        chunk.setBlock(x, y, z, type);
+    }
+    return static_cast<int>(it->second.size());
+}
+
+void EditJournal::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (!m_pendingRecords.empty() && m_file) {
+        // The journal is the only copy of these edits - keep them pending until they are on disk
+        std::fseek(m_file, 0, SEEK_END);
+        long end = std::ftell(m_file);
+        size_t written = std::fwrite(m_pendingRecords.data(), sizeof(Record), m_pendingRecords.size(), m_file);
+        if (written == m_pendingRecords.size() && std::fflush(m_file) == 0) {
+            m_pendingRecords.clear();
+        } else {
+            // Cut off whatever part did land, so the retry appends whole records
+            std::cerr << "EditJournal: Failed to write " << m_path << " - will retry" << std::endl;
+            std::clearerr(m_file);
+            if (end >= 0 && ftruncate(fileno(m_file), end) != 0) {
+                std::cerr << "EditJournal: Failed to truncate " << m_path << std::endl;
+            }
+        }
+    }
+
+    size_t liveEdits = 0;
+    for (const auto& [pos, edits] : m_edits) {
+        liveEdits += edits.size();
+    }
+    bool worthCompacting = m_recordCount >= COMPACT_MIN_RECORDS && m_recordCount > liveEdits * 2;
+    lock.unlock();
+
+    if (worthCompacting) {
+        compact();
+    }
+}
+
+bool EditJournal::compact() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Write the live set to a temporary file, then atomically replace the journal
+    std::error_code error;
+    std::string tempPath = m_path + ".tmp";
+    std::FILE* temp = std::fopen(tempPath.c_str(), "wb");
+    if (!temp) {
+        std::cerr << "EditJournal: Failed to create " << tempPath << std::endl;
+        return false;
+    }
+
+    uint32_t header[2] = {MAGIC, m_seed};
+    bool ok = std::fwrite(header, sizeof(header), 1, temp) == 1;
+
+    size_t written = 0;
+    for (const auto& [pos, edits] : m_edits) {
+        for (const auto& [index, type] : edits) {
+            Record record{pos.x, pos.y, index, static_cast<uint16_t>(type)};
+            ok = ok && std::fwrite(&record, sizeof(record), 1, temp) == 1;
+            written++;
+        }
+    }
+
+    // On disk before the rename - otherwise a power loss can leave the new name on an empty file
+    ok = ok && std::fflush(temp) == 0 && fsync(fileno(temp)) == 0;
+    ok = std::fclose(temp) == 0 && ok;
+    if (!ok) {
+        std::cerr << "EditJournal: Failed to write " << tempPath << std::endl;
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+
+    std::filesystem::rename(tempPath, m_path, error);
+    if (error) {
+        std::cerr << "EditJournal: Failed to replace journal: " << error.message() << std::endl;
+    } else {
+        std::cout << "EditJournal: Compacted " << m_recordCount << " records to " << written << std::endl;
+        m_recordCount = written + m_pendingRecords.size();
+    }
+
+    return openForAppend() && !error;
+}
+
+size_t EditJournal::getEditCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (const auto& [pos, edits] : m_edits) {
+        count += edits.size();
+    }
+    return count;
+}
+
+size_t EditJournal::getRecordCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_recordCount;
+}
+
+bool EditJournal::replay() {
+    std::FILE* file = std::fopen(m_path.c_str(), "rb");
+    if (!file) {
+        return false;  // No journal yet - nothing has been edited
+    }
+
+    uint32_t header[2] = {0, 0};
+    if (std::fread(header, sizeof(header), 1, file) != 1 || header[0] != MAGIC) {
+        std::cerr << "EditJournal: " << m_path << " has an unknown format, moving it aside" << std::endl;
+        std::fclose(file);
+        std::error_code error;
+        std::filesystem::rename(m_path, m_path + ".corrupt", error);
+        return false;
+    }
+    if (header[1] != m_seed) {
+        // Keep the old save around - it belongs to a different world
+        std::string oldPath = m_path + ".seed" + std::to_string(header[1]);
+        std::cout << "EditJournal: Journal belongs to seed " << header[1] << ", moved to " << oldPath << std::endl;
+        std::fclose(file);
+        std::error_code error;
+        std::filesystem::rename(m_path, oldPath, error);
+        return false;
+    }
+
+    // Later records win; a torn record at the end (crash mid-write) is dropped
+    Record record;
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+        if (record.index < CHUNK_SIZE * CHUNK_HEIGHT * CHUNK_SIZE) {
+            m_edits[glm::ivec2(record.chunkX, record.chunkZ)][record.index] = static_cast<BlockType>(record.blockType);
+        }
+        m_recordCount++;
+    }
+    std::fclose(file);
+
+    // Cut off any partial trailing record so new appends stay aligned
+    std::error_code error;
+    std::filesystem::resize_file(m_path, sizeof(header) + m_recordCount * sizeof(Record), error);
+    return true;
+}
+
+bool EditJournal::openForAppend() {
+    bool isNew = !std::filesystem::exists(m_path);
+
+    m_file = std::fopen(m_path.c_str(), "ab");
+    if (!m_file) {
+        std::cerr << "EditJournal: Failed to open " << m_path << " - edits will not be saved" << std::endl;
+        return false;
+    }
+
+    if (isNew) {
+        uint32_t header[2] = {MAGIC, m_seed};
+        std::fwrite(header, sizeof(header), 1, m_file);
+        std::fflush(m_file);
+    }
+    return true;
+}
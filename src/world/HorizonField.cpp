@@ -0,0 +1,178 @@
+#include "world/HorizonField.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Flat colours of the surface blocks, close to their textures' average
+const glm::vec3 GRASS_COLOR(0.36f, 0.60f, 0.25f);
+const glm::vec3 SAND_COLOR(0.86f, 0.81f, 0.58f);
+const glm::vec3 STONE_COLOR(0.52f, 0.52f, 0.52f);
+const glm::vec3 WATER_COLOR(0.20f, 0.40f, 0.78f);
+
+constexpr int BEACH_HEIGHT = 1;     // Blocks above the water that read as sand
+constexpr int STONE_HEIGHT = 56;    // Peaks at and above this read as bare stone
+
+} // namespace
+
+HorizonField::HorizonField(const ModularWorldGenerator* generator, float radius)
+    : m_generator(generator)
+    , m_samplesTaken(0) {
+    setRadius(radius);
+}
+
+void HorizonField::setRadius(float radius) {
+    // A snapped level reaches at least GRID_SIZE / 2 - 2 cells past the camera
+    int levelCount = 1;
+    while ((GRID_SIZE / 2 - 2) * (BASE_SPACING << (levelCount - 1)) < radius) {
+        levelCount++;
+    }
+
+    m_levels.assign(levelCount, Level());
+    for (int i = 0; i < levelCount; ++i) {
+        m_levels[i].spacing = BASE_SPACING << i;
+        m_levels[i].samples.resize(SAMPLES * SAMPLES);
+    }
+}
+
+int HorizonField::update(const glm::vec3& cameraPos) {
+    int changed = 0;
+    bool finerMoved = false;
+    for (Level& level : m_levels) {
+        glm::ivec2 cameraCell(static_cast<int>(std::floor(cameraPos.x / level.spacing)),
+                              static_cast<int>(std::floor(cameraPos.z / level.spacing)));
+        glm::ivec2 origin(static_cast<int>(std::floor((cameraCell.x - GRID_SIZE / 2) / 2.0)) * 2,
+                          static_cast<int>(std::floor((cameraCell.y - GRID_SIZE / 2) / 2.0)) * 2);
+        if (level.valid && origin == level.origin) {
+            // The hole under the finer level moved with it
+            if (finerMoved) {
+                level.dirty = true;
+                changed++;
+            }
+            finerMoved = false;
+            continue;
+        }
+
+        glm::ivec2 delta = origin - level.origin;
+        int last = SAMPLES - 1;
+        if (!level.valid || std::abs(delta.x) >= SAMPLES || std::abs(delta.y) >= SAMPLES) {
+            sampleRange(level, origin.x, origin.x + last, origin.y, origin.y + last);
+        } else {
+            // ⚡ Only what scrolled in - the wrapped grid keeps everything else in place
+            if (delta.x > 0) {
+                sampleRange(level, level.origin.x + SAMPLES, origin.x + last, origin.y, origin.y + last);
+            } else if (delta.x < 0) {
+                sampleRange(level, origin.x, level.origin.x - 1, origin.y, origin.y + last);
+            }
+            if (delta.y > 0) {
+                sampleRange(level, origin.x, origin.x + last, level.origin.y + SAMPLES, origin.y + last);
+            } else if (delta.y < 0) {
+                sampleRange(level, origin.x, origin.x + last, origin.y, level.origin.y - 1);
+            }
+        }
+
+        level.origin = origin;
+        level.valid = true;
+        level.dirty = true;
+        changed++;
+        finerMoved = true;
+    }
+    return changed;
+}
+
+void HorizonField::buildLevelMesh(int levelIndex, HorizonMeshData& meshData) {
+    Level& level = m_levels[levelIndex];
+    meshData.vertices.clear();
+    meshData.indices.clear();
+    meshData.vertices.reserve(SAMPLES * SAMPLES);
+    meshData.indices.reserve(GRID_SIZE * GRID_SIZE * 6);
+
+    // The outer edge of every level but the last meets a coarser one: its odd
+    // vertices sit halfway along a coarse edge and must lie on it, or cracks open
+    bool stitchEdge = levelIndex + 1 < getLevelCount();
+    auto heightAt = [&](int x, int z) {
+        x = std::clamp(x, 0, GRID_SIZE);
+        z = std::clamp(z, 0, GRID_SIZE);
+        int gridX = level.origin.x + x;
+        int gridZ = level.origin.y + z;
+        bool edgeRow = z == 0 || z == GRID_SIZE;
+        bool edgeColumn = x == 0 || x == GRID_SIZE;
+        if (stitchEdge && edgeRow && (gridX & 1)) {
+            return (getSample(level, gridX - 1, gridZ).height + getSample(level, gridX + 1, gridZ).height) * 0.5f;
+        }
+        if (stitchEdge && edgeColumn && (gridZ & 1)) {
+            return (getSample(level, gridX, gridZ - 1).height + getSample(level, gridX, gridZ + 1).height) * 0.5f;
+        }
+        return getSample(level, gridX, gridZ).height;
+    };
+
+    float spacing = static_cast<float>(level.spacing);
+    for (int z = 0; z < SAMPLES; ++z) {
+        for (int x = 0; x < SAMPLES; ++x) {
+            int gridX = level.origin.x + x;
+            int gridZ = level.origin.y + z;
+            float height = heightAt(x, z);
+
+            float slopeX = (heightAt(x + 1, z) - heightAt(x - 1, z)) / (2.0f * spacing);
+            float slopeZ = (heightAt(x, z + 1) - heightAt(x, z - 1)) / (2.0f * spacing);
+            meshData.vertices.push_back({glm::vec3(gridX * spacing, height, gridZ * spacing),
+                                         glm::normalize(glm::vec3(-slopeX, 1.0f, -slopeZ)),
+                                         getSample(level, gridX, gridZ).color});
+        }
+    }
+
+    // Cells under the next finer level are drawn by it
+    glm::ivec2 holeMin(GRID_SIZE), holeMax(-1);
+    if (levelIndex > 0) {
+        const glm::ivec2& finerOrigin = m_levels[levelIndex - 1].origin;  // Even, so halves exactly
+        holeMin = glm::ivec2(finerOrigin.x / 2, finerOrigin.y / 2) - level.origin;
+        holeMax = holeMin + glm::ivec2(GRID_SIZE / 2);
+    }
+
+    for (int z = 0; z < GRID_SIZE; ++z) {
+        for (int x = 0; x < GRID_SIZE; ++x) {
+            if (x >= holeMin.x && x < holeMax.x && z >= holeMin.y && z < holeMax.y) continue;
+
+            unsigned int i0 = z * SAMPLES + x;
+            unsigned int i1 = i0 + 1;
+            unsigned int i2 = i0 + SAMPLES + 1;
+            unsigned int i3 = i0 + SAMPLES;
+            meshData.indices.insert(meshData.indices.end(), {i0, i3, i2, i2, i1, i0});
+        }
+    }
+
+    level.dirty = false;
+}
+
+HorizonField::Sample HorizonField::sampleTerrain(int worldX, int worldZ) const {
+    int height = m_generator->getTerrainHeight(worldX, worldZ);
+    int waterLevel = m_generator->getWaterLevel();
+
+    // Blocks are centred on whole coordinates, so a surface's top is half a block up
+    if (height < waterLevel) {
+        return {waterLevel + 0.5f, WATER_COLOR};
+    }
+    if (height <= waterLevel + BEACH_HEIGHT) {
+        return {height + 0.5f, SAND_COLOR};
+    }
+    return {height + 0.5f, height >= STONE_HEIGHT ? STONE_COLOR : GRASS_COLOR};
+}
+
+void HorizonField::sampleRange(Level& level, int minX, int maxX, int minZ, int maxZ) {
+    for (int gridZ = minZ; gridZ <= maxZ; ++gridZ) {
+        for (int gridX = minX; gridX <= maxX; ++gridX) {
+            level.samples[wrap(gridX) + wrap(gridZ) * SAMPLES] =
+                sampleTerrain(gridX * level.spacing, gridZ * level.spacing);
+        }
+    }
+    m_samplesTaken += static_cast<size_t>(std::max(0, maxX - minX + 1)) * std::max(0, maxZ - minZ + 1);
+}
+
+const HorizonField::Sample& HorizonField::getSample(const Level& level, int gridX, int gridZ) const {
+    return level.samples[wrap(gridX) + wrap(gridZ) * SAMPLES];
+}
+
+int HorizonField::wrap(int gridIndex) {
+    int wrapped = gridIndex % SAMPLES;
+    return wrapped < 0 ? wrapped + SAMPLES : wrapped;
+}
@@ -3,11 +3,88 @@
 #include "world/Chunk.h"
 #include "world/features/TreeFeature.h"
 #include "world/WorldConfig.h"
+#include "utils/ModernCpp.h"
 #include <algorithm>
 #include <iostream>
+#include <sstream>
 
-ModularWorldGenerator::ModularWorldGenerator(unsigned int seed) {
+ModularWorldGenerator::ModularWorldGenerator(unsigned int seed)
+    : m_seed(seed) {
     m_baseGenerator = std::make_unique<TerrainGenerator>(seed);
+    
+    // Everything that changes the generated blocks feeds the signature
+    const auto& terrain = g_worldConfig.terrain;
+    const auto& trees = g_worldConfig.trees;
+    std::ostringstream key;
+    key << GENERATOR_VERSION << ':' << seed << ':'
+        << terrain.seaLevel << ',' << terrain.minHeight << ',' << terrain.maxHeight << ':'
+        << terrain.heightNoise.frequency << ',' << terrain.heightNoise.octaves << ','
+        << terrain.heightNoise.persistence << ',' << terrain.heightNoise.lacunarity << ','
+        << terrain.heightNoise.amplitude << ':'
+        << terrain.lakes.enabled << ',' << terrain.lakes.frequency << ',' << terrain.lakes.threshold << ','
+        << terrain.lakes.maxDepth << ':'
+        << terrain.plains.enabled << ',' << terrain.plains.frequency << ',' << terrain.plains.threshold << ','
+        << terrain.plains.flatnessRadius << ',' << terrain.plains.flatnessStrength << ':'
+        << terrain.gravel.enabled << ',' << terrain.gravel.frequency << ',' << terrain.gravel.density << ','
+        << terrain.gravel.maxDistance << ',' << terrain.gravel.edgeBonus << ':'
+        << terrain.caves.enabled << ',' << terrain.caves.frequency << ',' << terrain.caves.threshold << ','
+        << terrain.caves.octaves << ',' << terrain.caves.surfaceMargin << ':'
+        << trees.frequency << ',' << trees.threshold << ',' << trees.minHeight << ','
+        << trees.maxHeight << ',' << trees.minSpacing;
+    std::string keyString = key.str();
+    std::uint64_t hash = Utils::fnv1a64(keyString.data(), keyString.size());
+    m_signature = static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+std::unique_ptr<ModularWorldGenerator> ModularWorldGenerator::createDefault(unsigned int seed) {
+    auto generator = std::make_unique<ModularWorldGenerator>(seed);
+    
+    // Add tree generation feature with config parameters
+    auto treeFeature = std::make_unique<TreeFeature>(seed);
+    
+    // Configure tree parameters from world config
+    TreeFeature::TreeParams treeParams;
+    treeParams.frequency = g_worldConfig.trees.frequency;
+    treeParams.threshold = g_worldConfig.trees.threshold;
+    treeParams.minHeight = g_worldConfig.trees.minHeight;
+    treeParams.maxHeight = g_worldConfig.trees.maxHeight;
+    treeParams.minSpacing = g_worldConfig.trees.minSpacing;
+    treeFeature->setParams(treeParams);
+    
+    generator->addFeature(std::move(treeFeature));
+    return generator;
+}
+
+void FeaturePlacement::getCandidates(const glm::ivec2& chunkPos, unsigned int seed,
+                                     std::vector<glm::ivec2>& candidates) const {
+    auto floorDiv = [](int value, int divisor) {
+        return (value >= 0 ? value : value - divisor + 1) / divisor;
+    };
+    
+    int minX = chunkPos.x * CHUNK_SIZE;
+    int minZ = chunkPos.y * CHUNK_SIZE;
+    int firstCellX = floorDiv(minX, cellSize);
+    int firstCellZ = floorDiv(minZ, cellSize);
+    int lastCellX = floorDiv(minX + CHUNK_SIZE - 1, cellSize);
+    int lastCellZ = floorDiv(minZ + CHUNK_SIZE - 1, cellSize);
+    
+    for (int cellX = firstCellX; cellX <= lastCellX; ++cellX) {
+        for (int cellZ = firstCellZ; cellZ <= lastCellZ; ++cellZ) {
+            // Same cell, same point - whichever chunk asks
+            std::uint64_t state = seed ^ salt;
+            state = Utils::splitMix64(state) ^
+                    ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+                     static_cast<std::uint32_t>(cellZ));
+            int pointX = cellX * cellSize + static_cast<int>(Utils::splitMix64(state) % cellSize);
+            int pointZ = cellZ * cellSize + static_cast<int>(Utils::splitMix64(state) % cellSize);
+            
+            int localX = pointX - minX;
+            int localZ = pointZ - minZ;
+            if (localX >= 0 && localX < CHUNK_SIZE && localZ >= 0 && localZ < CHUNK_SIZE) {
+                candidates.emplace_back(localX, localZ);
+            }
+        }
+    }
 }
 
 void ModularWorldGenerator::addFeature(std::unique_ptr<TerrainFeature> feature) {
@@ -26,40 +103,134 @@ void ModularWorldGenerator::addFeature(std::unique_ptr<TerrainFeature> feature)
 void ModularWorldGenerator::generateChunk(Chunk& chunk) {
     glm::ivec2 chunkPos = chunk.getPosition();
     
-    // ⚡ PERFORMANCE: Pre-calculate terrain data for entire chunk
-    int heightMap[CHUNK_SIZE][CHUNK_SIZE];
-    bool lakeMap[CHUNK_SIZE][CHUNK_SIZE];
-    int maxHeights[CHUNK_SIZE][CHUNK_SIZE];
-    int waterLevel = m_baseGenerator->getWaterLevel();
+    // FEATURES: every chunk in the neighbourhood must reach the feature stage first,
+    // so all writes into this chunk (e.g. canopies of trees next door) are known
+    std::vector<BlockWrite> incoming[NEIGHBOURHOOD_SLOTS];
+    for (int slot = 0; slot < NEIGHBOURHOOD_SLOTS; ++slot) {
+        collectFeatureWrites(chunkPos + getNeighbourOffset(slot), chunkPos, incoming[slot]);
+    }
+    
+    // HEIGHTMAP: cached by our own feature stage unless the proto-chunk was evicted since
+    ProtoChunk heights;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(m_protoMutex);
+        auto it = m_protoChunks.find(chunkPos);
+        if (it != m_protoChunks.end()) {
+            if (it->second->stage != GenerationStage::EMPTY) {
+                std::copy(&it->second->heightMap[0][0], &it->second->heightMap[0][0] + CHUNK_SIZE * CHUNK_SIZE,
+                          &heights.heightMap[0][0]);
+                std::copy(&it->second->lakeMap[0][0], &it->second->lakeMap[0][0] + CHUNK_SIZE * CHUNK_SIZE,
+                          &heights.lakeMap[0][0]);
+                cached = true;
+            }
+            m_protoChunks.erase(it);  // Finalized chunks don't need their proto-chunk anymore
+        }
+    }
+    if (!cached) {
+        Utils::Timer heightmapTimer;
+        buildHeightmap(chunkPos, heights);
+        addStageTime(STAGE_HEIGHTMAP, heightmapTimer.elapsedUs());
+    }
     
-    // Batch calculate all terrain properties
+    // SURFACE: base terrain from the heightmap
+    Utils::Timer surfaceTimer;
+    buildSurface(chunk, heights);
+    addStageTime(STAGE_SURFACE, surfaceTimer.elapsedUs());
+    
+    // FINALIZE: replay feature writes in slot order, so the result never depends
+    // on which neighbour happened to run its features first
+    Utils::Timer finalizeTimer;
+    for (int slot = 0; slot < NEIGHBOURHOOD_SLOTS; ++slot) {
+        for (const BlockWrite& write : incoming[slot]) {
+            int x = write.index % CHUNK_SIZE;
+            int z = (write.index / CHUNK_SIZE) % CHUNK_SIZE;
+            int y = write.index / (CHUNK_SIZE * CHUNK_SIZE);
+            
+            if (write.onlyIntoAir) {
+                BlockType current = chunk.getBlockFast(x, y, z);
+                if (current != BlockType::AIR && current != write.type) {
+                    continue;
+                }
+            }
+            chunk.setBlockFast(x, y, z, write.type);
+        }
+    }
+    addStageTime(STAGE_FINALIZE, finalizeTimer.elapsedUs());
+    
+    // fixFloatingWaterBlocks(chunk);
+}
+
+void ModularWorldGenerator::generateHeightfield(const glm::ivec2& chunkPos, ChunkHeightfield& heightfield) {
+    // HEIGHTMAP: cached in the proto-chunk, so upgrading to full generation later reuses it
+    ProtoChunk heights;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(m_protoMutex);
+        auto it = m_protoChunks.find(chunkPos);
+        if (it != m_protoChunks.end() && it->second->stage != GenerationStage::EMPTY) {
+            std::copy(&it->second->heightMap[0][0], &it->second->heightMap[0][0] + CHUNK_SIZE * CHUNK_SIZE,
+                      &heights.heightMap[0][0]);
+            std::copy(&it->second->lakeMap[0][0], &it->second->lakeMap[0][0] + CHUNK_SIZE * CHUNK_SIZE,
+                      &heights.lakeMap[0][0]);
+            cached = true;
+        }
+    }
+    if (!cached) {
+        Utils::Timer heightmapTimer;
+        buildHeightmap(chunkPos, heights);
+        addStageTime(STAGE_HEIGHTMAP, heightmapTimer.elapsedUs());
+        
+        std::lock_guard<std::mutex> lock(m_protoMutex);
+        ProtoChunk& proto = getProtoChunk(chunkPos);
+        if (proto.stage == GenerationStage::EMPTY) {
+            std::copy(&heights.heightMap[0][0], &heights.heightMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &proto.heightMap[0][0]);
+            std::copy(&heights.lakeMap[0][0], &heights.lakeMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &proto.lakeMap[0][0]);
+            proto.stage = GenerationStage::HEIGHTMAP;
+        }
+        evictProtoChunks();
+    }
+    
+    // SURFACE: one block per column, the one buildSurface places at the terrain height
+    BlockType surface[CHUNK_SIZE][CHUNK_SIZE];
+    m_baseGenerator->getSurfaceBlocks(chunkPos, heights.heightMap, heights.lakeMap, surface);
+    heightfield.waterLevel = m_baseGenerator->getWaterLevel();
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            heightfield.height[x][z] = std::max(0, std::min(heights.heightMap[x][z], CHUNK_HEIGHT - 1));
+            heightfield.surface[x][z] = surface[x][z];
+        }
+    }
+}
+
+void ModularWorldGenerator::buildHeightmap(const glm::ivec2& chunkPos, ProtoChunk& proto) const {
+    // ⚡ PERFORMANCE: Pre-calculate terrain data for entire chunk
     for (int x = 0; x < CHUNK_SIZE; ++x) {
         for (int z = 0; z < CHUNK_SIZE; ++z) {
             int worldX = chunkPos.x * CHUNK_SIZE + x;
             int worldZ = chunkPos.y * CHUNK_SIZE + z;
             
-            heightMap[x][z] = m_baseGenerator->getTerrainHeight(worldX, worldZ);
-            lakeMap[x][z] = m_baseGenerator->shouldGenerateLake(worldX, worldZ);
-            
-            // Determine maximum height to generate
-            if (lakeMap[x][z]) {
-                maxHeights[x][z] = std::min(waterLevel, CHUNK_HEIGHT - 1);
-            } else {
-                maxHeights[x][z] = std::min(heightMap[x][z] + 10, CHUNK_HEIGHT - 1);
-            }
+            proto.heightMap[x][z] = m_baseGenerator->getTerrainHeight(worldX, worldZ);
+            proto.lakeMap[x][z] = m_baseGenerator->shouldGenerateLake(worldX, worldZ);
         }
     }
+}
+
+void ModularWorldGenerator::buildSurface(Chunk& chunk, const ProtoChunk& proto) const {
+    glm::ivec2 chunkPos = chunk.getPosition();
+    int waterLevel = m_baseGenerator->getWaterLevel();
     
     // Generate base terrain using pre-calculated data
     for (int x = 0; x < CHUNK_SIZE; ++x) {
         for (int z = 0; z < CHUNK_SIZE; ++z) {
             int worldX = chunkPos.x * CHUNK_SIZE + x;
             int worldZ = chunkPos.y * CHUNK_SIZE + z;
-            int terrainHeight = heightMap[x][z];
-            bool isLake = lakeMap[x][z];
-            int maxY = maxHeights[x][z];
+            int terrainHeight = proto.heightMap[x][z];
+            
+            // Determine maximum height to generate
+            int maxY = proto.lakeMap[x][z] ? std::min(waterLevel, CHUNK_HEIGHT - 1)
+                                           : std::min(terrainHeight + 10, CHUNK_HEIGHT - 1);
             
-            // Generate base terrain first
             for (int y = 0; y <= maxY; ++y) {
                 // Get base block type
                 BlockType blockType = m_baseGenerator->getBlockType(worldX, y, worldZ, terrainHeight);
@@ -73,43 +244,153 @@ void ModularWorldGenerator::generateChunk(Chunk& chunk) {
         }
     }
     
-    // FEATURE GENERATION: Generate features after base terrain is complete
-    for (int x = 0; x < CHUNK_SIZE; ++x) {
-        for (int z = 0; z < CHUNK_SIZE; ++z) {
-            int worldX = chunkPos.x * CHUNK_SIZE + x;
-            int worldZ = chunkPos.y * CHUNK_SIZE + z;
-            int terrainHeight = heightMap[x][z];
-            bool isLake = lakeMap[x][z];
+    if (g_worldConfig.terrain.caves.enabled) {
+        m_baseGenerator->carveCaves(chunk, proto.heightMap);
+    }
+}
+
+void ModularWorldGenerator::runFeatures(const glm::ivec2& chunkPos, const ProtoChunk& proto, FeatureWriter& writer) const {
+    int waterLevel = m_baseGenerator->getWaterLevel();
+    
+    // First feature (by priority) to claim a column gets it
+    bool claimed[CHUNK_SIZE][CHUNK_SIZE] = {};
+    std::vector<glm::ivec2> candidates;
+    candidates.reserve(CHUNK_SIZE * CHUNK_SIZE);
+    
+    for (auto& feature : m_features) {
+        // ⚡ PERFORMANCE: Sparse features only see their few candidate columns
+        FeaturePlacement placement = feature->getPlacement();
+        candidates.clear();
+        if (placement.cellSize > 0) {
+            placement.getCandidates(chunkPos, m_seed, candidates);
+        } else {
+            for (int x = 0; x < CHUNK_SIZE; ++x) {
+                for (int z = 0; z < CHUNK_SIZE; ++z) {
+                    candidates.emplace_back(x, z);
+                }
+            }
+        }
+        
+        for (const glm::ivec2& local : candidates) {
+            if (claimed[local.x][local.y]) continue;
+            
+            int terrainHeight = proto.heightMap[local.x][local.y];
             
             // Only check for features at the surface level (1 block above terrain)
             int surfaceY = terrainHeight + 1;
-            if (surfaceY < CHUNK_HEIGHT) {
-                glm::ivec3 worldPos(worldX, surfaceY, worldZ);
-                TerrainContext context(chunkPos.x, chunkPos.y, terrainHeight, isLake, waterLevel, worldPos);
-                
-                // Check each feature for this surface position
-                for (auto& feature : m_features) {
-                    if (feature->shouldGenerate(context)) {
-                        feature->generate(chunk, context);
-                        break; // First feature that wants to generate gets priority
-                    }
-                }
+            if (surfaceY >= CHUNK_HEIGHT) continue;
+            
+            glm::ivec3 worldPos(chunkPos.x * CHUNK_SIZE + local.x, surfaceY, chunkPos.y * CHUNK_SIZE + local.y);
+            TerrainContext context(chunkPos.x, chunkPos.y, terrainHeight, proto.lakeMap[local.x][local.y],
+                                   waterLevel, worldPos);
+            if (feature->shouldGenerate(context)) {
+                feature->generate(writer, context);
+                claimed[local.x][local.y] = true;
             }
         }
     }
+}
+
+void ModularWorldGenerator::collectFeatureWrites(const glm::ivec2& sourcePos, const glm::ivec2& targetPos,
+                                                 std::vector<BlockWrite>& writes) {
+    glm::ivec2 offset = sourcePos - targetPos;
+    int incomingSlot = getNeighbourSlot(offset.x, offset.y);   // Source as seen from the target
+    int outgoingSlot = getNeighbourSlot(-offset.x, -offset.y); // Target as seen from the source
     
-    // POST-PROCESSING: Ensure all tree positions have complete trees
-    // This will find any tree trunks without adequate leaves and fix them
-    for (auto& feature : m_features) {
-        if (feature->getName() == "TreeFeature") {
-            TreeFeature* treeFeature = static_cast<TreeFeature*>(feature.get());
-            treeFeature->ensureAllTreesGenerated(chunk);
+    std::unique_lock<std::mutex> lock(m_protoMutex);
+    while (true) {
+        ProtoChunk& target = getProtoChunk(targetPos);
+        if (target.hasIncoming[incomingSlot]) {
+            writes = target.incoming[incomingSlot];
+            return;
+        }
+        
+        // Another thread is producing exactly these writes - wait instead of doing the work twice
+        ProtoChunk& source = getProtoChunk(sourcePos);
+        if (!source.featuresRunning) {
             break;
         }
+        m_protoCondition.wait(lock);
+    }
+    
+    ProtoChunk& source = getProtoChunk(sourcePos);
+    source.featuresRunning = true;
+    ProtoChunk heights;
+    bool cached = source.stage != GenerationStage::EMPTY;
+    if (cached) {
+        std::copy(&source.heightMap[0][0], &source.heightMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &heights.heightMap[0][0]);
+        std::copy(&source.lakeMap[0][0], &source.lakeMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &heights.lakeMap[0][0]);
+    }
+    lock.unlock();
+    
+    // Heavy work happens outside the lock
+    if (!cached) {
+        Utils::Timer heightmapTimer;
+        buildHeightmap(sourcePos, heights);
+        addStageTime(STAGE_HEIGHTMAP, heightmapTimer.elapsedUs());
+    }
+    Utils::Timer featuresTimer;
+    FeatureWriter writer(sourcePos);
+    runFeatures(sourcePos, heights, writer);
+    addStageTime(STAGE_FEATURES, featuresTimer.elapsedUs());
+    writes = writer.getWrites(outgoingSlot);
+    
+    lock.lock();
+    ProtoChunk& finished = getProtoChunk(sourcePos);
+    if (finished.stage == GenerationStage::EMPTY) {
+        std::copy(&heights.heightMap[0][0], &heights.heightMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &finished.heightMap[0][0]);
+        std::copy(&heights.lakeMap[0][0], &heights.lakeMap[0][0] + CHUNK_SIZE * CHUNK_SIZE, &finished.lakeMap[0][0]);
     }
+    finished.stage = GenerationStage::FEATURES;
+    finished.featuresRunning = false;
     
+    // Deliver into the pending-write buffers of the whole neighbourhood
+    for (int slot = 0; slot < NEIGHBOURHOOD_SLOTS; ++slot) {
+        glm::ivec2 neighbourOffset = getNeighbourOffset(slot);
+        ProtoChunk& neighbour = getProtoChunk(sourcePos + neighbourOffset);
+        int neighbourSlot = getNeighbourSlot(-neighbourOffset.x, -neighbourOffset.y);
+        neighbour.incoming[neighbourSlot] = std::move(writer.getWrites(slot));
+        neighbour.hasIncoming[neighbourSlot] = true;
+    }
+    
+    evictProtoChunks();
+    m_protoCondition.notify_all();
+}
 
-    // fixFloatingWaterBlocks(chunk);
+void ModularWorldGenerator::addStageTime(Stage stage, double micros) {
+    m_stageMicros[stage] += static_cast<uint64_t>(micros);
+    m_stageRuns[stage]++;
+}
+
+ProtoChunk& ModularWorldGenerator::getProtoChunk(const glm::ivec2& chunkPos) {
+    auto& proto = m_protoChunks[chunkPos];
+    if (!proto) {
+        proto = std::make_unique<ProtoChunk>();
+    }
+    proto->lastUsed = ++m_protoTick;
+    return *proto;
+}
+
+void ModularWorldGenerator::evictProtoChunks() {
+    if (m_protoChunks.size() <= MAX_PROTO_CHUNKS) {
+        return;
+    }
+    
+    // Drop the least recently used quarter - anything evicted is simply regenerated when needed
+    std::vector<std::pair<uint64_t, glm::ivec2>> candidates;
+    candidates.reserve(m_protoChunks.size());
+    for (const auto& [pos, proto] : m_protoChunks) {
+        if (!proto->featuresRunning) {
+            candidates.emplace_back(proto->lastUsed, pos);
+        }
+    }
+    
+    size_t evictCount = std::min(candidates.size(), MAX_PROTO_CHUNKS / 4);
+    std::nth_element(candidates.begin(), candidates.begin() + evictCount, candidates.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t i = 0; i < evictCount; ++i) {
+        m_protoChunks.erase(candidates[i].second);
+    }
 }
 
 void ModularWorldGenerator::fixFloatingWaterBlocks(Chunk& chunk) {
@@ -1,6 +1,6 @@
 #include "world/PerlinNoise.h"
+#include "utils/ModernCpp.h"
 #include <algorithm>
-#include <random>
 #include <cmath>
 #include <numeric>
 
@@ -21,8 +21,12 @@ void PerlinNoise::generatePermutation(unsigned int seed) {
     std::iota(p.begin(), p.end(), 0);
     
     // Shuffle using the provided seed for deterministic but randomized results
-    std::default_random_engine generator(seed);
-    std::shuffle(p.begin(), p.end(), generator);
+    // (explicit Fisher-Yates - std::shuffle differs between standard libraries)
+    std::uint64_t state = seed;
+    for (int i = 255; i > 0; --i) {
+        int j = static_cast<int>(Utils::splitMix64(state) % static_cast<std::uint64_t>(i + 1));
+        std::swap(p[i], p[j]);
+    }
     
     // Duplicate the permutation to avoid overflow and provide seamless wrapping
     for (int i = 0; i < 256; ++i) {
@@ -117,6 +121,43 @@ double PerlinNoise::octaveNoise(double x, double y, double z, int octaves, doubl
     return maxValue > 0.0 ? total / maxValue : 0.0;
 }
 
+void PerlinNoise::octaveNoiseGrid(double x0, double y0, double z0, double stepX, double stepY, double stepZ,
+                                  int nx, int ny, int nz, int octaves, double persistence, double* out) const {
+    octaves = std::max(1, std::min(octaves, 8));
+    const int count = nx * ny * nz;
+    std::fill(out, out + count, 0.0);
+    
+    std::vector<double> xs(nx), zs(nz);
+    double frequency = 1.0;
+    double amplitude = 1.0;
+    double maxValue = 0.0;
+    
+    // Octave-major: one pass over the lattice per octave, coordinates computed once per row
+    for (int i = 0; i < octaves; ++i) {
+        for (int x = 0; x < nx; ++x) xs[x] = (x0 + x * stepX) * frequency;
+        for (int z = 0; z < nz; ++z) zs[z] = (z0 + z * stepZ) * frequency;
+        
+        double* value = out;
+        for (int y = 0; y < ny; ++y) {
+            double sampleY = (y0 + y * stepY) * frequency;
+            for (int z = 0; z < nz; ++z) {
+                for (int x = 0; x < nx; ++x) {
+                    *value++ += noise(xs[x], sampleY, zs[z]) * amplitude;
+                }
+            }
+        }
+        
+        maxValue += amplitude;
+        amplitude *= persistence;
+        frequency *= 2.0;
+    }
+    
+    // Normalize to maintain consistent range regardless of octave count
+    for (int i = 0; i < count; ++i) {
+        out[i] /= maxValue;
+    }
+}
+
 // 🌊 Improved fade function for smoother interpolation
 double PerlinNoise::fade(double t) {
     // Enhanced fade curve: 6t^5 - 15t^4 + 10t^3 (Ken Perlin's improved version)
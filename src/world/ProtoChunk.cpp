@@ -0,0 +1,33 @@
+#include "world/ProtoChunk.h"
+
+FeatureWriter::FeatureWriter(const glm::ivec2& chunkPos)
+    : m_chunkPos(chunkPos) {
+}
+
+void FeatureWriter::setBlock(int worldX, int y, int worldZ, BlockType type) {
+    record(worldX, y, worldZ, type, false);
+}
+
+void FeatureWriter::placeBlock(int worldX, int y, int worldZ, BlockType type) {
+    record(worldX, y, worldZ, type, true);
+}
+
+void FeatureWriter::record(int worldX, int y, int worldZ, BlockType type, bool onlyIntoAir) {
+    if (y < 0 || y >= CHUNK_HEIGHT) {
+        return;
+    }
+
+    // Floor division - world coordinates can be negative
+    int localX = worldX - m_chunkPos.x * CHUNK_SIZE;
+    int localZ = worldZ - m_chunkPos.y * CHUNK_SIZE;
+    int dx = (localX >= 0 ? localX : localX - CHUNK_SIZE + 1) / CHUNK_SIZE;
+    int dz = (localZ >= 0 ? localZ : localZ - CHUNK_SIZE + 1) / CHUNK_SIZE;
+    if (dx < -1 || dx > 1 || dz < -1 || dz > 1) {
+        return;
+    }
+
+    localX -= dx * CHUNK_SIZE;
+    localZ -= dz * CHUNK_SIZE;
+    uint16_t index = static_cast<uint16_t>(localX + localZ * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE);
+    m_writes[getNeighbourSlot(dx, dz)].push_back({index, type, onlyIntoAir});
+}
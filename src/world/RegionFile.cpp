@@ -0,0 +1,273 @@
+#include "world/RegionFile.h"
+#include <zlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+RegionFile::RegionFile(const std::string& path, uint32_t signature)
+    : m_path(path)
+    , m_signature(signature)
+    , m_fd(-1)
+    , m_mapped(nullptr)
+    , m_mappedSize(0)
+    , m_fileSize(0)
+    , m_table(REGION_CHUNK_COUNT) {
+}
+
+RegionFile::~RegionFile() {
+    unmap();
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+}
+
+bool RegionFile::open() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0) {
+        std::cerr << "RegionFile: Failed to open " << m_path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(m_fd, &st) != 0) {
+        std::cerr << "RegionFile: Failed to stat " << m_path << std::endl;
+        return false;
+    }
+    m_fileSize = static_cast<size_t>(st.st_size);
+
+    if (m_fileSize == 0) {
+        return initialize();
+    }
+
+    if (m_fileSize < DATA_START || !remap()) {
+        std::cerr << "RegionFile: " << m_path << " is truncated, rebuilding it" << std::endl;
+        return initialize();
+    }
+
+    uint32_t header[3] = {0, 0, 0};
+    std::memcpy(header, m_mapped, sizeof(header));
+    if (header[0] != MAGIC || header[1] != VERSION) {
+        std::cerr << "RegionFile: " << m_path << " has an unknown format, rebuilding it" << std::endl;
+        return initialize();
+    }
+    if (header[2] != m_signature) {
+        // Cached chunks came from another seed or other terrain settings
+        std::cout << "RegionFile: " << m_path << " was generated with different settings, discarding it" << std::endl;
+        return initialize();
+    }
+
+    std::memcpy(m_table.data(), m_mapped + HEADER_SIZE, TABLE_SIZE);
+
+    // Drop entries that point past the end of the file (interrupted write)
+    for (auto& entry : m_table) {
+        if (entry.offset != 0 && static_cast<size_t>(entry.offset) + entry.size > m_fileSize) {
+            entry = SectionEntry();
+        }
+    }
+    findFreeSectors();
+
+    return true;
+}
+
+bool RegionFile::initialize() {
+    // Fresh region - header and an empty offset table, no sections
+    unmap();
+    std::fill(m_table.begin(), m_table.end(), SectionEntry());
+    m_freeSectors.clear();
+
+    std::vector<uint8_t> header(DATA_START, 0);
+    uint32_t fields[3] = {MAGIC, VERSION, m_signature};
+    std::memcpy(header.data(), fields, sizeof(fields));
+
+    if (ftruncate(m_fd, 0) != 0 ||
+        pwrite(m_fd, header.data(), header.size(), 0) != static_cast<ssize_t>(header.size())) {
+        std::cerr << "RegionFile: Failed to initialize " << m_path << std::endl;
+        return false;
+    }
+    m_fileSize = header.size();
+    return remap();
+}
+
+bool RegionFile::hasChunk(int localX, int localZ) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_table[getTableIndex(localX, localZ)].offset != 0;
+}
+
+bool RegionFile::readChunk(int localX, int localZ, std::vector<BlockType>& blocks) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const SectionEntry& entry = m_table[getTableIndex(localX, localZ)];
+    if (entry.offset == 0 || entry.rawSize % sizeof(BlockType) != 0) {
+        return false;
+    }
+
+    // Sections written after the last mapping need a bigger view of the file
+    if (static_cast<size_t>(entry.offset) + entry.size > m_mappedSize && !remap()) {
+        return false;
+    }
+
+    blocks.resize(entry.rawSize / sizeof(BlockType));
+    uLongf destLength = entry.rawSize;
+    int result = uncompress(reinterpret_cast<Bytef*>(blocks.data()), &destLength,
+                            m_mapped + entry.offset, entry.size);
+
+    if (result != Z_OK || destLength != entry.rawSize) {
+        std::cerr << "RegionFile: Corrupt section for chunk (" << localX << ", " << localZ
+                  << ") in " << m_path << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool RegionFile::writeChunk(int localX, int localZ, const std::vector<uint8_t>& compressed, uint32_t rawSize) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int index = getTableIndex(localX, localZ);
+    SectionEntry previous = m_table[index];
+
+    // Always into sectors no entry points at - the old copy stays valid until the table moves
+    SectionEntry entry;
+    entry.capacity = static_cast<uint32_t>(((compressed.size() + SECTOR_SIZE - 1) / SECTOR_SIZE) * SECTOR_SIZE);
+    entry.offset = allocateSectors(entry.capacity);
+    entry.size = static_cast<uint32_t>(compressed.size());
+    entry.rawSize = rawSize;
+
+    // Data first, then the table entry - a crash in between leaves the old chunk intact
+    if (pwrite(m_fd, compressed.data(), compressed.size(), entry.offset) != static_cast<ssize_t>(compressed.size())) {
+        std::cerr << "RegionFile: Failed to write chunk section to " << m_path << std::endl;
+        releaseSectors(entry.offset, entry.capacity);
+        return false;
+    }
+    if (entry.offset + entry.capacity > m_fileSize) {
+        if (ftruncate(m_fd, static_cast<off_t>(entry.offset + entry.capacity)) != 0) {
+            std::cerr << "RegionFile: Failed to grow " << m_path << std::endl;
+            return false;
+        }
+        m_fileSize = entry.offset + entry.capacity;
+    }
+
+    off_t tableOffset = static_cast<off_t>(HEADER_SIZE + index * sizeof(SectionEntry));
+    if (pwrite(m_fd, &entry, sizeof(entry), tableOffset) != static_cast<ssize_t>(sizeof(entry))) {
+        std::cerr << "RegionFile: Failed to update offset table in " << m_path << std::endl;
+        releaseSectors(entry.offset, entry.capacity);
+        return false;
+    }
+
+    m_table[index] = entry;
+    if (previous.offset != 0) {
+        releaseSectors(previous.offset, previous.capacity);
+    }
+    return true;
+}
+
+void RegionFile::findFreeSectors() {
+    // Every gap between the sections the table points at can take new data
+    std::vector<std::pair<uint32_t, uint32_t>> used;
+    for (const auto& entry : m_table) {
+        if (entry.offset != 0) {
+            used.emplace_back(entry.offset, entry.capacity);
+        }
+    }
+    std::sort(used.begin(), used.end());
+
+    m_freeSectors.clear();
+    size_t position = DATA_START;
+    for (const auto& section : used) {
+        if (section.first > position) {
+            m_freeSectors[static_cast<uint32_t>(position)] = static_cast<uint32_t>(section.first - position);
+        }
+        position = std::max(position, static_cast<size_t>(section.first) + section.second);
+    }
+    if (m_fileSize > position) {
+        m_freeSectors[static_cast<uint32_t>(position)] = static_cast<uint32_t>(m_fileSize - position);
+    }
+}
+
+uint32_t RegionFile::allocateSectors(uint32_t capacity) {
+    // First fit, otherwise the end of the file
+    for (auto it = m_freeSectors.begin(); it != m_freeSectors.end(); ++it) {
+        if (it->second >= capacity) {
+            uint32_t offset = it->first;
+            uint32_t remaining = it->second - capacity;
+            m_freeSectors.erase(it);
+            if (remaining > 0) {
+                m_freeSectors[offset + capacity] = remaining;
+            }
+            return offset;
+        }
+    }
+    return static_cast<uint32_t>(m_fileSize);
+}
+
+void RegionFile::releaseSectors(uint32_t offset, uint32_t capacity) {
+    if (offset + capacity > m_fileSize) {
+        return;  // Never made it into the file
+    }
+    auto it = m_freeSectors.emplace(offset, capacity).first;
+
+    // Merge with the free runs on either side
+    auto next = std::next(it);
+    if (next != m_freeSectors.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        m_freeSectors.erase(next);
+    }
+    if (it != m_freeSectors.begin()) {
+        auto previous = std::prev(it);
+        if (previous->first + previous->second == it->first) {
+            previous->second += it->second;
+            m_freeSectors.erase(it);
+        }
+    }
+}
+
+glm::ivec2 RegionFile::chunkToRegion(const glm::ivec2& chunkPos) {
+    return glm::ivec2(
+        static_cast<int>(std::floor(static_cast<float>(chunkPos.x) / REGION_SIZE)),
+        static_cast<int>(std::floor(static_cast<float>(chunkPos.y) / REGION_SIZE))
+    );
+}
+
+glm::ivec2 RegionFile::chunkToLocal(const glm::ivec2& chunkPos) {
+    glm::ivec2 regionPos = chunkToRegion(chunkPos);
+    return chunkPos - regionPos * REGION_SIZE;
+}
+
+std::string RegionFile::getFileName(const glm::ivec2& regionPos) {
+    return "r." + std::to_string(regionPos.x) + "." + std::to_string(regionPos.y) + ".mcr";
+}
+
+bool RegionFile::remap() {
+    unmap();
+
+    if (m_fileSize == 0) {
+        return true;
+    }
+
+    void* mapped = mmap(nullptr, m_fileSize, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "RegionFile: mmap failed for " << m_path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    m_mapped = static_cast<const uint8_t*>(mapped);
+    m_mappedSize = m_fileSize;
+    return true;
+}
+
+void RegionFile::unmap() {
+    if (m_mapped) {
+        munmap(const_cast<uint8_t*>(m_mapped), m_mappedSize);
+        m_mapped = nullptr;
+        m_mappedSize = 0;
+    }
+}
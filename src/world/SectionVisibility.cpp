@@ -0,0 +1,101 @@
+#include "world/SectionVisibility.h"
+#include <cstdint>
+
+namespace {
+
+constexpr int SIZE = SectionVisibility::SIZE;
+constexpr int CELLS = SIZE * SIZE * SIZE;
+
+// Faces a cell sits on, as a bit mask
+int getCellFaces(int x, int y, int z) {
+    int faces = 0;
+    if (x == 0) faces |= 1 << SectionVisibility::NEG_X;
+    if (x == SIZE - 1) faces |= 1 << SectionVisibility::POS_X;
+    if (y == 0) faces |= 1 << SectionVisibility::NEG_Y;
+    if (y == SIZE - 1) faces |= 1 << SectionVisibility::POS_Y;
+    if (z == 0) faces |= 1 << SectionVisibility::NEG_Z;
+    if (z == SIZE - 1) faces |= 1 << SectionVisibility::POS_Z;
+    return faces;
+}
+
+} // namespace
+
+glm::ivec3 SectionVisibility::getDirection(int face) {
+    static const glm::ivec3 directions[FACE_COUNT] = {
+        {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0},
+        { 0,  1,  0}, { 0,  0, -1}, { 0,  0,  1}
+    };
+    return directions[face];
+}
+
+SectionVisibility SectionVisibility::compute(const std::vector<BlockType>& blocks, int sectionY) {
+    if (blocks.size() < static_cast<size_t>((sectionY + 1) * CELLS)) {
+        return SectionVisibility();
+    }
+
+    // Section cells use the chunk's own index order, so one offset maps them
+    const BlockType* section = blocks.data() + sectionY * CELLS;
+
+    // ⚡ Most sections are all stone or all air - no fill needed
+    int seeThrough = 0;
+    for (int i = 0; i < CELLS; ++i) {
+        seeThrough += isSeeThrough(section[i]);
+    }
+    if (seeThrough == 0) {
+        return none();
+    }
+    if (seeThrough == CELLS) {
+        return SectionVisibility();
+    }
+
+    SectionVisibility result = none();
+    bool visited[CELLS] = {};
+    std::uint16_t stack[CELLS];
+
+    for (int start = 0; start < CELLS; ++start) {
+        if (visited[start] || !isSeeThrough(section[start])) continue;
+
+        // Flood one region, collecting the faces it reaches
+        int faces = 0;
+        int top = 0;
+        stack[top++] = static_cast<std::uint16_t>(start);
+        visited[start] = true;
+
+        while (top > 0) {
+            int index = stack[--top];
+            int x = index % SIZE;
+            int z = (index / SIZE) % SIZE;
+            int y = index / (SIZE * SIZE);
+            faces |= getCellFaces(x, y, z);
+
+            const int neighbours[6] = {
+                x > 0 ? index - 1 : -1,
+                x < SIZE - 1 ? index + 1 : -1,
+                z > 0 ? index - SIZE : -1,
+                z < SIZE - 1 ? index + SIZE : -1,
+                y > 0 ? index - SIZE * SIZE : -1,
+                y < SIZE - 1 ? index + SIZE * SIZE : -1
+            };
+            for (int neighbour : neighbours) {
+                if (neighbour >= 0 && !visited[neighbour] && isSeeThrough(section[neighbour])) {
+                    visited[neighbour] = true;
+                    stack[top++] = static_cast<std::uint16_t>(neighbour);
+                }
+            }
+        }
+
+        for (int a = 0; a < FACE_COUNT; ++a) {
+            if (!(faces & (1 << a))) continue;
+            for (int b = a; b < FACE_COUNT; ++b) {
+                if (faces & (1 << b)) {
+                    result.connect(a, b);
+                }
+            }
+        }
+        if (result.isOpen()) {
+            break;  // Nothing left to learn
+        }
+    }
+
+    return result;
+}
@@ -192,6 +192,55 @@ BlockType TerrainGenerator::getBlockType(int worldX, int worldY, int worldZ, int
     return BlockType::STONE;
 }
 
+void TerrainGenerator::getSurfaceBlocks(const glm::ivec2& chunkPos, const int heightMap[CHUNK_SIZE][CHUNK_SIZE],
+                                        const bool lakeMap[CHUNK_SIZE][CHUNK_SIZE],
+                                        BlockType surface[CHUNK_SIZE][CHUNK_SIZE]) const {
+    // getBlockType looks for ocean within 6 blocks of every column - 168 noise
+    // samples each. Sample the padded chunk once and answer the searches from a
+    // summed-area table of the ocean mask instead.
+    constexpr int SEARCH = 6;
+    constexpr int GRID = CHUNK_SIZE + 2 * SEARCH;
+    int baseX = chunkPos.x * CHUNK_SIZE - SEARCH;
+    int baseZ = chunkPos.y * CHUNK_SIZE - SEARCH;
+    
+    double continental[GRID][GRID];
+    int oceanSum[GRID + 1][GRID + 1] = {};
+    for (int x = 0; x < GRID; ++x) {
+        for (int z = 0; z < GRID; ++z) {
+            // Same expression as isInOceanArea, so the answers match bit for bit
+            continental[x][z] = m_continentNoise.octaveNoise((baseX + x) * 0.0008, (baseZ + z) * 0.0008, 3, 0.5);
+            oceanSum[x + 1][z + 1] = (continental[x][z] < -0.1 ? 1 : 0) + oceanSum[x][z + 1] + oceanSum[x + 1][z] - oceanSum[x][z];
+        }
+    }
+    
+    int waterLevel = m_params.waterLevel;
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            int worldX = chunkPos.x * CHUNK_SIZE + x;
+            int worldZ = chunkPos.y * CHUNK_SIZE + z;
+            int surfaceHeight = heightMap[x][z];
+            double continentalNoise = continental[x + SEARCH][z + SEARCH];
+            
+            if (continentalNoise < -0.1) {
+                surface[x][z] = surfaceHeight < waterLevel - 3 ? BlockType::DIRT : BlockType::SAND;
+            } else if (lakeMap[x][z]) {
+                surface[x][z] = BlockType::DIRT;
+            } else {
+                // Window is (2*SEARCH+1)^2 around the column; the column itself is known to be land
+                int oceanCount = oceanSum[x + 2 * SEARCH + 1][z + 2 * SEARCH + 1] - oceanSum[x][z + 2 * SEARCH + 1]
+                               - oceanSum[x + 2 * SEARCH + 1][z] + oceanSum[x][z];
+                surface[x][z] = BlockType::GRASS;
+                if (oceanCount > 0 && surfaceHeight <= waterLevel + 3 && continentalNoise > -0.2) {
+                    double beachVariation = m_lakeNoise.octaveNoise(worldX * 0.04, worldZ * 0.04, 2, 0.5);
+                    if (beachVariation > -0.2) {
+                        surface[x][z] = BlockType::SAND;
+                    }
+                }
+            }
+        }
+    }
+}
+
 double TerrainGenerator::getHeightNoise(double x, double z) const {
     // Use efficient FBM for main terrain shape
     double baseHeight = m_heightNoise.fbm(
@@ -248,10 +297,94 @@ int TerrainGenerator::getBaseHeight(int worldX, int worldZ) const {
     return height;
 }
 
-bool TerrainGenerator::shouldGenerateCave(int x, int y, int z) const {
- // uhm future cave nigga?
+int TerrainGenerator::carveCaves(Chunk& chunk, const int heightMap[CHUNK_SIZE][CHUNK_SIZE]) const {
+    const auto& caves = g_worldConfig.terrain.caves;
+    constexpr int LATTICE_XZ = CHUNK_SIZE / CAVE_CELL_XZ + 1;
+    constexpr int LATTICE_Y = CHUNK_HEIGHT / CAVE_CELL_Y + 1;
+    
+    // Nothing can be carved above the highest column minus the solid surface margin
+    int maxCarveY = 0;
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            maxCarveY = std::max(maxCarveY, heightMap[x][z] - caves.surfaceMargin);
+        }
+    }
+    maxCarveY = std::min(maxCarveY, CHUNK_HEIGHT - 1);
+    if (maxCarveY < 1) {
+        return 0;
+    }
     
-    return false;
+    // ⚡ PERFORMANCE: Sample density only on the coarse lattice, and only up to the
+    // highest carvable layer - 5x5 columns instead of 16x16, a handful of layers instead of 64
+    int sampleLayers = maxCarveY / CAVE_CELL_Y + 2;
+    glm::ivec2 chunkPos = chunk.getPosition();
+    double density[LATTICE_XZ * LATTICE_XZ * LATTICE_Y];
+    m_caveNoise.octaveNoiseGrid(
+        chunkPos.x * CHUNK_SIZE * caves.frequency, 0.0, chunkPos.y * CHUNK_SIZE * caves.frequency,
+        CAVE_CELL_XZ * caves.frequency,
+        CAVE_CELL_Y * caves.frequency * 1.5,   // Squashed vertically - wide caverns rather than shafts
+        CAVE_CELL_XZ * caves.frequency,
+        LATTICE_XZ, sampleLayers, LATTICE_XZ, caves.octaves, 0.5, density);
+    
+    auto sample = [&](int x, int y, int z) {
+        return density[x + LATTICE_XZ * (z + LATTICE_XZ * y)];
+    };
+    
+    int carved = 0;
+    for (int cellY = 0; cellY < sampleLayers - 1; ++cellY) {
+        for (int cellZ = 0; cellZ < LATTICE_XZ - 1; ++cellZ) {
+            for (int cellX = 0; cellX < LATTICE_XZ - 1; ++cellX) {
+                double corners[8] = {
+                    sample(cellX, cellY, cellZ),         sample(cellX + 1, cellY, cellZ),
+                    sample(cellX, cellY, cellZ + 1),     sample(cellX + 1, cellY, cellZ + 1),
+                    sample(cellX, cellY + 1, cellZ),     sample(cellX + 1, cellY + 1, cellZ),
+                    sample(cellX, cellY + 1, cellZ + 1), sample(cellX + 1, cellY + 1, cellZ + 1)
+                };
+                double minCorner = *std::min_element(corners, corners + 8);
+                double maxCorner = *std::max_element(corners, corners + 8);
+                
+                // Trilinear values never leave the corner range: skip provably solid cells,
+                // and carve provably empty ones without interpolating
+                if (maxCorner <= caves.threshold) continue;
+                bool allOpen = minCorner > caves.threshold;
+                
+                for (int dy = 0; dy < CAVE_CELL_Y; ++dy) {
+                    int y = cellY * CAVE_CELL_Y + dy;
+                    if (y < 1 || y > maxCarveY) continue;  // Keep the floor of the world
+                    double ty = static_cast<double>(dy) / CAVE_CELL_Y;
+                    
+                    for (int dz = 0; dz < CAVE_CELL_XZ; ++dz) {
+                        int z = cellZ * CAVE_CELL_XZ + dz;
+                        double tz = static_cast<double>(dz) / CAVE_CELL_XZ;
+                        
+                        for (int dx = 0; dx < CAVE_CELL_XZ; ++dx) {
+                            int x = cellX * CAVE_CELL_XZ + dx;
+                            if (y > heightMap[x][z] - caves.surfaceMargin) continue;
+                            
+                            if (!allOpen) {
+                                double tx = static_cast<double>(dx) / CAVE_CELL_XZ;
+                                double c00 = corners[0] + (corners[1] - corners[0]) * tx;
+                                double c10 = corners[2] + (corners[3] - corners[2]) * tx;
+                                double c01 = corners[4] + (corners[5] - corners[4]) * tx;
+                                double c11 = corners[6] + (corners[7] - corners[6]) * tx;
+                                double c0 = c00 + (c10 - c00) * tz;
+                                double c1 = c01 + (c11 - c01) * tz;
+                                if (c0 + (c1 - c0) * ty <= caves.threshold) continue;
+                            }
+                            
+                            BlockType current = chunk.getBlockFast(x, y, z);
+                            if (current != BlockType::AIR && current != BlockType::WATER) {
+                                chunk.setBlockFast(x, y, z, BlockType::AIR);
+                                carved++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    return carved;
 }
 
 bool TerrainGenerator::shouldGenerateLake(int worldX, int worldZ) const {
@@ -0,0 +1,99 @@
+#include "world/VisibilityGraph.h"
+#include <algorithm>
+#include <cmath>
+
+static_assert(SECTION_COUNT <= 8, "Column::visibleMask holds one bit per section");
+
+void VisibilityGraph::compute(const glm::vec3& cameraPos, int radius, const ColumnLookup& lookup,
+                              const SectionFilter& inView) {
+    m_center = glm::ivec2(static_cast<int>(std::floor(cameraPos.x / CHUNK_SIZE)),
+                          static_cast<int>(std::floor(cameraPos.z / CHUNK_SIZE)));
+    m_radius = std::max(0, radius);
+    m_side = 2 * m_radius + 1;
+    m_columns.assign(static_cast<size_t>(m_side) * m_side, Column());
+    m_queue.clear();
+    m_visibleSections = 0;
+
+    static const SectionVisibility openSection;
+    auto getSection = [&](const glm::ivec3& section, int columnIndex) -> const SectionVisibility& {
+        Column& column = m_columns[columnIndex];
+        if (!column.lookedUp) {
+            column.sections = lookup(glm::ivec2(section.x, section.z));
+            column.lookedUp = true;
+        }
+        return column.sections ? column.sections[section.y] : openSection;
+    };
+
+    // Seed the walk. From above or below the world, sight enters every column
+    // through its top or bottom face, so all of that layer is a starting point
+    int cameraSectionY = static_cast<int>(std::floor(cameraPos.y / SectionVisibility::SIZE));
+    if (cameraSectionY >= 0 && cameraSectionY < SECTION_COUNT) {
+        glm::ivec3 start(m_center.x, cameraSectionY, m_center.y);
+        visit(start, getColumnIndex(m_center), -1, 0);
+    } else {
+        bool above = cameraSectionY >= SECTION_COUNT;
+        int layer = above ? SECTION_COUNT - 1 : 0;
+        int entryFace = above ? SectionVisibility::POS_Y : SectionVisibility::NEG_Y;
+        int directions = 1 << SectionVisibility::opposite(entryFace);
+        for (int dz = -m_radius; dz <= m_radius; ++dz) {
+            for (int dx = -m_radius; dx <= m_radius; ++dx) {
+                glm::ivec3 section(m_center.x + dx, layer, m_center.y + dz);
+                if (inView && !inView(section)) continue;
+                visit(section, getColumnIndex(glm::ivec2(section.x, section.z)), entryFace, directions);
+            }
+        }
+    }
+
+    // ⚡ Breadth-first, so every section is reached first along its straightest path
+    for (size_t head = 0; head < m_queue.size(); ++head) {
+        Step step = m_queue[head];
+        const SectionVisibility& visibility =
+            getSection(step.section, getColumnIndex(glm::ivec2(step.section.x, step.section.z)));
+
+        for (int face = 0; face < SectionVisibility::FACE_COUNT; ++face) {
+            if (step.entryFace >= 0 && !visibility.connects(step.entryFace, face)) continue;
+            if (step.directions & (1 << SectionVisibility::opposite(face))) continue;  // Back towards the camera
+
+            glm::ivec3 next = step.section + SectionVisibility::getDirection(face);
+            if (next.y < 0 || next.y >= SECTION_COUNT) continue;
+
+            int columnIndex = getColumnIndex(glm::ivec2(next.x, next.z));
+            if (columnIndex < 0 || (m_columns[columnIndex].visibleMask & (1 << next.y))) continue;
+            if (inView && !inView(next)) continue;
+
+            visit(next, columnIndex, SectionVisibility::opposite(face), step.directions | (1 << face));
+        }
+    }
+}
+
+void VisibilityGraph::visit(const glm::ivec3& section, int columnIndex, int entryFace, int directions) {
+    Column& column = m_columns[columnIndex];
+    if (column.visibleMask & (1 << section.y)) {
+        return;
+    }
+    column.visibleMask |= static_cast<std::uint8_t>(1 << section.y);
+    m_visibleSections++;
+    m_queue.push_back({section, entryFace, directions});
+}
+
+bool VisibilityGraph::isSectionVisible(const glm::ivec3& section) const {
+    int columnIndex = getColumnIndex(glm::ivec2(section.x, section.z));
+    if (columnIndex < 0 || section.y < 0 || section.y >= SECTION_COUNT) {
+        return true;
+    }
+    return (m_columns[columnIndex].visibleMask >> section.y) & 1;
+}
+
+bool VisibilityGraph::isChunkVisible(const glm::ivec2& chunkPos) const {
+    int columnIndex = getColumnIndex(chunkPos);
+    return columnIndex < 0 || m_columns[columnIndex].visibleMask != 0;
+}
+
+int VisibilityGraph::getColumnIndex(const glm::ivec2& chunkPos) const {
+    int dx = chunkPos.x - m_center.x;
+    int dz = chunkPos.y - m_center.y;
+    if (m_radius < 0 || std::abs(dx) > m_radius || std::abs(dz) > m_radius) {
+        return -1;
+    }
+    return (dx + m_radius) + (dz + m_radius) * m_side;
+}
@@ -0,0 +1,143 @@
+#include "world/VoxelCollider.h"
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Boxes this far into a face still count as touching it, so rounding in one
+// move can't let the next one slip through
+const float EPSILON = 1e-4f;
+
+// Block whose +-0.5 span holds a coordinate
+int blockOf(float coordinate) {
+    return static_cast<int>(std::floor(coordinate + 0.5f));
+}
+
+} // namespace
+
+VoxelCollider::VoxelCollider()
+    : m_voxelsVisited(0) {
+}
+
+AABB VoxelCollider::blockBox(int x, int y, int z) {
+    glm::vec3 center(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+    return {center - 0.5f, center + 0.5f};
+}
+
+void VoxelCollider::gatherSolids(ChunkView& view, const AABB& region) {
+    m_solids.clear();
+
+    int minX = blockOf(region.min.x), maxX = blockOf(region.max.x);
+    int minZ = blockOf(region.min.z), maxZ = blockOf(region.max.z);
+    // Above and below the world is open
+    int minY = std::max(blockOf(region.min.y), 0);
+    int maxY = std::min(blockOf(region.max.y), CHUNK_HEIGHT - 1);
+    if (minY > maxY) return;
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int z = minZ; z <= maxZ; ++z) {
+            const Chunk* chunk = view.getChunkAt(x, z);
+            if (!chunk) {
+                // A column we can't see is one solid pillar
+                AABB column = blockBox(x, minY, z);
+                column.max.y = maxY + 0.5f;
+                m_solids.push_back(column);
+                continue;
+            }
+            int localX = x & (CHUNK_SIZE - 1), localZ = z & (CHUNK_SIZE - 1);
+            for (int y = minY; y <= maxY; ++y) {
+                if (isSolid(chunk->getBlockFast(localX, y, localZ))) {
+                    m_solids.push_back(blockBox(x, y, z));
+                }
+            }
+            m_voxelsVisited += maxY - minY + 1;
+        }
+    }
+}
+
+float VoxelCollider::clipAxis(int axis, const AABB& box, float motion) const {
+    if (motion == 0.0f) return 0.0f;
+    int a = (axis + 1) % 3, b = (axis + 2) % 3;
+    // Components by index without glm's per-access switch
+    const float* boxMin = &box.min.x;
+    const float* boxMax = &box.max.x;
+
+    for (const AABB& solid : m_solids) {
+        const float* solidMin = &solid.min.x;
+        const float* solidMax = &solid.max.x;
+        // Only blocks the box would run into head-on along this axis
+        if (boxMax[a] - EPSILON <= solidMin[a] || boxMin[a] + EPSILON >= solidMax[a]) continue;
+        if (boxMax[b] - EPSILON <= solidMin[b] || boxMin[b] + EPSILON >= solidMax[b]) continue;
+
+        if (motion > 0.0f && boxMax[axis] <= solidMin[axis] + EPSILON) {
+            motion = std::min(motion, solidMin[axis] - boxMax[axis]);
+        } else if (motion < 0.0f && boxMin[axis] >= solidMax[axis] - EPSILON) {
+            motion = std::max(motion, solidMax[axis] - boxMin[axis]);
+        }
+    }
+    return motion;
+}
+
+CollisionResult VoxelCollider::resolve(AABB& box, const glm::vec3& motion) const {
+    CollisionResult result;
+    bool* collided[3] = {&result.collidedX, &result.collidedY, &result.collidedZ};
+    const float* wanted = &motion.x;
+    float* made = &result.motion.x;
+
+    // Y first, so a box landing this move slides on the ground it landed on
+    for (int axis : {1, 0, 2}) {
+        float clipped = clipAxis(axis, box, wanted[axis]);
+        (&box.min.x)[axis] += clipped;
+        (&box.max.x)[axis] += clipped;
+        made[axis] = clipped;
+        *collided[axis] = clipped != wanted[axis];
+    }
+    result.onGround = result.collidedY && motion.y < 0.0f;
+    return result;
+}
+
+CollisionResult VoxelCollider::move(ChunkView& view, AABB& box, const glm::vec3& motion, float stepHeight) {
+    // ⚡ Broadphase: only voxels the sweep can reach, raised by the step if there is one
+    AABB region{glm::min(box.min, box.min + motion), glm::max(box.max, box.max + motion)};
+    region.max.y += stepHeight;
+    gatherSolids(view, region);
+
+    AABB moved = box;
+    CollisionResult result = resolve(moved, motion);
+
+    if (stepHeight > 0.0f && result.onGround && (result.collidedX || result.collidedZ)) {
+        // Same move from the start, raised by the step (as far as the ceiling allows), then dropped back
+        AABB stepped = box;
+        CollisionResult raised = resolve(stepped, glm::vec3(motion.x, stepHeight, motion.z));
+        CollisionResult dropped = resolve(stepped, glm::vec3(0.0f, -raised.motion.y, 0.0f));
+
+        float flat = result.motion.x * result.motion.x + result.motion.z * result.motion.z;
+        float climbed = raised.motion.x * raised.motion.x + raised.motion.z * raised.motion.z;
+        if (climbed > flat) {
+            result.motion = stepped.min - box.min;
+            result.collidedX = raised.collidedX;
+            result.collidedZ = raised.collidedZ;
+            result.collidedY = dropped.collidedY;
+            result.onGround = dropped.onGround;
+            result.steppedUp = true;
+            moved = stepped;
+        }
+    }
+
+    box = moved;
+    return result;
+}
+
+bool VoxelCollider::intersects(ChunkView& view, const AABB& box) {
+    gatherSolids(view, box);
+    for (const AABB& solid : m_solids) {
+        if (box.max.x - EPSILON > solid.min.x && box.min.x + EPSILON < solid.max.x &&
+            box.max.y - EPSILON > solid.min.y && box.min.y + EPSILON < solid.max.y &&
+            box.max.z - EPSILON > solid.min.z && box.min.z + EPSILON < solid.max.z) {
+            return true;
+        }
+    }
+    return false;
+}
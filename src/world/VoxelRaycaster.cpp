@@ -0,0 +1,186 @@
+#include "world/VoxelRaycaster.h"
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Where the walk is: the block, and per axis which block boundary comes next.
+// A boundary's distance is first + index * delta rather than a running sum, so a
+// jump over many boundaries lands on exactly the distances single steps would
+struct Walk {
+    int voxel[3];
+    int step[3];
+    int crossed[3];    // Boundaries crossed so far - the index of the next one
+    float first[3];    // Ray distance to the first boundary
+    float delta[3];    // Ray distance between boundaries
+    float rate[3];     // Boundaries per unit of ray distance, 1 / delta
+    float side[3];     // Ray distance to the next boundary
+
+    float boundary(int axis, int index) const { return first[axis] + static_cast<float>(index) * delta[axis]; }
+
+    // Crosses the next boundary along an axis, returning the distance it lies at
+    float cross(int axis) {
+        float t = side[axis];
+        voxel[axis] += step[axis];
+        side[axis] = boundary(axis, ++crossed[axis]);
+        return t;
+    }
+
+    // The axis the next step is along. Ties go to the later axis
+    int nextAxis() const {
+        if (side[0] < side[1] && side[0] < side[2]) return 0;
+        return side[1] < side[2] ? 1 : 2;
+    }
+};
+
+// ⚡ Moves the walk out of an empty box (block coordinates, min inclusive, max
+// exclusive) in one go, leaving it where stepping block by block would. Returns
+// the axis it leaves through and sets t to the distance it leaves at
+int leaveBox(Walk& walk, const int boxMin[3], const int boxMax[3], float& t) {
+    // Index and distance of the boundary each axis leaves the box through
+    int exitIndex[3];
+    float exit[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        int inside = walk.step[axis] > 0 ? boxMax[axis] - 1 - walk.voxel[axis] : walk.voxel[axis] - boxMin[axis];
+        exitIndex[axis] = walk.crossed[axis] + inside;
+        exit[axis] = walk.boundary(axis, exitIndex[axis]);
+    }
+    int out = (exit[0] < exit[1] && exit[0] < exit[2]) ? 0 : (exit[1] < exit[2] ? 1 : 2);
+
+    // The other axes cross every boundary a step would reach first: nearer ones,
+    // and at the same distance those of a later axis
+    for (int axis = 0; axis < 3; ++axis) {
+        if (axis == out) continue;
+        auto before = [&](int index) {
+            float distance = walk.boundary(axis, index);
+            return distance < exit[out] || (distance == exit[out] && axis > out);
+        };
+        // Estimated from the distance, then corrected by a step at most
+        int index = walk.crossed[axis] + static_cast<int>((exit[out] - walk.side[axis]) * walk.rate[axis]);
+        index = std::max(walk.crossed[axis], std::min(index, exitIndex[axis]));
+        while (index < exitIndex[axis] && before(index)) ++index;
+        while (index > walk.crossed[axis] && !before(index - 1)) --index;
+        walk.voxel[axis] += walk.step[axis] * (index - walk.crossed[axis]);
+        walk.crossed[axis] = index;
+        walk.side[axis] = walk.boundary(axis, index);
+    }
+
+    walk.voxel[out] += walk.step[out] * (exitIndex[out] - walk.crossed[out]);
+    walk.crossed[out] = exitIndex[out];
+    walk.side[out] = exit[out];
+    t = walk.cross(out);
+    return out;
+}
+
+} // namespace
+
+RaycastHit VoxelRaycaster::trace(ChunkView& view, const glm::vec3& origin, const glm::vec3& direction,
+                                 float maxDistance) {
+    RaycastHit result;
+    glm::vec3 rayDir = glm::normalize(direction);
+
+    // Avoid division by zero
+    const float EPSILON = 1e-6f;
+    if (std::abs(rayDir.x) < EPSILON) rayDir.x = (rayDir.x > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.y) < EPSILON) rayDir.y = (rayDir.y > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.z) < EPSILON) rayDir.z = (rayDir.z > 0) ? EPSILON : -EPSILON;
+
+    // Shifted by half a block, block boundaries fall on whole numbers
+    const glm::vec3 start = origin + 0.5f;
+    Walk walk;
+    for (int axis = 0; axis < 3; ++axis) {
+        walk.voxel[axis] = static_cast<int>(std::floor(start[axis]));
+        walk.step[axis] = rayDir[axis] >= 0.0f ? 1 : -1;
+        walk.crossed[axis] = 0;
+        walk.first[axis] = (walk.voxel[axis] + (walk.step[axis] > 0 ? 1.0f : 0.0f) - start[axis]) / rayDir[axis];
+        walk.delta[axis] = std::abs(1.0f / rayDir[axis]);
+        walk.rate[axis] = std::abs(rayDir[axis]);
+        walk.side[axis] = walk.first[axis];
+    }
+    int& x = walk.voxel[0];
+    int& y = walk.voxel[1];
+    int& z = walk.voxel[2];
+
+    // ⚡ The chunk under the ray, changed only when an x or z step leaves it
+    glm::ivec2 chunkPos(x >> 4, z >> 4);
+    const Chunk* chunk = view.getChunkAt(x, z);
+
+    // Block coordinate, per axis, of the first step into a new section
+    const int SECTION_MASK = SectionVisibility::SIZE - 1;
+    int enterSection[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        enterSection[axis] = walk.step[axis] > 0 ? 0 : SECTION_MASK;
+    }
+
+    float t = 0.0f;          // Distance at which the ray entered the current block
+    int axis = -1;           // Axis of the last step, for the face it entered through
+    bool newSection = true;  // Whether the ray just entered the block's section
+    while (chunk && t < maxDistance) {
+        // ⚡ Empty space to jump over: a section with nothing in it, checked as the
+        // ray enters it, or everything above or below the world
+        int boxMin[3], boxMax[3];
+        bool jump = false;
+        if (y >= 0 && y < CHUNK_HEIGHT) {
+            const ChunkOccupancy& occupancy = *chunk->getOccupancy();
+            int localX = x & (CHUNK_SIZE - 1), localZ = z & (CHUNK_SIZE - 1);
+            if (occupancy.getColumn(ChunkOccupancy::FILLED, localX, localZ) >> y & 1) {
+                // The block the ray starts in doesn't count
+                if (t > 0.0f) {
+                    result.hit = true;
+                    result.blockPos = glm::ivec3(x, y, z);
+                    result.hitPoint = origin + t * rayDir;
+                    result.normal = glm::ivec3(0);
+                    result.normal[axis] = -walk.step[axis];
+                    result.blockType = chunk->getBlockFast(localX, y, localZ);
+                    return result;
+                }
+            } else if (newSection && occupancy.isSectionEmpty(y / SectionVisibility::SIZE)) {
+                for (int i = 0; i < 3; ++i) {
+                    boxMin[i] = walk.voxel[i] & ~SECTION_MASK;
+                    boxMax[i] = boxMin[i] + SectionVisibility::SIZE;
+                }
+                jump = true;
+            }
+        } else if ((y < 0) == (walk.step[1] < 0)) {
+            break;  // Outside the world and heading further out
+        } else {
+            // Heading into the world from outside it: nothing to hit before it
+            const int FAR = 1 << 20;
+            boxMin[0] = x - FAR, boxMax[0] = x + FAR;
+            boxMin[2] = z - FAR, boxMax[2] = z + FAR;
+            boxMin[1] = y < 0 ? -FAR : CHUNK_HEIGHT;
+            boxMax[1] = y < 0 ? 0 : FAR;
+            jump = true;
+        }
+
+        if (jump) {
+            axis = leaveBox(walk, boxMin, boxMax, t);
+            newSection = true;
+            if (glm::ivec2(x >> 4, z >> 4) != chunkPos) {
+                chunkPos = glm::ivec2(x >> 4, z >> 4);
+                chunk = view.getChunkAt(x, z);
+            }
+            continue;
+        }
+
+        axis = walk.nextAxis();
+        t = walk.cross(axis);
+        newSection = (walk.voxel[axis] & SECTION_MASK) == enterSection[axis];
+        if (axis != 1 && glm::ivec2(x >> 4, z >> 4) != chunkPos) {
+            chunkPos = glm::ivec2(x >> 4, z >> 4);
+            chunk = view.getChunkAt(x, z);
+        }
+    }
+    return result;
+}
+
+void VoxelRaycaster::traceBatch(ChunkView& view, const std::vector<Ray>& rays, std::vector<RaycastHit>& results) {
+    // Chunks stay in the view's table between rays, so a batch that stays
+    // within a few chunks looks each one up once
+    results.resize(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        results[i] = trace(view, rays[i].origin, rays[i].direction, rays[i].maxDistance);
+    }
+}
@@ -5,33 +5,50 @@
 #include <iostream>
 #include <algorithm>
 #include <chrono>
-#include <ctime>
 
 World::World() 
-    : m_renderDistance(16)        // Increased to 16 chunks for high render distance
+    : m_frustumCuller(CULL_CELL_SIZE)
+    , m_cullListDirty(true)
+    , m_deterministicCulling(false)
+    , m_renderDistance(16)        // Increased to 16 chunks for high render distance
+    , m_farRenderDistance(0)      // No heightfield ring unless configured
     , m_lastPlayerChunkPos(0, 0) // Track where the player was last frame
     , m_firstUpdate(true)        // Flag to force initial chunk generation
+    , m_visibilityCulledChunks(0)
+    , m_occlusionCulledChunks(0)
+    , m_renderedChunks(0)
     , m_stopGeneration(false) {  // Control flag for background generation
     
-    // Initialize modular terrain generator with a random seed for varied worlds
-    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
-    m_terrainGenerator = std::make_unique<ModularWorldGenerator>(seed);
+    // Initialize modular terrain generator from the configured seed - the same
+    // seed always produces the same world, which caching and persistence rely on
+    m_terrainGenerator = ModularWorldGenerator::createDefault(g_worldConfig.terrain.seed);
     
-    // Add tree generation feature with config parameters
-    auto treeFeature = std::make_unique<TreeFeature>(seed);
-    
-    // Configure tree parameters from world config
-    TreeFeature::TreeParams treeParams;
-    treeParams.frequency = g_worldConfig.trees.frequency;
-    treeParams.threshold = g_worldConfig.trees.threshold;
-    treeParams.minHeight = g_worldConfig.trees.minHeight;
-    treeParams.maxHeight = g_worldConfig.trees.maxHeight;
-    treeParams.minSpacing = g_worldConfig.trees.minSpacing;
-    treeFeature->setParams(treeParams);
+    // World created with ModularWorldGenerator and TreeFeature
     
-    m_terrainGenerator->addFeature(std::move(treeFeature));
+    // 💾 Player edits are journaled as deltas; generated chunks are cached in region files
+    if (g_worldConfig.persistence.enabled) {
+        m_editJournal = std::make_unique<EditJournal>(g_worldConfig.persistence.worldDirectory,
+                                                      m_terrainGenerator->getSeed());
+        if (g_worldConfig.persistence.cacheGeneratedChunks) {
+            m_chunkStorage = std::make_unique<ChunkStorage>(g_worldConfig.persistence.worldDirectory,
+                                                            m_terrainGenerator->getSignature(),
+                                                            g_worldConfig.persistence.compressionLevel);
+        }
+    }
+    m_lastJournalFlush = std::chrono::steady_clock::now();
+    
+    // ⚡ LOD: distant chunks draw 2x/4x downsampled meshes, built on their own workers
+    if (g_worldConfig.rendering.enableLOD) {
+        m_lodManager = std::make_unique<ChunkLODManager>();
+        m_lodManager->setLODDistances(g_worldConfig.rendering.lodMediumDistance,
+                                      g_worldConfig.rendering.lodLowDistance);
+        m_lodManager->setHysteresis(g_worldConfig.rendering.lodHysteresis);
+    }
     
-    // World created with ModularWorldGenerator and TreeFeature
+    // 🧱 Occlusion: nearby terrain is rasterized into a CPU depth buffer on its own worker
+    if (g_worldConfig.rendering.enableOcclusionCulling) {
+        m_occlusionCuller = std::make_unique<OcclusionCuller>();
+    }
     
     // ⚡ PERFORMANCE: Start multiple background worker threads for chunk generation
     m_generationThreads.reserve(NUM_GENERATION_THREADS);
@@ -53,6 +70,10 @@ World::~World() {
             thread.join();
         }
     }
+    
+    // 💾 Both flush on destruction - nothing else to save, edits are already journaled
+    m_editJournal.reset();
+    m_chunkStorage.reset();
 }
 
 void World::update(const glm::vec3& playerPosition) {
@@ -82,22 +103,47 @@ void World::update(const glm::vec3& playerPosition) {
         m_firstUpdate = false;
     }
     
+    // 🏔️ Full chunks generated for former heightfield chunks replace them here
+    swapInUpgradedChunks();
+    
     // ⚡ MAIN THREAD: Build more meshes per frame for faster world loading
     int meshesBuilt = 0;
+    int farMeshesBuilt = 0;
     const int MAX_MESHES_PER_FRAME = 8; // Increased from 3 to 8 for faster loading
+    const int MAX_FAR_MESHES_PER_FRAME = 32; // 🏔️ Heightfield meshes are ~1/5 the size - own budget
     
     {
         std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
         for (auto& [pos, chunk] : m_chunks) {
-            if (meshesBuilt >= MAX_MESHES_PER_FRAME) break;
+            if (meshesBuilt >= MAX_MESHES_PER_FRAME && farMeshesBuilt >= MAX_FAR_MESHES_PER_FRAME) break;
             
             if (chunk && chunk->isGenerated() && chunk->needsMeshRebuild()) {
+                int& built = chunk->isHeightfield() ? farMeshesBuilt : meshesBuilt;
+                if (built >= (chunk->isHeightfield() ? MAX_FAR_MESHES_PER_FRAME : MAX_MESHES_PER_FRAME)) continue;
+                
                 chunk->buildMesh(); // Build mesh on main thread (includes GPU upload)
-                meshesBuilt++;
+                built++;
+                m_cullListDirty = true;  // New mesh, new bounds
+                
+                // Blocks changed - coarse meshes are stale
+                if (m_lodManager && !chunk->isHeightfield()) {
+                    m_lodManager->invalidateChunk(pos);
+                }
             }
         }
     }
     
+    if (m_lodManager) {
+        m_lodManager->uploadReadyMeshes(MAX_LOD_UPLOADS_PER_FRAME);
+    }
+    
+    // 💾 Push journaled edits to disk about once a second
+    if (m_editJournal && std::chrono::steady_clock::now() - m_lastJournalFlush >
+                         std::chrono::duration<float>(JOURNAL_FLUSH_INTERVAL)) {
+        m_editJournal->flush();
+        m_lastJournalFlush = std::chrono::steady_clock::now();
+    }
+    
     // Calculate how long this update took
     auto endTime = std::chrono::high_resolution_clock::now();
     auto updateDuration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
@@ -121,50 +167,139 @@ void World::render(ChunkRenderer* renderer, const glm::mat4& view, const glm::ma
     
     // ⚡ PERFORMANCE: Sort chunks by distance and apply LOD + Frustum Culling
     std::vector<std::pair<float, Chunk*>> sortedChunks;
+    bool visibilityCulling = g_worldConfig.rendering.enableVisibilityCulling;
+    m_visibilityCulledChunks = 0;
+    m_occlusionCulledChunks = 0;
+    
+    // 🧱 OCCLUSION: the worker's pass over last frame, used while the camera has barely moved
+    glm::vec3 cameraForward = -glm::vec3(invView[2]);
+    bool occlusionCulling = false;
+    OcclusionCuller::Frame occlusionFrame;
+    if (m_occlusionCuller) {
+        bool finished = m_deterministicCulling ? m_occlusionCuller->waitForResult(m_occlusionResult)
+                                               : m_occlusionCuller->takeResult(m_occlusionResult);
+        if (finished) {
+            m_occlusionHidden.clear();
+            m_occlusionHidden.insert(m_occlusionResult.hidden.begin(), m_occlusionResult.hidden.end());
+        }
+        occlusionCulling = m_occlusionResult.isValidFor(cameraPos, cameraForward);
+        occlusionFrame.viewProjection = projection * view;
+        occlusionFrame.cameraPos = cameraPos;
+        occlusionFrame.cameraForward = cameraForward;
+    }
     
     {
         std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
         sortedChunks.reserve(m_chunks.size());
         
-        // Go through every chunk we have loaded in memory
-        for (const auto& chunkPair : m_chunks) {
-            const auto& chunk = chunkPair.second;  // Get the actual chunk object
+        // 👁️ OCCLUSION: walk section connectivity out from the camera - chunks no
+        // sight line reaches are behind terrain. Heightfield chunks are never judged
+        if (visibilityCulling) {
+            m_visibilityGraph.compute(cameraPos, m_renderDistance,
+                [this](const glm::ivec2& chunkPos) -> const SectionVisibility* {
+                    auto it = m_chunks.find(chunkPos);
+                    if (it == m_chunks.end() || !it->second->isGenerated()) return nullptr;
+                    return it->second->getSectionVisibility();
+                },
+                [](const glm::ivec3& section) {
+                    glm::vec3 sectionMin(section.x * CHUNK_SIZE, section.y * SectionVisibility::SIZE,
+                                         section.z * CHUNK_SIZE);
+                    return frustum.isChunkVisible(sectionMin, sectionMin + glm::vec3(static_cast<float>(CHUNK_SIZE),
+                                                  static_cast<float>(SectionVisibility::SIZE), static_cast<float>(CHUNK_SIZE)));
+                });
+        }
+        
+        // ⚡ FRUSTUM CULLING: every chunk's mesh bounds in one batched pass. The box
+        // list is only rebuilt when chunks come, go or get new meshes
+        if (m_cullListDirty) {
+            m_frustumCuller.clear();
+            m_cullChunks.clear();
+            for (const auto& chunkPair : m_chunks) {
+                if (!chunkPair.second) continue;
+                glm::vec3 chunkMin, chunkMax;
+                chunkPair.second->getBounds(chunkMin, chunkMax);
+                m_frustumCuller.add(chunkMin, chunkMax);
+                m_cullChunks.push_back(chunkPair.second.get());
+            }
+            m_frustumCuller.build();
+            m_cullListDirty = false;
+        }
+        m_frustumCuller.cull(frustum, m_visibleChunkIndices);
+        
+        // Go through every chunk in the frustum
+        for (int index : m_visibleChunkIndices) {
+            Chunk* chunk = m_cullChunks[index];
             
-            // Make sure the chunk exists and has been generated
-            if (chunk && chunk->isGenerated()) {
+            // Make sure the chunk has been generated
+            if (chunk->isGenerated()) {
                 // ⚡ PERFORMANCE: Calculate distance to chunk for LOD
                 glm::ivec2 chunkPos = chunk->getPosition();
                 float distance = glm::length(glm::vec2(chunkPos - cameraChunk));
                 
-                // Only render chunks within reasonable distance
-                if (distance <= m_renderDistance) {
-                    // ⚡ FRUSTUM CULLING: Check if chunk is visible in camera frustum
-                    glm::vec3 chunkMin = glm::vec3(chunkPos.x * 16.0f, 0.0f, chunkPos.y * 16.0f);
-                    glm::vec3 chunkMax = chunkMin + glm::vec3(16.0f, 128.0f, 16.0f); // Chunk size + height
+                // Only render chunks within reasonable distance (heightfield chunks reach further)
+                if (distance <= getFarRenderDistance()) {
+                    if (visibilityCulling && !chunk->isHeightfield() &&
+                        !m_visibilityGraph.isChunkVisible(chunkPos)) {
+                        m_visibilityCulledChunks++;
+                        continue;
+                    }
                     
-                    if (frustum.isChunkVisible(chunkMin, chunkMax)) {
-                        sortedChunks.emplace_back(distance, chunk.get());
+                    // Near full chunks occlude; everything further is tested for next frame
+                    if (m_occlusionCuller) {
+                        if (distance <= OCCLUDER_DISTANCE && !chunk->isHeightfield()) {
+                            occlusionFrame.occluders.push_back({chunkPos, chunk->getOccluder()});
+                        }
+                        if (distance >= OCCLUSION_MIN_DISTANCE) {
+                            OcclusionCuller::Candidate candidate{chunkPos, glm::vec3(0.0f), glm::vec3(0.0f)};
+                            chunk->getBounds(candidate.min, candidate.max);
+                            occlusionFrame.candidates.push_back(candidate);
+                            if (occlusionCulling && m_occlusionHidden.count(chunkPos)) {
+                                m_occlusionCulledChunks++;
+                                continue;
+                            }
+                        }
                     }
+                    sortedChunks.emplace_back(distance, chunk);
                 }
             }
         }
     }
     
-    // ⚡ PERFORMANCE: Sort by distance (closest first) for better GPU cache performance
-    std::sort(sortedChunks.begin(), sortedChunks.end());
+    // 🧱 Rasterize and test while this frame draws
+    if (m_occlusionCuller) {
+        m_occlusionCuller->submit(std::move(occlusionFrame));
+    }
+    
+    // ⚡ PERFORMANCE: Sort by distance (closest first) for better GPU cache performance.
+    // Equal distances go by position, so the draw order never depends on where chunks sit in memory
+    std::sort(sortedChunks.begin(), sortedChunks.end(), [](const auto& a, const auto& b) {
+        if (a.first != b.first) return a.first < b.first;
+        glm::ivec2 posA = a.second->getPosition(), posB = b.second->getPosition();
+        return posA.x != posB.x ? posA.x < posB.x : posA.y < posB.y;
+    });
     
     // Render chunks with distance-based optimizations
+    bool faceCulling = g_worldConfig.rendering.enableFaceCulling;
     for (const auto& [distance, chunk] : sortedChunks) {
-        // ⚡ PERFORMANCE: Skip detailed rendering for very distant chunks
-        if (distance > m_renderDistance * 0.8f) {
-            // For very distant chunks, could implement simplified rendering here
-            // For now, just render normally but this is where LOD would go
+        // ⚡ LOD: distant full chunks draw their downsampled meshes once uploaded
+        const ChunkLODManager::LODMeshes* lodMeshes = nullptr;
+        if (m_lodManager && !chunk->isHeightfield() &&
+            m_lodManager->updateLOD(*chunk, distance) != ChunkLODManager::LODLevel::FULL_DETAIL) {
+            lodMeshes = m_lodManager->getChunkMeshes(chunk->getPosition());
         }
         
-        // Tell the renderer to draw this chunk with the camera's view
-        renderer->renderChunk(*chunk, view, projection);
+        // Tell the renderer to draw this chunk with the camera's view, leaving out
+        // the face directions it can only see the backs of
+        if (lodMeshes) {
+            unsigned int faces = faceCulling ? lodMeshes->facePlanes.getVisibleFaces(cameraPos) : ChunkFacePlanes::ALL_FACES;
+            renderer->renderLODChunk(*lodMeshes, view, projection, faces);
+        } else {
+            unsigned int faces = faceCulling ? chunk->getFacePlanes().getVisibleFaces(cameraPos) : ChunkFacePlanes::ALL_FACES;
+            renderer->renderChunk(*chunk, view, projection, faces);
+        }
         chunksRendered++;
     }
+    m_renderedChunks = chunksRendered;
     
     // Every 5 seconds or so (at 60fps), log some stats to help with debugging
     static int frameCounter = 0;
@@ -218,6 +353,16 @@ BlockType World::getBlockType(const glm::ivec3& worldPos) const {
     return getBlock(worldPos.x, worldPos.y, worldPos.z);
 }
 
+ChunkView World::createChunkView() const {
+    return ChunkView([this](const glm::ivec2& chunkPos) -> const Chunk* {
+        std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
+        auto it = m_chunks.find(chunkPos);
+        if (it == m_chunks.end() || !it->second) return nullptr;
+        const Chunk* chunk = it->second.get();
+        return chunk->isGenerated() && !chunk->isHeightfield() ? chunk : nullptr;
+    });
+}
+
 void World::setBlock(int x, int y, int z, BlockType type) {
     // Check Y bounds first - if outside world height, ignore
     if (y < 0 || y >= CHUNK_HEIGHT) {
@@ -244,8 +389,13 @@ void World::setBlock(int x, int y, int z, BlockType type) {
     {
         std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
         auto it = m_chunks.find(chunkPos);
-        if (it != m_chunks.end() && it->second) {
+        if (it != m_chunks.end() && it->second && !it->second->isHeightfield()) {
             it->second->setBlock(localX, y, localZ, type);
+            
+            // 💾 Write-ahead: the edit is journaled before anything else can lose it
+            if (m_editJournal) {
+                m_editJournal->recordEdit(chunkPos, it->second->getIndex(localX, y, localZ), type);
+            }
         }
     }
 }
@@ -268,7 +418,7 @@ glm::ivec3 World::worldToLocalPosition(const glm::vec3& worldPos) const {
 
 void World::generateChunksAroundPlayer(const glm::vec3& playerPosition) {
     glm::ivec2 playerChunk = worldToChunkPosition(playerPosition);
-    std::vector<glm::ivec2> neededChunks = getChunksInRange(playerChunk, m_renderDistance);
+    std::vector<glm::ivec2> neededChunks = getChunksInRange(playerChunk, getFarRenderDistance());
     
     // Sort chunks by distance - closest first for better player experience
     // Use spiral pattern to minimize visible chunk borders
@@ -304,12 +454,20 @@ void World::generateChunksAroundPlayer(const glm::vec3& playerPosition) {
             break;  // Time limit reached - but should be fast since no terrain generation
         }
         
+        float distance = getChunkDistance(chunkPos, playerChunk);
+        if (distance > getFarRenderDistance()) {
+            continue;  // Corner of the square ring - never rendered
+        }
+        
         if (!isChunkLoaded(chunkPos)) {            
             // Create chunk container without auto-generation
-            auto chunk = std::make_unique<Chunk>(chunkPos, m_terrainGenerator.get(), false);
+            // 🏔️ Beyond the render distance only the silhouette is generated
+            ChunkDetail detail = distance <= m_renderDistance ? ChunkDetail::FULL : ChunkDetail::HEIGHTFIELD;
+            auto chunk = std::make_unique<Chunk>(chunkPos, m_terrainGenerator.get(), false, detail);
             {
                 std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
                 m_chunks[chunkPos] = std::move(chunk);
+                m_cullListDirty = true;
             }
             chunksGenerated++;
             // Removed debug output for cleaner console
@@ -321,6 +479,33 @@ void World::generateChunksAroundPlayer(const glm::vec3& playerPosition) {
         generateTerrainAsync();
         // Removed debug output for cleaner console
     }
+    
+    // 🏔️ Heightfield chunks the player has come close to are regenerated in full
+    std::vector<glm::ivec2> upgrades;
+    {
+        std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
+        std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+        for (const auto& [pos, chunk] : m_chunks) {
+            if (chunk && chunk->isHeightfield() && chunk->isGenerated() &&
+                getChunkDistance(pos, playerChunk) <= m_renderDistance &&
+                m_chunksBeingUpgraded.insert(pos).second) {
+                upgrades.push_back(pos);
+            }
+        }
+    }
+    if (!upgrades.empty()) {
+        std::sort(upgrades.begin(), upgrades.end(), [playerChunk, this](const glm::ivec2& a, const glm::ivec2& b) {
+            return getChunkDistance(a, playerChunk) < getChunkDistance(b, playerChunk);
+        });
+        
+        std::lock_guard<std::mutex> lock(m_generationQueueMutex);
+        for (const glm::ivec2& pos : upgrades) {
+            if (m_chunksInGenerationQueue.insert(pos).second) {
+                m_chunksNeedingGeneration.push(pos);
+            }
+        }
+        m_generationCondition.notify_all();
+    }
 }
 
 void World::preloadChunksAhead(const glm::vec3& playerPosition, const glm::ivec2& currentChunk) {
@@ -347,6 +532,7 @@ void World::preloadChunksAhead(const glm::vec3& playerPosition, const glm::ivec2
                     {
                         std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
                         m_chunks[preloadChunk] = std::move(chunk);
+                        m_cullListDirty = true;
                     }
                 }
             }
@@ -360,19 +546,28 @@ void World::preloadChunksAhead(const glm::vec3& playerPosition, const glm::ivec2
 void World::unloadDistantChunks(const glm::vec3& playerPosition) {
     glm::ivec2 playerChunk = worldToChunkPosition(playerPosition);
     float unloadDistance = m_renderDistance * UNLOAD_DISTANCE_MULTIPLIER;
+    float farUnloadDistance = static_cast<float>(getFarRenderDistance() + FAR_UNLOAD_MARGIN);
     
+    // 🏔️ A full chunk unloaded inside the far ring comes back as a heightfield chunk
     std::vector<glm::ivec2> chunksToUnload;
     {
         std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
         for (const auto& pair : m_chunks) {
             const glm::ivec2& chunkPos = pair.first;
-            if (getChunkDistance(playerChunk, chunkPos) > unloadDistance) {
+            float limit = pair.second && pair.second->isHeightfield() ? farUnloadDistance : unloadDistance;
+            if (getChunkDistance(playerChunk, chunkPos) > limit) {
                 chunksToUnload.push_back(chunkPos);
             }
         }
     
+        std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
         for (const glm::ivec2& chunkPos : chunksToUnload) {
             m_chunks.erase(chunkPos);
+            m_chunksBeingUpgraded.erase(chunkPos);  // A heightfield loaded here later asks again
+            m_cullListDirty = true;
+            if (m_lodManager) {
+                m_lodManager->removeChunk(chunkPos);
+            }
         }
     }
     
@@ -484,11 +679,29 @@ void World::terrainGenerationWorker() {
                 }
             }
             
+            // Generated heightfields come back through the queue as a repeat of their
+            // generation too - only the ones that asked are upgraded
+            bool upgradeRequested = false;
+            if (chunk && !chunk->needsGeneration() && chunk->isHeightfield()) {
+                std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+                upgradeRequested = m_chunksBeingUpgraded.count(pos) > 0;
+            }
+            
             if (chunk && chunk->needsGeneration()) {
+                if (!chunk->isHeightfield()) {
+                    // A full chunk was recreated here since an upgrade was queued - nothing left to upgrade
+                    std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+                    m_chunksBeingUpgraded.erase(pos);
+                }
+                
                 auto startTime = std::chrono::high_resolution_clock::now();
                 
                 // ⚡ BACKGROUND THREAD: Only do CPU-intensive work here
-                chunk->generateTerrainOnly();  // Generate terrain blocks only
+                if (chunk->isHeightfield()) {
+                    chunk->generateTerrainOnly();  // Heightmap and surface blocks only - nothing to cache or edit
+                } else {
+                    loadOrGenerateTerrain(pos, *chunk);
+                }
                 
                 // Mark as ready for mesh building (which will happen on main thread)
                 chunk->markReadyForUpload();   // Flag as ready for GPU upload
@@ -496,8 +709,78 @@ void World::terrainGenerationWorker() {
                 auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
                 
                 // Removed debug output for cleaner console
+            } else if (upgradeRequested) {
+                // 🏔️ Upgrade: generate the full chunk beside the heightfield one, which keeps
+                // drawing until the main thread swaps them
+                auto fullChunk = std::make_unique<Chunk>(pos, m_terrainGenerator.get(), false);
+                loadOrGenerateTerrain(pos, *fullChunk);
+                fullChunk->markReadyForUpload();
+                
+                std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+                m_upgradedChunks.push_back(std::move(fullChunk));
+            } else if (!chunk || !chunk->isHeightfield()) {
+                // Unloaded, or already a full chunk, while queued - let a heightfield
+                // loaded here later request its upgrade again
+                std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+                m_chunksBeingUpgraded.erase(pos);
+            }
+        }
+    }
+}
+
+void World::loadOrGenerateTerrain(const glm::ivec2& chunkPos, Chunk& chunk) {
+    // 💾 Visited chunks come back from disk - a decompress instead of a full generation
+    std::vector<BlockType> savedBlocks;
+    bool loadedFromDisk = m_chunkStorage && m_chunkStorage->loadChunk(chunkPos, savedBlocks) &&
+                          chunk.loadBlockData(std::move(savedBlocks));
+    
+    if (!loadedFromDisk) {
+        chunk.generateTerrainOnly();  // Generate terrain blocks only
+        
+        // Cache the pristine terrain - edits live in the journal, not here
+        if (m_chunkStorage) {
+            m_chunkStorage->saveChunkAsync(chunkPos, chunk.getBlockData());
+        }
+    }
+    
+    // 💾 Re-apply player edits on top of the generated baseline
+    if (m_editJournal) {
+        m_editJournal->applyEdits(chunkPos, chunk);
+    }
+}
+
+void World::swapInUpgradedChunks() {
+    std::vector<std::unique_ptr<Chunk>> ready;
+    {
+        std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+        size_t count = std::min(m_upgradedChunks.size(), static_cast<size_t>(MAX_UPGRADES_PER_FRAME));
+        for (size_t i = 0; i < count; ++i) {
+            ready.push_back(std::move(m_upgradedChunks[i]));
+        }
+        m_upgradedChunks.erase(m_upgradedChunks.begin(), m_upgradedChunks.begin() + count);
+    }
+    
+    for (auto& fullChunk : ready) {
+        glm::ivec2 pos = fullChunk->getPosition();
+        
+        // Mesh first, so the chunk never shows up without geometry
+        fullChunk->buildMesh();
+        if (m_lodManager) {
+            m_lodManager->invalidateChunk(pos);
+        }
+        {
+            std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
+            // Only over the generated heightfield it upgrades - if the player left meanwhile, or a
+            // full chunk was recreated here, that chunk is live (and maybe edited) and this copy is dropped
+            auto it = m_chunks.find(pos);
+            if (it != m_chunks.end() && it->second && it->second->isHeightfield() && it->second->isGenerated()) {
+                it->second = std::move(fullChunk);
+                m_cullListDirty = true;
             }
         }
+        
+        std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+        m_chunksBeingUpgraded.erase(pos);
     }
 }
 
@@ -510,6 +793,24 @@ int World::getRequiredChunkCount(const glm::vec3& playerPosition) const {
     return static_cast<int>(getChunksInRange(playerChunk, m_renderDistance).size());
 }
 
+bool World::hasPendingWork() {
+    {
+        std::lock_guard<std::mutex> lock(m_generationQueueMutex);
+        if (!m_chunksNeedingGeneration.empty()) return true;
+    }
+    {
+        std::lock_guard<std::mutex> upgradeLock(m_upgradeMutex);
+        if (!m_chunksBeingUpgraded.empty() || !m_upgradedChunks.empty()) return true;
+    }
+    {
+        std::lock_guard<std::mutex> chunkLock(m_chunksMutex);
+        for (const auto& [pos, chunk] : m_chunks) {
+            if (chunk && (chunk->needsGeneration() || chunk->needsMeshRebuild())) return true;
+        }
+    }
+    return m_lodManager && m_lodManager->hasPendingLevels();
+}
+
 bool World::isInitialLoadingComplete(const glm::vec3& playerPosition) const {
     glm::ivec2 playerChunk = worldToChunkPosition(playerPosition);
     std::vector<glm::ivec2> requiredChunks = getChunksInRange(playerChunk, m_renderDistance);
@@ -74,10 +74,19 @@ bool WorldConfig::saveToFile(const std::string& filename) const {
     file << "[rendering]\n";
     file << "renderDistance = " << rendering.renderDistance << "\n";
     file << "loadDistance = " << rendering.loadDistance << "\n";
+    file << "farRenderDistance = " << rendering.farRenderDistance << "\n";
+    file << "enableLOD = " << (rendering.enableLOD ? "true" : "false") << "\n";
+    file << "lodMediumDistance = " << rendering.lodMediumDistance << "\n";
+    file << "lodLowDistance = " << rendering.lodLowDistance << "\n";
+    file << "lodHysteresis = " << rendering.lodHysteresis << "\n";
+    file << "horizonScale = " << rendering.horizonScale << "\n";
     file << "fogStartDistance = " << rendering.fogStartDistance << "\n";
     file << "fogEndDistance = " << rendering.fogEndDistance << "\n";
     file << "enableFog = " << (rendering.enableFog ? "true" : "false") << "\n";
     file << "enableFrustumCulling = " << (rendering.enableFrustumCulling ? "true" : "false") << "\n";
+    file << "enableVisibilityCulling = " << (rendering.enableVisibilityCulling ? "true" : "false") << "\n";
+    file << "enableOcclusionCulling = " << (rendering.enableOcclusionCulling ? "true" : "false") << "\n";
+    file << "enableFaceCulling = " << (rendering.enableFaceCulling ? "true" : "false") << "\n";
     file << "maxChunksPerFrame = " << rendering.maxChunksPerFrame << "\n\n";
     
     // Terrain settings
@@ -114,6 +123,13 @@ bool WorldConfig::saveToFile(const std::string& filename) const {
     file << "maxDistance = " << terrain.gravel.maxDistance << "\n";
     file << "edgeBonus = " << terrain.gravel.edgeBonus << "\n\n";
     
+    file << "[terrain.caves]\n";
+    file << "enabled = " << (terrain.caves.enabled ? "true" : "false") << "\n";
+    file << "frequency = " << terrain.caves.frequency << "\n";
+    file << "threshold = " << terrain.caves.threshold << "\n";
+    file << "octaves = " << terrain.caves.octaves << "\n";
+    file << "surfaceMargin = " << terrain.caves.surfaceMargin << "\n\n";
+    
     // Tree settings
     file << "[trees]\n";
     file << "enabled = " << (trees.enabled ? "true" : "false") << "\n";
@@ -139,13 +155,19 @@ bool WorldConfig::saveToFile(const std::string& filename) const {
     file << "maxChunksPerFrame = " << performance.maxChunksPerFrame << "\n";
     file << "chunkUpdateDelay = " << performance.chunkUpdateDelay << "\n\n";
     
+    // Persistence settings
+    file << "[persistence]\n";
+    file << "enabled = " << (persistence.enabled ? "true" : "false") << "\n";
+    file << "cacheGeneratedChunks = " << (persistence.cacheGeneratedChunks ? "true" : "false") << "\n";
+    file << "worldDirectory = " << persistence.worldDirectory << "\n";
+    file << "compressionLevel = " << persistence.compressionLevel << "\n\n";
+    
     // Cloud settings
     file << "[clouds]\n";
     file << "enabled = " << (clouds.enabled ? "true" : "false") << "\n";
     file << "height = " << clouds.height << "\n";
     file << "speed = " << clouds.speed << "\n";
     file << "density = " << clouds.density << "\n";
-    file << "updateDistance = " << clouds.updateDistance << "\n";
     file << "gridSize = " << clouds.gridSize << "\n";
     file << "spacing = " << clouds.spacing << "\n";
     file << "layers = " << clouds.layers << "\n";
@@ -157,7 +179,8 @@ bool WorldConfig::saveToFile(const std::string& filename) const {
     file << "showFPS = " << (debug.showFPS ? "true" : "false") << "\n";
     file << "showPlayerPosition = " << (debug.showPlayerPosition ? "true" : "false") << "\n";
     file << "logTreeGeneration = " << (debug.logTreeGeneration ? "true" : "false") << "\n";
-    file << "logChunkGeneration = " << (debug.logChunkGeneration ? "true" : "false") << "\n\n";
+    file << "logChunkGeneration = " << (debug.logChunkGeneration ? "true" : "false") << "\n";
+    file << "itemBenchmarkDrops = " << debug.itemBenchmarkDrops << "\n\n";
     
     file.close();
     std::cout << "WorldConfig: Saved configuration to " << filename << std::endl;
@@ -213,6 +236,11 @@ void WorldConfig::validate() {
     // Rendering validation
     clampValue(rendering.renderDistance, 1, 32);
     clampValue(rendering.loadDistance, rendering.renderDistance, 64);
+    clampValue(rendering.farRenderDistance, 0, 128);
+    clampValue(rendering.lodMediumDistance, 2.0f, 128.0f);
+    clampValue(rendering.lodLowDistance, rendering.lodMediumDistance, 128.0f);
+    clampValue(rendering.lodHysteresis, 0.0f, 4.0f);
+    clampValue(rendering.horizonScale, 0.0f, 32.0f);
     clampValue(rendering.fogStartDistance, 16.0f, 512.0f);
     clampValue(rendering.fogEndDistance, rendering.fogStartDistance + 16.0f, 1024.0f);
     clampValue(rendering.maxChunksPerFrame, 1, 16);
@@ -244,6 +272,12 @@ void WorldConfig::validate() {
     clampValue(terrain.gravel.maxDistance, 1.0f, 20.0f);
     clampValue(terrain.gravel.edgeBonus, 0.0, 1.0);
     
+    // Cave validation
+    clampValue(terrain.caves.frequency, 0.005, 0.2);
+    clampValue(terrain.caves.threshold, 0.0, 1.0);
+    clampValue(terrain.caves.octaves, 1, 4);
+    clampValue(terrain.caves.surfaceMargin, 1, 16);
+    
     // Tree validation
     clampValue(trees.frequency, 0.001, 0.2);
     clampValue(trees.threshold, 0.0, 1.0);
@@ -256,6 +290,9 @@ void WorldConfig::validate() {
     clampValue(performance.maxMemoryChunks, 50, 1000);
     clampValue(performance.maxChunkUpdatesPerFrame, 1, 10);
     clampValue(performance.chunkUpdateDelay, 0.01f, 1.0f);
+    
+    // Persistence validation
+    clampValue(persistence.compressionLevel, 1, 9);
 }
 
 void WorldConfig::clampValue(int& value, int min, int max) {
@@ -275,10 +312,19 @@ void WorldConfig::applySetting(const std::string& section, const std::string& ke
         if (section == "rendering") {
             if (key == "renderDistance") rendering.renderDistance = std::stoi(value);
             else if (key == "loadDistance") rendering.loadDistance = std::stoi(value);
+            else if (key == "farRenderDistance") rendering.farRenderDistance = std::stoi(value);
+            else if (key == "enableLOD") rendering.enableLOD = (value == "true");
+            else if (key == "lodMediumDistance") rendering.lodMediumDistance = std::stof(value);
+            else if (key == "lodLowDistance") rendering.lodLowDistance = std::stof(value);
+            else if (key == "lodHysteresis") rendering.lodHysteresis = std::stof(value);
+            else if (key == "horizonScale") rendering.horizonScale = std::stof(value);
             else if (key == "fogStartDistance") rendering.fogStartDistance = std::stof(value);
             else if (key == "fogEndDistance") rendering.fogEndDistance = std::stof(value);
             else if (key == "enableFog") rendering.enableFog = (value == "true");
             else if (key == "enableFrustumCulling") rendering.enableFrustumCulling = (value == "true");
+            else if (key == "enableVisibilityCulling") rendering.enableVisibilityCulling = (value == "true");
+            else if (key == "enableOcclusionCulling") rendering.enableOcclusionCulling = (value == "true");
+            else if (key == "enableFaceCulling") rendering.enableFaceCulling = (value == "true");
             else if (key == "maxChunksPerFrame") rendering.maxChunksPerFrame = std::stoi(value);
         }
         else if (section == "terrain") {
@@ -314,6 +360,13 @@ void WorldConfig::applySetting(const std::string& section, const std::string& ke
             else if (key == "maxDistance") terrain.gravel.maxDistance = std::stof(value);
             else if (key == "edgeBonus") terrain.gravel.edgeBonus = std::stod(value);
         }
+        else if (section == "terrain.caves") {
+            if (key == "enabled") terrain.caves.enabled = (value == "true");
+            else if (key == "frequency") terrain.caves.frequency = std::stod(value);
+            else if (key == "threshold") terrain.caves.threshold = std::stod(value);
+            else if (key == "octaves") terrain.caves.octaves = std::stoi(value);
+            else if (key == "surfaceMargin") terrain.caves.surfaceMargin = std::stoi(value);
+        }
         else if (section == "trees") {
             if (key == "enabled") trees.enabled = (value == "true");
             else if (key == "frequency") trees.frequency = std::stod(value);
@@ -337,12 +390,17 @@ void WorldConfig::applySetting(const std::string& section, const std::string& ke
             else if (key == "maxChunksPerFrame") performance.maxChunksPerFrame = std::stoi(value);
             else if (key == "chunkUpdateDelay") performance.chunkUpdateDelay = std::stof(value);
         }
+        else if (section == "persistence") {
+            if (key == "enabled") persistence.enabled = (value == "true");
+            else if (key == "cacheGeneratedChunks") persistence.cacheGeneratedChunks = (value == "true");
+            else if (key == "worldDirectory") persistence.worldDirectory = value;
+            else if (key == "compressionLevel") persistence.compressionLevel = std::stoi(value);
+        }
         else if (section == "clouds") {
             if (key == "enabled") clouds.enabled = (value == "true");
             else if (key == "height") clouds.height = std::stof(value);
             else if (key == "speed") clouds.speed = std::stof(value);
             else if (key == "density") clouds.density = std::stof(value);
-            else if (key == "updateDistance") clouds.updateDistance = std::stof(value);
             else if (key == "gridSize") clouds.gridSize = std::stoi(value);
             else if (key == "spacing") clouds.spacing = std::stof(value);
             else if (key == "layers") clouds.layers = std::stoi(value);
@@ -355,6 +413,7 @@ void WorldConfig::applySetting(const std::string& section, const std::string& ke
             else if (key == "showChunkInfo") debug.showChunkInfo = (value == "true");
             else if (key == "logTreeGeneration") debug.logTreeGeneration = (value == "true");
             else if (key == "logChunkGeneration") debug.logChunkGeneration = (value == "true");
+            else if (key == "itemBenchmarkDrops") debug.itemBenchmarkDrops = std::stoi(value);
         }
     }
     catch (const std::exception& e) {
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "engine/graphics/Frustum.h"
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include "world/ModularWorldGenerator.h"
+#include "world/WorldConfig.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ToolChecks - what the headless check and benchmark tools share
+ *
+ * Each check prints one "ok"/"FAIL" line; finishChecks() prints PASS or the
+ * number of failures and returns the tool's exit code. Tools that build
+ * chunks by hand keep them in a ChunkMap and read them through lookupIn().
+ * Generated terrain comes from loadGenerator(), either kept whole with
+ * generateChunks() or visited one chunk at a time with forEachGeneratedChunk().
+ */
+
+using ChunkMap = std::unordered_map<glm::ivec2, std::unique_ptr<Chunk>, ChunkPositionHash>;
+
+inline int g_failures = 0;
+
+inline void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) g_failures++;
+}
+
+// 0 when every check passed, 1 otherwise
+inline int finishChecks() {
+    if (g_failures > 0) {
+        std::cerr << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS" << std::endl;
+    return 0;
+}
+
+inline ChunkView::Lookup lookupIn(const ChunkMap& chunks) {
+    return [&chunks](const glm::ivec2& chunkPos) -> const Chunk* {
+        auto it = chunks.find(chunkPos);
+        return it != chunks.end() ? it->second.get() : nullptr;
+    };
+}
+
+// The game's projection - 45 degree field of view at 1280x720
+inline Frustum frustumFor(const glm::vec3& eye, float yawDegrees, float pitchDegrees) {
+    float yaw = glm::radians(yawDegrees), pitch = glm::radians(pitchDegrees);
+    glm::vec3 forward(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1280.0f / 720.0f, 0.1f, 10000.0f);
+    Frustum frustum;
+    frustum.updateFromViewProjection(projection * glm::lookAt(eye, eye + forward, glm::vec3(0.0f, 1.0f, 0.0f)));
+    return frustum;
+}
+
+// Threads the tools spread chunk generation over
+inline int workerThreads() {
+    return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+// The game's terrain - world_config.ini from the working directory, with its seed
+inline std::unique_ptr<ModularWorldGenerator> loadGenerator() {
+    g_worldConfig.loadFromFile("world_config.ini");
+    return ModularWorldGenerator::createDefault(g_worldConfig.terrain.seed);
+}
+
+// Chunk positions from min to max on both axes, max included
+inline std::vector<glm::ivec2> chunksBetween(const glm::ivec2& min, const glm::ivec2& max) {
+    std::vector<glm::ivec2> positions;
+    for (int x = min.x; x <= max.x; ++x) {
+        for (int z = min.y; z <= max.y; ++z) {
+            positions.emplace_back(x, z);
+        }
+    }
+    return positions;
+}
+
+// Chunk positions within renderDistance of the origin - the circle World::render draws
+inline std::vector<glm::ivec2> chunksWithin(int renderDistance) {
+    std::vector<glm::ivec2> positions;
+    for (int x = -renderDistance; x <= renderDistance; ++x) {
+        for (int z = -renderDistance; z <= renderDistance; ++z) {
+            if (std::sqrt(static_cast<float>(x * x + z * z)) <= renderDistance) {
+                positions.emplace_back(x, z);
+            }
+        }
+    }
+    return positions;
+}
+
+// work(i) once for every i below count, spread over workerThreads()
+inline void runOnWorkers(size_t count, const std::function<void(size_t)>& work) {
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < workerThreads(); ++t) {
+        threads.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++) work(i);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// Generates each position's chunk on a worker thread, hands it to visit(index, chunk)
+// there and drops it - for areas too large to keep. visit must be thread safe
+inline void forEachGeneratedChunk(ModularWorldGenerator& generator, const std::vector<glm::ivec2>& positions,
+                                  const std::function<void(size_t, Chunk&)>& visit) {
+    runOnWorkers(positions.size(), [&](size_t i) {
+        Chunk chunk(positions[i], &generator, false);
+        chunk.generateTerrainOnly();
+        visit(i, chunk);
+    });
+}
+
+// Chunks from min to max, max included, generated on every worker thread and kept
+inline ChunkMap generateChunks(ModularWorldGenerator& generator, const glm::ivec2& min, const glm::ivec2& max) {
+    std::vector<glm::ivec2> positions = chunksBetween(min, max);
+    ChunkMap chunks;
+    for (const glm::ivec2& position : positions) {
+        chunks[position] = std::make_unique<Chunk>(position, &generator, false);
+    }
+    runOnWorkers(positions.size(), [&](size_t i) { chunks.at(positions[i])->generateTerrainOnly(); });
+    return chunks;
+}
@@ -0,0 +1,180 @@
+/**
+ * Asset packer - bakes the game's textures and shaders into one bundle
+ *
+ * Decodes every image under assets/textures, flips it to GL row order and
+ * builds its full mip chain with a 2x2 box filter, then writes those levels
+ * and every shader source under assets/shaders to a single file that
+ * AssetManager mmaps at startup. The game then neither decodes an image nor
+ * calls glGenerateMipmap. The build runs this after copying the assets, so
+ * the bundle sits next to the executable.
+ *
+ * The written bundle is opened again and checked entry by entry.
+ *
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: asset_packer [output] [root]   (defaults: assets.bundle, the current directory)
+ */
+#include "engine/AssetBundle.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Levels down to 1x1, as many as glGenerateMipmap would make
+int mipLevelCount(int width, int height) {
+    int levels = 1;
+    while (width > 1 || height > 1) {
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+        levels++;
+    }
+    return levels;
+}
+
+// RGBA rows, top first, into the bundle layout: every level, bottom row first
+std::vector<uint8_t> buildMipChain(const uint8_t* pixels, int width, int height, int levels) {
+    std::vector<uint8_t> chain(AssetBundle::mipChainSize(width, height, levels));
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    for (int row = 0; row < height; row++) {
+        std::memcpy(&chain[(height - 1 - row) * rowBytes], pixels + row * rowBytes, rowBytes);
+    }
+
+    // Each level averages 2x2 blocks of the one before; an odd edge reuses its last texel
+    size_t source = 0;
+    size_t target = rowBytes * height;
+    int sourceWidth = width;
+    int sourceHeight = height;
+    for (int level = 1; level < levels; level++) {
+        int levelWidth = std::max(1, sourceWidth / 2);
+        int levelHeight = std::max(1, sourceHeight / 2);
+        for (int y = 0; y < levelHeight; y++) {
+            int y0 = std::min(y * 2, sourceHeight - 1);
+            int y1 = std::min(y * 2 + 1, sourceHeight - 1);
+            for (int x = 0; x < levelWidth; x++) {
+                int x0 = std::min(x * 2, sourceWidth - 1);
+                int x1 = std::min(x * 2 + 1, sourceWidth - 1);
+                for (int c = 0; c < 4; c++) {
+                    auto texel = [&](int tx, int ty) {
+                        return chain[source + (static_cast<size_t>(ty) * sourceWidth + tx) * 4 + c];
+                    };
+                    int sum = texel(x0, y0) + texel(x1, y0) + texel(x0, y1) + texel(x1, y1);
+                    chain[target + (static_cast<size_t>(y) * levelWidth + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        source = target;
+        target += static_cast<size_t>(levelWidth) * levelHeight * 4;
+        sourceWidth = levelWidth;
+        sourceHeight = levelHeight;
+    }
+    return chain;
+}
+
+// Files directly in root/directory, as the paths the game asks for
+std::vector<std::string> listFiles(const std::filesystem::path& root, const std::string& directory,
+                                   const std::vector<std::string>& extensions) {
+    std::vector<std::string> paths;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(root / directory, error)) {
+        std::string extension = entry.path().extension().string();
+        if (entry.is_regular_file() && std::find(extensions.begin(), extensions.end(), extension) != extensions.end()) {
+            paths.push_back(directory + "/" + entry.path().filename().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string output = argc > 1 ? argv[1] : AssetBundle::DEFAULT_PATH;
+    std::filesystem::path root = argc > 2 ? argv[2] : ".";
+
+    auto start = std::chrono::steady_clock::now();
+    AssetBundleWriter writer;
+    std::vector<std::string> textures = listFiles(root, "assets/textures", {".png", ".jpg", ".tga", ".bmp", ".webp"});
+    std::vector<std::string> shaders = listFiles(root, "assets/shaders", {".vert", ".frag"});
+
+    struct Expected {
+        std::string path;
+        int width, height, levels;
+    };
+    std::vector<Expected> expected;
+    std::vector<std::string> shaderSources;
+    size_t textureBytes = 0;
+    for (const auto& path : textures) {
+        std::string file = (root / path).string();
+        int width, height, channels;
+        unsigned char* pixels = stbi_load(file.c_str(), &width, &height, &channels, 4);
+        if (!pixels) {
+            // The game falls back to loading the loose file, so a skipped image is not fatal
+            std::cout << "  skip  " << path << " (" << stbi_failure_reason() << ")" << std::endl;
+            continue;
+        }
+        int levels = mipLevelCount(width, height);
+        std::vector<uint8_t> chain = buildMipChain(pixels, width, height, levels);
+        stbi_image_free(pixels);
+
+        textureBytes += chain.size();
+        std::cout << "  tex   " << path << " " << width << "x" << height << ", " << levels << " levels" << std::endl;
+        writer.addTexture(path, width, height, levels, std::move(chain), AssetBundle::sourceTime(file));
+        expected.push_back({path, width, height, levels});
+    }
+
+    for (const auto& path : shaders) {
+        std::string file = (root / path).string();
+        std::ifstream stream(file, std::ios::binary);
+        std::stringstream source;
+        source << stream.rdbuf();
+        std::cout << "  glsl  " << path << std::endl;
+        shaderSources.push_back(source.str());
+        writer.addShader(path, shaderSources.back(), AssetBundle::sourceTime(file));
+    }
+
+    if (!writer.write(output)) {
+        return 1;
+    }
+
+    // Read it back the way the game will
+    AssetBundle bundle;
+    if (!bundle.open(output)) {
+        std::cerr << "FAIL: " << output << " cannot be opened" << std::endl;
+        return 1;
+    }
+    int failures = 0;
+    for (const auto& packed : expected) {
+        const PackedTexture* texture = bundle.findTexture(packed.path);
+        if (!texture || texture->width != packed.width || texture->height != packed.height ||
+            texture->levels != packed.levels) {
+            std::cerr << "  FAIL  " << packed.path << " is missing or has the wrong size" << std::endl;
+            failures++;
+        }
+    }
+    for (size_t i = 0; i < shaders.size(); i++) {
+        std::string source;
+        if (!bundle.findShader(shaders[i], source) || source != shaderSources[i]) {
+            std::cerr << "  FAIL  " << shaders[i] << " is missing or differs" << std::endl;
+            failures++;
+        }
+    }
+    if (failures > 0) {
+        std::cerr << "FAIL: " << failures << " check(s) failed" << std::endl;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Packed " << expected.size() << " textures (" << textureBytes / 1024 << " KiB with mipmaps) and "
+              << shaders.size() << " shaders into " << output << " in " << ms << " ms" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+/**
+ * Collision Check - swept boxes against hand-built block layouts
+ *
+ * Builds small scenes (a floor, walls, ledges, ceilings, a missing chunk)
+ * and checks what VoxelCollider::move does in each: landing, sliding, step-up,
+ * no tunnelling, and identical results for identical inputs. Then times
+ * player- and item-sized moves over generated terrain.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: collision_check [moves]
+ */
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include "world/VoxelCollider.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Same size as Game's player
+const glm::vec3 PLAYER_HALF(0.3f, 0.9f, 0.3f);
+const int FLOOR_Y = 10;            // Floor blocks, tops at 10.5
+const float FLOOR_TOP = FLOOR_Y + 0.5f;
+
+bool near(float a, float b) {
+    return std::fabs(a - b) < 1e-3f;
+}
+
+// All-air chunks around the origin with a stone floor, plus helpers to build on it
+struct Scene {
+    ChunkMap chunks;
+
+    explicit Scene(int radius = 1) {
+        for (int x = -radius; x <= radius; ++x) {
+            for (int z = -radius; z <= radius; ++z) {
+                auto chunk = std::make_unique<Chunk>(glm::ivec2(x, z), nullptr, false);
+                for (int lx = 0; lx < CHUNK_SIZE; ++lx) {
+                    for (int lz = 0; lz < CHUNK_SIZE; ++lz) {
+                        chunk->setBlockFast(lx, FLOOR_Y, lz, BlockType::STONE);
+                    }
+                }
+                chunks[glm::ivec2(x, z)] = std::move(chunk);
+            }
+        }
+    }
+
+    void set(int x, int y, int z, BlockType type) {
+        Chunk* chunk = chunks.at(glm::ivec2(x >> 4, z >> 4)).get();
+        chunk->setBlockFast(x & (CHUNK_SIZE - 1), y, z & (CHUNK_SIZE - 1), type);
+    }
+
+    ChunkView view() const {
+        return ChunkView(lookupIn(chunks));
+    }
+};
+
+// Player box standing with its feet at a height
+AABB playerAt(float x, float feet, float z) {
+    glm::vec3 center(x, feet + PLAYER_HALF.y, z);
+    return {center - PLAYER_HALF, center + PLAYER_HALF};
+}
+
+void checkLanding() {
+    std::cout << "Landing and walls:" << std::endl;
+    Scene scene;
+    ChunkView view = scene.view();
+    VoxelCollider collider;
+
+    AABB box = playerAt(4.0f, FLOOR_TOP + 2.0f, 4.0f);
+    CollisionResult result = collider.move(view, box, glm::vec3(0.0f, -5.0f, 0.0f));
+    check(near(box.min.y, FLOOR_TOP) && result.onGround && result.collidedY, "a falling box lands on the floor's top face");
+    check(near(result.motion.y, -2.0f), "the motion made is the distance to the floor");
+
+    box = playerAt(4.0f, FLOOR_TOP + 30.0f, 4.0f);
+    collider.move(view, box, glm::vec3(0.0f, -200.0f, 0.0f));
+    check(near(box.min.y, FLOOR_TOP), "a 200-block fall in one move does not tunnel");
+
+    // Wall along z at x = 6, so the box is stopped in x and slides on in z
+    for (int y = FLOOR_Y + 1; y <= FLOOR_Y + 3; ++y) {
+        for (int z = -8; z <= 8; ++z) {
+            scene.set(6, y, z, BlockType::STONE);
+        }
+    }
+    view = scene.view();
+    box = playerAt(4.0f, FLOOR_TOP, 0.0f);
+    result = collider.move(view, box, glm::vec3(3.0f, 0.0f, 2.0f));
+    check(result.collidedX && !result.collidedZ, "a wall stops x but not z");
+    check(near(box.max.x, 5.5f) && near(box.min.z, 2.0f - PLAYER_HALF.z), "the box slides along the wall");
+
+    box = playerAt(4.0f, FLOOR_TOP, 0.0f);
+    result = collider.move(view, box, glm::vec3(1.2f, 0.0f, 0.0f));
+    AABB again = box;
+    result = collider.move(view, again, glm::vec3(0.5f, 0.0f, 0.0f));
+    check(near(result.motion.x, 0.0f) && result.collidedX, "a box touching a wall can't be pushed into it");
+    check(!collider.intersects(view, box), "the box ends outside every block");
+
+    // Water is not solid
+    scene.set(2, FLOOR_Y + 1, 2, BlockType::WATER);
+    view = scene.view();
+    box = playerAt(0.0f, FLOOR_TOP, 2.0f);
+    result = collider.move(view, box, glm::vec3(3.0f, 0.0f, 0.0f));
+    check(!result.collidedX && near(result.motion.x, 3.0f), "water does not block");
+}
+
+void checkStepUp() {
+    std::cout << "Step-up:" << std::endl;
+    Scene scene;
+    // One-block ledge from x = 3 on
+    for (int x = 3; x <= 10; ++x) {
+        for (int z = -4; z <= 4; ++z) {
+            scene.set(x, FLOOR_Y + 1, z, BlockType::STONE);
+        }
+    }
+    ChunkView view = scene.view();
+    VoxelCollider collider;
+    const glm::vec3 walk(1.0f, -0.1f, 0.0f);
+
+    AABB box = playerAt(1.8f, FLOOR_TOP, 0.0f);
+    CollisionResult result = collider.move(view, box, walk, 1.0f);
+    check(result.steppedUp && near(box.min.y, FLOOR_TOP + 1.0f), "a step of 1.0 climbs a one-block ledge");
+    check(near(box.min.x, 2.5f) && result.onGround, "the climb keeps the whole move and lands on the ledge");
+
+    box = playerAt(1.8f, FLOOR_TOP, 0.0f);
+    result = collider.move(view, box, walk, 0.5f);
+    check(!result.steppedUp && near(box.min.y, FLOOR_TOP) && result.collidedX, "a step of 0.5 does not");
+
+    box = playerAt(1.8f, FLOOR_TOP + 0.5f, 0.0f);
+    result = collider.move(view, box, walk, 1.0f);
+    check(!result.steppedUp && result.collidedX, "a box in the air does not step");
+
+    // Ceiling two blocks over the ledge leaves no room for the player on it
+    for (int x = 3; x <= 10; ++x) {
+        for (int z = -4; z <= 4; ++z) {
+            scene.set(x, FLOOR_Y + 3, z, BlockType::STONE);
+        }
+    }
+    view = scene.view();
+    box = playerAt(1.8f, FLOOR_TOP, 0.0f);
+    result = collider.move(view, box, walk, 1.0f);
+    check(!result.steppedUp && near(box.min.y, FLOOR_TOP) && near(box.max.x, 2.5f), "a low ceiling blocks the step");
+}
+
+void checkBroadphase() {
+    std::cout << "Broadphase and unseen chunks:" << std::endl;
+    Scene scene;
+    ChunkView view = scene.view();
+    VoxelCollider collider;
+
+    // Sweep covers x 0.7 .. 3.3, y 10.2 .. 12.3, z 0.7 .. 1.3 - blocks 1..3, 10..12 and 1
+    AABB box = playerAt(1.0f, FLOOR_TOP, 1.0f);
+    long long before = collider.getVoxelsVisited();
+    collider.move(view, box, glm::vec3(2.0f, -0.3f, 0.0f));
+    long long visited = collider.getVoxelsVisited() - before;
+    check(visited == 3 * 3 * 1, "a move reads only the voxels its sweep overlaps (" + std::to_string(visited) + ")");
+
+    // Unseen chunk at +x: the box stops at its edge instead of walking in
+    box = playerAt(CHUNK_SIZE * 2 - 1.0f, FLOOR_TOP, 1.0f);
+    CollisionResult result = collider.move(view, box, glm::vec3(3.0f, 0.0f, 0.0f));
+    check(result.collidedX && near(box.max.x, CHUNK_SIZE * 2 - 0.5f), "a chunk that isn't there is solid");
+
+    box = playerAt(1.0f, CHUNK_HEIGHT + 10.0f, 1.0f);
+    result = collider.move(view, box, glm::vec3(0.0f, 5.0f, 0.0f));
+    check(near(result.motion.y, 5.0f), "above the world is open");
+}
+
+// Random walks over generated terrain, recording every final box
+std::vector<AABB> randomMoves(ChunkView& view, VoxelCollider& collider, const glm::vec3& half, float step,
+                              int moves, float span, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(2.0f, span - 2.0f);
+    std::uniform_real_distribution<float> motion(-0.5f, 0.5f);
+    std::uniform_real_distribution<float> height(0.0f, CHUNK_HEIGHT);
+
+    std::vector<AABB> boxes;
+    boxes.reserve(moves);
+    for (int i = 0; i < moves; ++i) {
+        glm::vec3 center(position(rng), height(rng), position(rng));
+        AABB box{center - half, center + half};
+        collider.move(view, box, glm::vec3(motion(rng), motion(rng) - 0.2f, motion(rng)), step);
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+void benchmarkGenerated(int moves) {
+    const int chunkSide = 6;
+    auto generator = loadGenerator();
+    ChunkMap chunks = generateChunks(*generator, glm::ivec2(0, 0), glm::ivec2(chunkSide - 1, chunkSide - 1));
+    auto lookup = lookupIn(chunks);
+    const float span = static_cast<float>(chunkSide * CHUNK_SIZE);
+
+    std::cout << "Generated terrain (" << chunks.size() << " chunks, seed " << g_worldConfig.terrain.seed
+              << ", " << moves << " moves):" << std::endl;
+
+    {
+        ChunkView first(lookup), second(lookup);
+        VoxelCollider a, b;
+        std::vector<AABB> runA = randomMoves(first, a, PLAYER_HALF, 1.0f, 2000, span, 7);
+        std::vector<AABB> runB = randomMoves(second, b, PLAYER_HALF, 1.0f, 2000, span, 7);
+        check(std::memcmp(runA.data(), runB.data(), runA.size() * sizeof(AABB)) == 0,
+              "the same moves give bit-identical boxes");
+    }
+
+    struct Shape {
+        const char* name;
+        glm::vec3 half;
+        float stepHeight;
+    };
+    const Shape shapes[] = {
+        {"player", PLAYER_HALF, 1.0f},
+        {"item", glm::vec3(0.125f), 0.0f},
+    };
+    for (const auto& [name, half, stepHeight] : shapes) {
+        ChunkView view(lookup);
+        VoxelCollider collider;
+        Utils::Timer timer;
+        std::vector<AABB> boxes = randomMoves(view, collider, half, stepHeight, moves, span, 1);
+        double ms = timer.elapsedMs();
+        std::cout << "  " << name << " moves: " << ms * 1e6 / moves << " ns per move, "
+                  << static_cast<long long>(moves / (ms / 1000.0)) << " moves/s, "
+                  << static_cast<double>(collider.getVoxelsVisited()) / moves << " voxels per move, "
+                  << view.getLookups() << " chunk lookups" << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int moves = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+    checkLanding();
+    checkStepUp();
+    checkBroadphase();
+    benchmarkGenerated(moves);
+
+    return finishChecks();
+}
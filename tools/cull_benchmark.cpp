@@ -0,0 +1,180 @@
+/**
+ * Cull Benchmark - per-chunk versus batched frustum culling
+ *
+ * Generates every chunk within the render distance and keeps each mesh's
+ * bounds, then culls them from a ring of camera directions four ways: one
+ * Frustum::isChunkVisible call per chunk walking the chunk map against the old
+ * fixed 0..128 box, the same with the tight mesh bounds, and BatchFrustumCuller
+ * without and with its coarse cells. Reports time per cull, chunks passing,
+ * and checks the batches pass exactly what the one-at-a-time test passes.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: cull_benchmark [renderDistance]   (default: 32)
+ */
+#include "engine/graphics/BatchFrustumCuller.h"
+#include "engine/graphics/Frustum.h"
+#include "world/Chunk.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct Bounds {
+    glm::vec3 min;
+    glm::vec3 max;
+};
+
+// Boxes touching a plane within rounding may go either way depending on how
+// the test is vectorized
+bool isOnEdge(const Frustum& frustum, const Bounds& box) {
+    for (const glm::vec4& plane : frustum.planes) {
+        glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x, plane.y >= 0.0f ? box.max.y : box.min.y,
+                           plane.z >= 0.0f ? box.max.z : box.min.z);
+        if (std::abs(glm::dot(glm::vec3(plane), positive) + plane.w) < 1e-3f) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int renderDistance = argc > 1 ? std::max(1, std::stoi(argv[1])) : 32;
+
+    auto generator = loadGenerator();
+    std::vector<glm::ivec2> positions = chunksWithin(renderDistance);
+
+    std::cout << "Cull benchmark: " << positions.size() << " chunks (render distance " << renderDistance
+              << "), seed " << g_worldConfig.terrain.seed << ", " << workerThreads() << " threads" << std::endl;
+
+    std::vector<Bounds> tight(positions.size());
+    forEachGeneratedChunk(*generator, positions, [&](size_t i, Chunk& chunk) {
+        ChunkMeshData meshData;
+        chunk.buildMeshData(meshData);
+        glm::vec3 origin = chunk.getWorldPosition();
+        tight[i].min = glm::vec3(origin.x - 0.5f, meshData.minY, origin.z - 0.5f);
+        tight[i].max = glm::vec3(origin.x + CHUNK_SIZE - 0.5f, meshData.maxY, origin.z + CHUNK_SIZE - 0.5f);
+    });
+
+    float lowest = CHUNK_HEIGHT, highest = 0.0f;
+    for (const Bounds& box : tight) {
+        lowest = std::min(lowest, box.min.y);
+        highest = std::max(highest, box.max.y);
+    }
+    std::cout << "Mesh bounds span y " << lowest << " to " << highest << " (old box: 0 to 128)" << std::endl;
+
+    // What World::render walked before - the chunk map, one box at a time
+    std::unordered_map<glm::ivec2, std::unique_ptr<Bounds>, ChunkPositionHash> chunkMap;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        chunkMap[positions[i]] = std::make_unique<Bounds>(tight[i]);
+    }
+
+    BatchFrustumCuller flat;
+    BatchFrustumCuller celled(8.0f * CHUNK_SIZE);
+    double buildMs[2] = {};
+    BatchFrustumCuller* cullers[2] = {&flat, &celled};
+    for (int c = 0; c < 2; ++c) {
+        Utils::Timer timer;
+        cullers[c]->clear();
+        for (const Bounds& box : tight) {
+            cullers[c]->add(box.min, box.max);
+        }
+        cullers[c]->build();
+        buildMs[c] = timer.elapsedMs();
+    }
+
+    // Standing at spawn and flying over it, each looking level, down, and steeply down
+    std::vector<std::pair<glm::vec3, float>> poses;
+    for (float eyeY : {generator->getTerrainHeight(8, 8) + 2.1f, 100.0f}) {
+        for (float pitch : {0.0f, -30.0f, -60.0f}) {
+            poses.emplace_back(glm::vec3(8.0f, eyeY, 8.0f), pitch);
+        }
+    }
+    const int yawCount = 8;
+    const int runs = 50;
+
+    double totalMs[4] = {};
+    long long totalPassed[4] = {};
+    int views = 0, mismatches = 0;
+    std::vector<int> visible;
+    std::vector<int> scalarVisible;
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto& [eye, pitch] : poses) {
+        long long passed[4] = {};
+        double ms[4] = {};
+        for (int view = 0; view < yawCount; ++view) {
+            Frustum frustum = frustumFor(eye, 360.0f * view / yawCount, pitch);
+            views++;
+
+            // Old: chunk map, fixed column box
+            int count = 0;
+            Utils::Timer oldTimer;
+            for (int run = 0; run < runs; ++run) {
+                count = 0;
+                for (const auto& chunkPair : chunkMap) {
+                    glm::vec3 chunkMin(chunkPair.first.x * 16.0f, 0.0f, chunkPair.first.y * 16.0f);
+                    if (frustum.isChunkVisible(chunkMin, chunkMin + glm::vec3(16.0f, 128.0f, 16.0f))) count++;
+                }
+            }
+            ms[0] += oldTimer.elapsedMs() / runs;
+            passed[0] += count;
+
+            // Scalar, tight bounds
+            Utils::Timer scalarTimer;
+            for (int run = 0; run < runs; ++run) {
+                scalarVisible.clear();
+                for (size_t i = 0; i < tight.size(); ++i) {
+                    if (frustum.isChunkVisible(tight[i].min, tight[i].max)) scalarVisible.push_back(static_cast<int>(i));
+                }
+            }
+            ms[1] += scalarTimer.elapsedMs() / runs;
+            passed[1] += scalarVisible.size();
+
+            for (int c = 0; c < 2; ++c) {
+                Utils::Timer batchTimer;
+                for (int run = 0; run < runs; ++run) {
+                    cullers[c]->cull(frustum, visible);
+                }
+                ms[2 + c] += batchTimer.elapsedMs() / runs;
+                passed[2 + c] += visible.size();
+
+                std::vector<char> inBatch(tight.size(), 0), inScalar(tight.size(), 0);
+                for (int i : visible) inBatch[i] = 1;
+                for (int i : scalarVisible) inScalar[i] = 1;
+                for (size_t i = 0; i < tight.size(); ++i) {
+                    if (inBatch[i] != inScalar[i] && !isOnEdge(frustum, tight[i])) mismatches++;
+                }
+            }
+        }
+
+        std::cout << "\nEye at y " << std::setprecision(0) << eye.y << ", pitch " << pitch << std::setprecision(3)
+                  << " (mean of " << yawCount << " directions):" << std::endl;
+        const char* names[4] = {"per chunk, 0..128 box", "per chunk, mesh bounds", "batch", "batch + cells"};
+        for (int method = 0; method < 4; ++method) {
+            std::cout << "  " << std::left << std::setw(24) << names[method] << std::right << std::setw(8)
+                      << ms[method] / yawCount << " ms " << std::setw(6) << passed[method] / yawCount
+                      << " chunks pass" << std::endl;
+            totalMs[method] += ms[method];
+            totalPassed[method] += passed[method];
+        }
+    }
+
+    std::cout << "\nBuild: " << buildMs[0] << " ms flat, " << buildMs[1] << " ms with cells" << std::endl;
+    std::cout << "Overall: " << totalMs[0] / views << " ms -> " << totalMs[3] / views << " ms per cull ("
+              << std::setprecision(1) << totalMs[0] / std::max(totalMs[3], 1e-9) << "x), "
+              << totalPassed[0] / views << " -> " << totalPassed[3] / views << " chunks pass" << std::endl;
+
+    check(mismatches == 0, "both batches pass exactly the chunks the per-chunk test passes");
+    check(totalPassed[1] <= totalPassed[0], "mesh bounds pass no more chunks than the column box");
+    check(totalMs[3] < totalMs[0], "batched culling is faster than the per-chunk walk");
+
+    return finishChecks();
+}
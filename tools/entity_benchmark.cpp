@@ -0,0 +1,302 @@
+/**
+ * Entity Benchmark - item drops as objects versus the ItemStore
+ *
+ * Generates the terrain under a square field of drops, then steps them at
+ * 60 Hz two ways: the old layout - one heap object per drop, a virtual update
+ * each, a locked chunk-map lookup for every block read and a distance test
+ * against every drop to find what the player collects - and ItemStore with its
+ * cached ChunkView, VoxelCollider and spatial hash. Reports milliseconds per
+ * step, checks that every drop lands on a block and none inside one, that hash
+ * queries find exactly what a brute-force scan finds, and that merging keeps
+ * every item.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: entity_benchmark [drops]   (default: 50000)
+ */
+#include "entities/ItemStore.h"
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include "world/VoxelCollider.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// World::getBlock as it stands: lock the map, find the chunk, read the block
+struct LockedWorld {
+    const ChunkMap* chunks;
+    mutable std::mutex mutex;
+
+    BlockType getBlock(int x, int y, int z) const {
+        if (y < 0 || y >= CHUNK_HEIGHT) return BlockType::AIR;
+        glm::ivec2 chunkPos(x / CHUNK_SIZE, z / CHUNK_SIZE);
+        int localX = x % CHUNK_SIZE, localZ = z % CHUNK_SIZE;
+        if (localX < 0) { localX += CHUNK_SIZE; chunkPos.x--; }
+        if (localZ < 0) { localZ += CHUNK_SIZE; chunkPos.y--; }
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = chunks->find(chunkPos);
+        return it != chunks->end() ? it->second->getBlock(localX, y, localZ) : BlockType::AIR;
+    }
+};
+
+// The drop as an Entity subclass, with ItemEntity's physics
+class LegacyEntity {
+public:
+    virtual ~LegacyEntity() = default;
+    virtual void update(float deltaTime) = 0;
+};
+
+class LegacyItem : public LegacyEntity {
+public:
+    LegacyItem(const glm::vec3& position, const glm::vec3& velocity, BlockType type, const LockedWorld* world)
+        : position(position), velocity(velocity), type(type), world(world) {}
+
+    void update(float deltaTime) override {
+        if (collected) return;
+        timeAlive += deltaTime;
+        applyPhysics(deltaTime);
+        position += velocity * deltaTime;
+        rotationY += 90.0f * deltaTime;
+        if (rotationY >= 360.0f) rotationY -= 360.0f;
+        if (onGround) bobOffset = std::sin(timeAlive * 2.0f) * 0.02f;
+    }
+
+    glm::vec3 position, velocity;
+    BlockType type;
+    const LockedWorld* world;
+    float timeAlive = 0.0f, rotationY = 0.0f, bobOffset = 0.0f;
+    bool onGround = false, collected = false;
+
+private:
+    void applyPhysics(float deltaTime) {
+        if (!onGround) {
+            velocity.y += -9.81f * deltaTime;
+            if (velocity.y < -10.0f) velocity.y = -10.0f;
+            velocity.x *= 0.98f;
+            velocity.z *= 0.98f;
+            glm::vec3 next = position + velocity * deltaTime;
+            int blockY = static_cast<int>(std::floor(next.y - 0.1f));
+            BlockType below = world->getBlock(static_cast<int>(std::floor(next.x)), blockY,
+                                              static_cast<int>(std::floor(next.z)));
+            if (below != BlockType::AIR && below != BlockType::WATER) {
+                position.y = blockY + 1.01f;
+                velocity.y = 0.0f;
+                onGround = true;
+            }
+        } else {
+            velocity.x *= 0.9f;
+            velocity.z *= 0.9f;
+            if (glm::length(glm::vec2(velocity.x, velocity.z)) < 0.01f) {
+                velocity.x = 0.0f;
+                velocity.z = 0.0f;
+            }
+            BlockType below = world->getBlock(static_cast<int>(std::floor(position.x)),
+                                              static_cast<int>(std::floor(position.y - 0.2f)),
+                                              static_cast<int>(std::floor(position.z)));
+            if (below == BlockType::AIR || below == BlockType::WATER) onGround = false;
+        }
+    }
+};
+
+const BlockType TYPES[] = {BlockType::GRASS, BlockType::DIRT, BlockType::STONE, BlockType::SAND,
+                           BlockType::OAK_LOG, BlockType::LEAVES, BlockType::GRAVEL};
+const int TYPE_COUNT = static_cast<int>(sizeof(TYPES) / sizeof(TYPES[0]));
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int dropCount = argc > 1 ? std::max(1, std::stoi(argv[1])) : 50000;
+    const float spacing = 0.75f;  // Wider than MERGE_RADIUS, so the field doesn't merge away
+    const float deltaTime = 1.0f / 60.0f;
+    const int steps = 120;
+
+    auto generator = loadGenerator();
+
+    int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(dropCount))));
+    int chunkSide = static_cast<int>(std::ceil(side * spacing / CHUNK_SIZE)) + 1;
+    ChunkMap chunks = generateChunks(*generator, glm::ivec2(0, 0), glm::ivec2(chunkSide - 1, chunkSide - 1));
+
+    std::cout << "Entity benchmark: " << dropCount << " drops over " << chunks.size() << " chunks, seed "
+              << g_worldConfig.terrain.seed << ", " << workerThreads() << " threads" << std::endl;
+
+    auto lookup = lookupIn(chunks);
+
+    // Top face of the highest block under a drop's footprint - trees included
+    auto surfaceAt = [&](float x, float z) {
+        int top = 0;
+        for (int bx = static_cast<int>(std::floor(x + 0.375f)); bx <= static_cast<int>(std::floor(x + 0.625f)); ++bx) {
+            for (int bz = static_cast<int>(std::floor(z + 0.375f)); bz <= static_cast<int>(std::floor(z + 0.625f)); ++bz) {
+                const Chunk* chunk = lookup(glm::ivec2(bx >> 4, bz >> 4));
+                for (int y = CHUNK_HEIGHT - 1; chunk && y > top; --y) {
+                    if (VoxelCollider::isSolid(chunk->getBlockFast(bx & 15, y, bz & 15))) {
+                        top = y;
+                        break;
+                    }
+                }
+            }
+        }
+        return top + 0.5f;
+    };
+
+    // The same field both ways, dropped from just above the terrain
+    ItemStore store;
+    store.reserve(dropCount);
+    for (int i = 0; i < dropCount; ++i) {
+        float x = 0.5f + (i % side) * spacing, z = 0.5f + (i / side) * spacing;
+        float y = surfaceAt(x, z) + 1.0f;
+        store.spawn(glm::vec3(x, y, z), TYPES[i % TYPE_COUNT]);
+    }
+    LockedWorld lockedWorld;
+    lockedWorld.chunks = &chunks;
+    std::vector<std::unique_ptr<LegacyEntity>> legacy;
+    for (size_t i = 0; i < store.size(); ++i) {
+        legacy.push_back(std::make_unique<LegacyItem>(store.getPosition(i), store.getVelocity(i),
+                                                      store.getType(i), &lockedWorld));
+    }
+
+    // The player walks across the field, collecting nothing, so both keep every drop
+    auto playerAt = [&](int step) {
+        float t = static_cast<float>(step) / steps;
+        float x = 0.5f + t * (side - 1) * spacing, z = 0.5f + 0.5f * (side - 1) * spacing;
+        return glm::vec3(x, surfaceAt(x, z) + 0.7f, z);
+    };
+
+    double legacyMs = 0.0;
+    int legacyInReach = 0;
+    for (int step = 0; step < steps; ++step) {
+        Utils::Timer timer;
+        for (auto& entity : legacy) {
+            entity->update(deltaTime);
+        }
+        glm::vec3 player = playerAt(step);
+        for (auto& entity : legacy) {
+            auto* item = static_cast<LegacyItem*>(entity.get());
+            if (item->timeAlive > 0.5f && glm::distance(player, item->position) <= 0.8f) legacyInReach++;
+        }
+        legacyMs += timer.elapsedMs();
+    }
+
+    store.setMergingEnabled(false);
+    double storeMs = 0.0, storeWorstMs = 0.0;
+    int lookups = 0, collectMismatches = 0, storeInReach = 0;
+    for (int step = 0; step < steps; ++step) {
+        Utils::Timer timer;
+        ChunkView view(lookup);
+        store.update(deltaTime, view);
+        int offered = 0;
+        store.collect(playerAt(step), [&offered](BlockType, int) {
+            offered++;
+            return 0;
+        });
+        storeMs += timer.elapsedMs();
+        storeWorstMs = std::max(storeWorstMs, timer.elapsedMs());
+        lookups += view.getLookups();
+        storeInReach += offered;
+
+        // Past the pickup delay every drop can be collected
+        if (step * deltaTime < ItemStore::PICKUP_DELAY + 0.1f) continue;
+        int expected = 0;
+        for (size_t i = 0; i < store.size(); ++i) {
+            if (glm::distance(playerAt(step), store.getPosition(i)) <= ItemStore::COLLECTION_RADIUS) expected++;
+        }
+        if (offered != expected) collectMismatches++;
+    }
+
+    // Landed drops sit on the top face of a block, inside none
+    int landed = 0, floating = 0, buried = 0;
+    VoxelCollider collider;
+    ChunkView checkView(lookup);
+    for (size_t i = 0; i < store.size(); ++i) {
+        glm::vec3 position = store.getPosition(i);
+        AABB box{position - 0.125f, position + 0.125f};
+        if (collider.intersects(checkView, box)) buried++;
+        if (!store.isOnGround(i)) continue;
+        landed++;
+        float top = std::floor(box.min.y + 0.5f) - 0.5f;
+        if (std::abs(box.min.y - top) > 1e-3f || !collider.intersects(checkView, box.moved(glm::vec3(0.0f, -0.01f, 0.0f)))) {
+            floating++;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Objects:   " << std::setw(8) << legacyMs / steps << " ms per step, "
+              << legacyInReach << " drops in reach over the walk" << std::endl;
+    std::cout << "ItemStore: " << std::setw(8) << storeMs / steps << " ms per step ("
+              << std::setprecision(1) << legacyMs / std::max(storeMs, 1e-9) << "x), "
+              << storeInReach << " drops in reach, " << lookups / steps
+              << " chunk lookups per step instead of ~" << 2 * dropCount << std::endl;
+    std::cout << "           " << std::setprecision(3) << std::setw(8) << storeWorstMs
+              << " ms worst step - the objects only tested one block, the store sweeps every falling box" << std::endl;
+    std::cout << landed << " of " << store.size() << " drops landed" << std::endl;
+
+    // Merging on: the first step checks every stack, later ones only stacks that moved.
+    // The field is spaced too far apart to merge.
+    store.setMergingEnabled(true);
+    double mergeMs[2] = {};
+    for (double& ms : mergeMs) {
+        Utils::Timer timer;
+        ChunkView view(lookup);
+        store.update(deltaTime, view);
+        ms = timer.elapsedMs();
+    }
+    std::cout << std::setprecision(3) << "ItemStore with merging: " << mergeMs[0] << " ms checking every stack, "
+              << mergeMs[1] << " ms per step once settled" << std::endl;
+
+    check(landed == static_cast<int>(store.size()), "every drop lands");
+    check(floating == 0, "landed drops rest on a block's top face");
+    check(buried == 0, "no drop ends up inside a block");
+    check(collectMismatches == 0, "collection finds the same drops as testing every one");
+
+    // Hash queries against brute force, around drops and between them - and wider than a cell
+    int queryMismatches = 0;
+    std::vector<int> found;
+    for (size_t q = 0; q < store.size(); q += 97) {
+        glm::vec3 point = store.getPosition(q) + glm::vec3(0.3f * (q % 3), 0.2f, -0.4f * (q % 2));
+        for (float radius : {ItemStore::MERGE_RADIUS, ItemStore::COLLECTION_RADIUS, 2.5f * ItemStore::CELL_SIZE}) {
+            store.query(point, radius, found);
+            std::vector<int> expected;
+            for (size_t i = 0; i < store.size(); ++i) {
+                if (glm::length(store.getPosition(i) - point) <= radius) expected.push_back(static_cast<int>(i));
+            }
+            std::sort(found.begin(), found.end());
+            if (found != expected) queryMismatches++;
+        }
+        if (q > 20000) break;
+    }
+    check(queryMismatches == 0, "spatial hash queries match a brute-force scan");
+    check(store.size() == static_cast<size_t>(dropCount), "spaced-out drops don't merge");
+
+    // A pile of one block type merges into full stacks without losing an item
+    ItemStore pile;
+    const int pileSize = 1000;
+    glm::vec3 pileCenter(side * spacing * 0.5f, 0.0f, side * spacing * 0.5f);
+    pileCenter.y = surfaceAt(pileCenter.x, pileCenter.z) + 1.0f;
+    for (int i = 0; i < pileSize; ++i) {
+        glm::vec3 offset(0.15f * std::cos(i * 0.7f), 0.0f, 0.15f * std::sin(i * 0.7f));
+        pile.spawn(pileCenter + offset, glm::vec3(0.0f), BlockType::STONE, 1);
+    }
+    for (int step = 0; step < 60; ++step) {
+        ChunkView view(lookup);
+        pile.update(deltaTime, view);
+    }
+    std::cout << pileSize << " drops in a pile -> " << pile.size() << " stacks" << std::endl;
+    check(pile.getItemCount() == pileSize, "merging keeps every item");
+    check(pile.size() == static_cast<size_t>((pileSize + ItemStore::MAX_STACK - 1) / ItemStore::MAX_STACK),
+          "a pile merges into full stacks");
+
+    int taken = pile.collect(pile.getPosition(0), [](BlockType, int count) { return count; });
+    check(taken > 0 && pile.getItemCount() == pileSize - taken, "collecting removes exactly what was taken");
+
+    check(storeWorstMs < 1000.0 / 60.0, "every step fits in a 60 Hz frame");
+
+    return finishChecks();
+}
@@ -0,0 +1,182 @@
+/**
+ * Face Benchmark - vertices submitted with and without per-direction face skipping
+ *
+ * Generates every chunk within the render distance, meshes each at the level
+ * of detail its distance asks for, and sends the chunks in the frustum through
+ * the same face-direction test World::render uses. Reports for a ring of
+ * camera directions how many vertices reach the GPU with every direction
+ * drawn versus only the directions facing the camera, and checks that grouping
+ * keeps every triangle and that no skipped face could have been seen.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: face_benchmark [renderDistance]   (default: 16)
+ */
+#include "engine/graphics/Frustum.h"
+#include "world/Chunk.h"
+#include "world/ChunkLODManager.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using LODLevel = ChunkLODManager::LODLevel;
+constexpr int FACE_COUNT = ChunkFacePlanes::FACE_COUNT;
+
+// What one chunk costs to draw, per face direction
+struct ChunkFaces {
+    glm::ivec2 position;
+    glm::vec3 min, max;
+    ChunkFacePlanes facePlanes;
+    size_t vertices[FACE_COUNT] = {};
+    std::vector<float> planes[FACE_COUNT];  // Every face's plane, for the backface check
+};
+
+// Normal of each direction, in addFaceToMesh order
+const glm::vec3 FACE_NORMALS[FACE_COUNT] = {
+    {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}
+};
+const int FACE_AXIS[FACE_COUNT] = {2, 2, 0, 0, 1, 1};
+
+// Sorted triangles of a layer, to compare before and after grouping
+std::vector<std::array<unsigned int, 3>> triangles(const std::vector<unsigned int>& indices) {
+    std::vector<std::array<unsigned int, 3>> result;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        result.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int renderDistance = argc > 1 ? std::max(1, std::stoi(argv[1])) : 16;
+
+    auto generator = loadGenerator();
+
+    ChunkLODManager lod(1);
+    lod.setLODDistances(g_worldConfig.rendering.lodMediumDistance, g_worldConfig.rendering.lodLowDistance);
+    lod.setHysteresis(0.0f);
+
+    std::vector<glm::ivec2> positions = chunksWithin(renderDistance);
+    std::vector<ChunkFaces> chunks(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        chunks[i].position = positions[i];
+    }
+
+    std::cout << "Face benchmark: " << chunks.size() << " chunks (render distance " << renderDistance
+              << "), seed " << g_worldConfig.terrain.seed << ", " << workerThreads() << " threads" << std::endl;
+
+    std::atomic<int> lostTriangles{0}, misfiledFaces{0};
+    std::atomic<long long> groupMicroseconds{0};
+    forEachGeneratedChunk(*generator, positions, [&](size_t i, Chunk& chunk) {
+        ChunkFaces& entry = chunks[i];
+        ChunkMeshData meshData;
+
+        float distance = glm::length(glm::vec2(entry.position));
+        LODLevel level = lod.calculateLODLevel(distance, LODLevel::FULL_DETAIL);
+        chunk.buildMeshData(meshData);
+        glm::vec3 origin = chunk.getWorldPosition();
+        entry.min = glm::vec3(origin.x - 0.5f, meshData.minY, origin.z - 0.5f);
+        entry.max = glm::vec3(origin.x + CHUNK_SIZE - 0.5f, meshData.maxY, origin.z + CHUNK_SIZE - 0.5f);
+        if (level != LODLevel::FULL_DETAIL) {
+            ChunkLODManager::buildLODMeshData(chunk.getBlockData(), entry.position,
+                                              ChunkLODManager::getScale(level), meshData);
+        }
+
+        // Grouping keeps every triangle - shuffle the faces out of order, then regroup
+        if (i % 16 == 0) {
+            std::vector<std::array<unsigned int, 3>> before[ChunkMeshData::LAYER_COUNT];
+            for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+                std::vector<unsigned int>& indices = meshData.indices[layer];
+                before[layer] = triangles(indices);
+                for (size_t a = 0, b = indices.size() / 6; a + 1 < b; ++a, --b) {
+                    std::swap_ranges(indices.begin() + a * 6, indices.begin() + a * 6 + 6, indices.begin() + (b - 1) * 6);
+                }
+            }
+            Utils::Timer timer;
+            meshData.groupByFace();
+            groupMicroseconds += static_cast<long long>(timer.elapsedMs() * 1000.0);
+            for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+                if (triangles(meshData.indices[layer]) != before[layer]) lostTriangles++;
+            }
+        }
+
+        entry.facePlanes = meshData.facePlanes;
+        for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+            const std::vector<unsigned int>& indices = meshData.indices[layer];
+            for (int face = 0; face < FACE_COUNT; ++face) {
+                for (unsigned int index = meshData.faceStart[layer][face]; index < meshData.faceStart[layer][face + 1];
+                     index += 6) {
+                    const Vertex& corner = meshData.vertices[layer][indices[index]];
+                    if (glm::dot(corner.normal, FACE_NORMALS[face]) < 0.5f) misfiledFaces++;
+                    entry.planes[face].push_back(corner.position[FACE_AXIS[face]]);
+                }
+                entry.vertices[face] += (meshData.faceStart[layer][face + 1] - meshData.faceStart[layer][face]) / 6 * 4;
+            }
+        }
+    });
+
+    // Standing at spawn and flying over it, each looking level, down, and steeply down
+    std::vector<std::pair<glm::vec3, float>> poses;
+    for (float eyeY : {generator->getTerrainHeight(8, 8) + 2.1f, 100.0f}) {
+        for (float pitch : {0.0f, -30.0f, -60.0f}) {
+            poses.emplace_back(glm::vec3(8.0f, eyeY, 8.0f), pitch);
+        }
+    }
+    const int yawCount = 8;
+
+    long long totalAll = 0, totalFacing = 0;
+    int wronglySkipped = 0;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& [eye, pitch] : poses) {
+        long long all = 0, facing = 0;
+        for (int view = 0; view < yawCount; ++view) {
+            Frustum frustum = frustumFor(eye, 360.0f * view / yawCount, pitch);
+            for (const ChunkFaces& chunk : chunks) {
+                if (!frustum.isChunkVisible(chunk.min, chunk.max)) continue;
+
+                unsigned int mask = chunk.facePlanes.getVisibleFaces(eye);
+                for (int face = 0; face < FACE_COUNT; ++face) {
+                    all += chunk.vertices[face];
+                    if (mask & (1u << face)) {
+                        facing += chunk.vertices[face];
+                        continue;
+                    }
+                    // A skipped face the camera is in front of would be a hole
+                    float camera = eye[FACE_AXIS[face]];
+                    float sign = FACE_NORMALS[face][FACE_AXIS[face]];
+                    for (float plane : chunk.planes[face]) {
+                        if ((camera - plane) * sign > 0.0f) wronglySkipped++;
+                    }
+                }
+            }
+        }
+        std::cout << "Eye at y " << std::setprecision(0) << eye.y << ", pitch " << pitch << std::setprecision(1)
+                  << ": " << all / yawCount << " -> " << facing / yawCount << " vertices per frame ("
+                  << (all > 0 ? 100.0 - 100.0 * facing / all : 0.0) << "% skipped)" << std::endl;
+        totalAll += all;
+        totalFacing += facing;
+    }
+
+    double skipped = totalAll > 0 ? 100.0 - 100.0 * totalFacing / totalAll : 0.0;
+    std::cout << "Overall: " << skipped << "% of the vertices in the frustum are never submitted, grouping "
+              << std::setprecision(3) << groupMicroseconds / 1000.0 / ((chunks.size() + 15) / 16)
+              << " ms per mesh" << std::endl;
+
+    check(lostTriangles == 0, "grouping by direction keeps every triangle");
+    check(misfiledFaces == 0, "every face lands in its own direction's group");
+    check(wronglySkipped == 0, "no skipped face has its front towards the camera");
+    check(skipped > 0.0, "some vertices are skipped");
+
+    return finishChecks();
+}
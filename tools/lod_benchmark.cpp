@@ -0,0 +1,166 @@
+/**
+ * LOD Benchmark - triangle counts with and without downsampled chunk meshes
+ *
+ * Generates every chunk within the largest requested render distance, meshes
+ * each one at full detail and at the 2x and 4x LOD levels, then reports for
+ * each render distance how many triangles and draw calls the world costs with
+ * every chunk at full detail versus with the configured LOD distances.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: lod_benchmark [renderDistance...]   (default: 16 32)
+ */
+#include "world/Chunk.h"
+#include "world/ChunkLODManager.h"
+#include "world/ModularWorldGenerator.h"
+#include "world/WorldConfig.h"
+#include "utils/ModernCpp.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using LODLevel = ChunkLODManager::LODLevel;
+constexpr int LEVEL_COUNT = ChunkLODManager::LEVEL_COUNT;
+
+struct ChunkCost {
+    size_t triangles[LEVEL_COUNT] = {};
+    int drawCalls[LEVEL_COUNT] = {};   // Non-empty material meshes
+};
+
+void countMesh(const ChunkMeshData& meshData, size_t& triangles, int& drawCalls) {
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        triangles += meshData.indices[layer].size() / 3;
+        if (!meshData.indices[layer].empty()) {
+            drawCalls++;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<int> renderDistances;
+    for (int i = 1; i < argc; ++i) {
+        renderDistances.push_back(std::max(1, std::stoi(argv[i])));
+    }
+    if (renderDistances.empty()) {
+        renderDistances = {16, 32};
+    }
+    int maxDistance = *std::max_element(renderDistances.begin(), renderDistances.end());
+
+    g_worldConfig.loadFromFile("world_config.ini");
+    auto generator = ModularWorldGenerator::createDefault(g_worldConfig.terrain.seed);
+
+    // Same circle World::render draws
+    std::vector<glm::ivec2> positions;
+    for (int x = -maxDistance; x <= maxDistance; ++x) {
+        for (int z = -maxDistance; z <= maxDistance; ++z) {
+            if (std::sqrt(static_cast<float>(x * x + z * z)) <= maxDistance) {
+                positions.emplace_back(x, z);
+            }
+        }
+    }
+
+    int threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::cout << "LOD benchmark: " << positions.size() << " chunks, seed " << g_worldConfig.terrain.seed
+              << ", LOD at " << g_worldConfig.rendering.lodMediumDistance << " / "
+              << g_worldConfig.rendering.lodLowDistance << " chunks, " << threadCount << " threads" << std::endl;
+
+    std::vector<ChunkCost> costs(positions.size());
+    double meshMs[LEVEL_COUNT] = {};
+    std::mutex timesMutex;
+    std::atomic<size_t> next{0};
+
+    auto worker = [&]() {
+        ChunkMeshData meshData;
+        double localMs[LEVEL_COUNT] = {};
+
+        for (size_t i = next++; i < positions.size(); i = next++) {
+            Chunk chunk(positions[i], generator.get(), false);
+            chunk.generateTerrainOnly();
+
+            Utils::Timer fullTimer;
+            chunk.buildMeshData(meshData);
+            localMs[0] += fullTimer.elapsedMs();
+            countMesh(meshData, costs[i].triangles[0], costs[i].drawCalls[0]);
+
+            for (int level = 1; level < LEVEL_COUNT; ++level) {
+                Utils::Timer lodTimer;
+                ChunkLODManager::buildLODMeshData(chunk.getBlockData(), positions[i],
+                                                  ChunkLODManager::getScale(static_cast<LODLevel>(level)), meshData);
+                localMs[level] += lodTimer.elapsedMs();
+                countMesh(meshData, costs[i].triangles[level], costs[i].drawCalls[level]);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(timesMutex);
+        for (int level = 0; level < LEVEL_COUNT; ++level) {
+            meshMs[level] += localMs[level];
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const char* levelNames[LEVEL_COUNT] = {"full", "2x", "4x"};
+    std::cout << "Mesh build (mean per chunk):";
+    for (int level = 0; level < LEVEL_COUNT; ++level) {
+        std::cout << " " << levelNames[level] << " " << std::fixed << std::setprecision(3)
+                  << meshMs[level] / positions.size() << " ms";
+    }
+    std::cout << std::endl;
+
+    // Steady state: no hysteresis, every chunk at the level its distance asks for
+    ChunkLODManager lod(1);
+    lod.setLODDistances(g_worldConfig.rendering.lodMediumDistance, g_worldConfig.rendering.lodLowDistance);
+    lod.setHysteresis(0.0f);
+
+    for (int renderDistance : renderDistances) {
+        int chunks[LEVEL_COUNT] = {};
+        size_t triangles[LEVEL_COUNT] = {};
+        size_t fullOnlyTriangles = 0;
+        int fullOnlyDrawCalls = 0;
+        int lodDrawCalls = 0;
+
+        for (size_t i = 0; i < positions.size(); ++i) {
+            float distance = std::sqrt(static_cast<float>(positions[i].x * positions[i].x +
+                                                          positions[i].y * positions[i].y));
+            if (distance > renderDistance) continue;
+
+            int level = static_cast<int>(lod.calculateLODLevel(distance, LODLevel::FULL_DETAIL));
+            chunks[level]++;
+            triangles[level] += costs[i].triangles[level];
+            lodDrawCalls += costs[i].drawCalls[level];
+            fullOnlyTriangles += costs[i].triangles[0];
+            fullOnlyDrawCalls += costs[i].drawCalls[0];
+        }
+
+        size_t lodTriangles = 0;
+        std::cout << "\nRender distance " << renderDistance << ":" << std::endl;
+        for (int level = 0; level < LEVEL_COUNT; ++level) {
+            lodTriangles += triangles[level];
+            std::cout << "  " << std::left << std::setw(6) << levelNames[level] << std::right
+                      << std::setw(6) << chunks[level] << " chunks " << std::setw(10) << triangles[level]
+                      << " triangles" << std::endl;
+        }
+        std::cout << "  Full detail everywhere: " << fullOnlyTriangles << " triangles, "
+                  << fullOnlyDrawCalls << " draw calls" << std::endl;
+        std::cout << "  With LOD:               " << lodTriangles << " triangles, " << lodDrawCalls
+                  << " draw calls (" << std::setprecision(1)
+                  << (fullOnlyTriangles > 0 ? 100.0 * lodTriangles / fullOnlyTriangles : 0.0)
+                  << "% of the triangles)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,334 @@
+/**
+ * Occlusion Check - the software occlusion culler on known scenes
+ *
+ * Rasterizes hand-built occluders (a wall, a low ridge) and checks which
+ * chunk boxes behind, beside and above them are hidden, that the occluder a
+ * chunk extracts from its blocks is conservative, and that the worker thread
+ * agrees with the synchronous pass. Then it culls generated terrain, times it,
+ * and casts voxel rays at every chunk it hid to prove none of them shows.
+ * Runs headless - no window or GL context is created.
+ *
+ * This is the correctness gate for the occlusion culler: any scene whose
+ * result changes fails the run.
+ *
+ * Usage: occlusion_check
+ */
+#include "engine/graphics/OcclusionCuller.h"
+#include "engine/graphics/Frustum.h"
+#include "world/Chunk.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// The game's projection - 45 degree field of view at 1280x720
+glm::mat4 viewProjection(const glm::vec3& eye, const glm::vec3& forward) {
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1280.0f / 720.0f, 0.1f, 10000.0f);
+    return projection * glm::lookAt(eye, eye + forward, glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+ChunkOccluder solidTo(int height) {
+    ChunkOccluder occluder;
+    for (auto& row : occluder.tileHeight) {
+        std::fill(std::begin(row), std::end(row), static_cast<uint8_t>(height));
+    }
+    return occluder;
+}
+
+OcclusionCuller::Candidate chunkCandidate(const glm::ivec2& chunkPos, float minY, float maxY) {
+    glm::vec3 min(chunkPos.x * CHUNK_SIZE - 0.5f, minY, chunkPos.y * CHUNK_SIZE - 0.5f);
+    glm::vec3 max(min.x + CHUNK_SIZE, maxY, min.z + CHUNK_SIZE);
+    return {chunkPos, min, max};
+}
+
+bool isChunkVisible(const OcclusionCuller& culler, const glm::ivec2& chunkPos, int top) {
+    OcclusionCuller::Candidate candidate = chunkCandidate(chunkPos, -0.5f, top - 0.5f);
+    return culler.isBoxVisible(candidate.min, candidate.max);
+}
+
+void checkScenes() {
+    std::cout << "Known scenes:" << std::endl;
+    const glm::vec3 eye(8.0f, 30.0f, 8.0f);
+    const glm::vec3 forward(1.0f, 0.0f, 0.0f);
+    OcclusionCuller culler;
+
+    // Nothing rasterized - nothing hidden
+    culler.beginFrame(viewProjection(eye, forward), eye);
+    check(isChunkVisible(culler, glm::ivec2(5, 0), 60), "no occluders: a chunk ahead is visible");
+
+    // A wall two chunks ahead, taller than the camera and taller than the screen
+    culler.beginFrame(viewProjection(eye, forward), eye);
+    culler.addOccluder(glm::ivec2(2, 0), solidTo(60));
+    check(culler.getOccluderQuads() > 0, "wall: occluder quads rasterized");
+    check(!isChunkVisible(culler, glm::ivec2(5, 0), 60), "wall: the chunk straight behind it is hidden");
+    check(isChunkVisible(culler, glm::ivec2(1, 0), 60), "wall: a chunk in front of it is visible");
+    check(isChunkVisible(culler, glm::ivec2(2, 0), 60), "wall: the wall's own chunk is visible");
+    check(isChunkVisible(culler, glm::ivec2(5, 2), 60), "wall: a chunk half past its edge is visible");
+    check(isChunkVisible(culler, glm::ivec2(5, 3), 60), "wall: a chunk to the side is visible");
+    check(isChunkVisible(culler, glm::ivec2(0, 0), 60), "wall: a box around the camera is visible");
+
+    // The wall's near face is 23.5 blocks away - nothing in the buffer may be nearer
+    const std::vector<float>& depth = culler.getDepthBuffer();
+    float nearest = *std::max_element(depth.begin(), depth.end());
+    check(nearest > 0.0f && nearest <= 1.0f / 23.5f + 1e-6f, "wall: stored depth never nearer than the wall");
+
+    // A ridge lower than the camera hides low ground behind it, not tall terrain
+    culler.beginFrame(viewProjection(eye, forward), eye);
+    culler.addOccluder(glm::ivec2(2, 0), solidTo(20));
+    check(!isChunkVisible(culler, glm::ivec2(5, 0), 4), "ridge: low ground behind it is hidden");
+    check(isChunkVisible(culler, glm::ivec2(5, 0), 60), "ridge: a mountain behind it is visible");
+
+    // Looking away, the wall is behind the camera and clipped away entirely
+    culler.beginFrame(viewProjection(eye, -forward), eye);
+    culler.addOccluder(glm::ivec2(2, 0), solidTo(60));
+    check(isChunkVisible(culler, glm::ivec2(-3, 0), 60), "behind the camera: occluders hide nothing ahead");
+
+    // Standing inside the occluder's chunk, near-plane clipping keeps what's in front
+    const glm::vec3 inside(40.0f, 70.0f, 8.0f);
+    const glm::vec3 down = glm::normalize(glm::vec3(1.0f, -0.4f, 0.0f));
+    culler.beginFrame(viewProjection(inside, down), inside);
+    culler.addOccluder(glm::ivec2(2, 0), solidTo(60));
+    culler.addOccluder(glm::ivec2(3, 0), solidTo(60));
+    check(!isChunkVisible(culler, glm::ivec2(5, 0), 40), "clipped: a hollow below the plateau is hidden");
+    check(isChunkVisible(culler, glm::ivec2(5, 0), 64), "clipped: a peak above the plateau is visible");
+}
+
+void checkExtraction() {
+    std::cout << "Occluder extraction:" << std::endl;
+    std::vector<BlockType> blocks(CHUNK_SIZE * CHUNK_SIZE * CHUNK_HEIGHT, BlockType::AIR);
+    auto set = [&](int x, int y, int z, BlockType type) {
+        blocks[x + z * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE] = type;
+    };
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            for (int y = 0; y < 20; ++y) set(x, y, z, BlockType::STONE);
+        }
+    }
+    set(1, 5, 1, BlockType::AIR);            // Cave pocket in tile (0, 0)
+    set(6, 19, 6, BlockType::WATER);         // Pool in tile (1, 1)
+    set(13, 30, 13, BlockType::LEAVES);      // Floating leaves over tile (3, 3)
+
+    Chunk chunk(glm::ivec2(0, 0), nullptr, false);
+    chunk.loadBlockData(std::move(blocks));
+    ChunkMeshData meshData;
+    chunk.buildMeshData(meshData);
+    const ChunkOccluder& occluder = meshData.occluder;
+
+    check(occluder.tileHeight[0][0] == 5, "a cave lowers its tile to the pocket");
+    check(occluder.tileHeight[1][1] == 19, "water doesn't occlude");
+    check(occluder.tileHeight[3][3] == 20 && occluder.tileHeight[2][0] == 20, "solid tiles reach the surface");
+    check(meshData.minY == -0.5f && meshData.maxY == 31.5f, "mesh bounds cover the highest block, leaves included");
+}
+
+void checkWorker() {
+    std::cout << "Worker thread:" << std::endl;
+    OcclusionCuller::Frame frame;
+    frame.cameraPos = glm::vec3(8.0f, 30.0f, 8.0f);
+    frame.cameraForward = glm::vec3(1.0f, 0.0f, 0.0f);
+    frame.viewProjection = viewProjection(frame.cameraPos, frame.cameraForward);
+    frame.occluders.push_back({glm::ivec2(2, 0), solidTo(60)});
+    for (int z = -3; z <= 3; ++z) {
+        frame.candidates.push_back(chunkCandidate(glm::ivec2(5, z), -0.5f, 59.5f));
+    }
+
+    OcclusionCuller synchronous;
+    OcclusionCuller::Result expected;
+    synchronous.run(frame, expected);
+
+    OcclusionCuller culler;
+    OcclusionCuller::Result result;
+    check(!culler.takeResult(result), "no result before anything is submitted");
+    culler.submit(OcclusionCuller::Frame(frame));
+    bool finished = false;
+    for (int wait = 0; wait < 2000 && !finished; ++wait) {
+        finished = culler.takeResult(result);
+        if (!finished) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    check(finished, "the worker finishes a submitted frame");
+    check(result.hidden == expected.hidden && result.tested == expected.tested,
+          "the worker hides the same chunks as the synchronous pass");
+    check(result.isValidFor(frame.cameraPos, frame.cameraForward), "a result is valid where it was made");
+    check(!result.isValidFor(frame.cameraPos + glm::vec3(3.0f, 0.0f, 0.0f), frame.cameraForward),
+          "a result is stale once the camera moves");
+    check(!result.isValidFor(frame.cameraPos, glm::vec3(0.0f, 0.0f, 1.0f)), "a result is stale once the camera turns");
+}
+
+// Voxel view of the generated chunks, for ray casts
+struct TestWorld {
+    std::unordered_map<glm::ivec2, std::vector<BlockType>, ChunkPositionHash> blocks;
+
+    bool isSeeThrough(int x, int y, int z) const {
+        if (y < 0 || y >= CHUNK_HEIGHT) return true;
+        int chunkX = static_cast<int>(std::floor(x / static_cast<float>(CHUNK_SIZE)));
+        int chunkZ = static_cast<int>(std::floor(z / static_cast<float>(CHUNK_SIZE)));
+        auto it = blocks.find(glm::ivec2(chunkX, chunkZ));
+        if (it == blocks.end()) return true;
+        int localX = x - chunkX * CHUNK_SIZE, localZ = z - chunkZ * CHUNK_SIZE;
+        return SectionVisibility::isSeeThrough(it->second[localX + localZ * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE]);
+    }
+
+    // Walks the voxels between the two points (blocks are centred on their coordinates) - true if no opaque block is in the way
+    bool canSee(const glm::vec3& from, const glm::vec3& to) const {
+        glm::vec3 delta = to - from;
+        float length = glm::length(delta);
+        int steps = static_cast<int>(length * 4.0f);
+        for (int i = 1; i < steps; ++i) {
+            glm::vec3 point = from + delta * (static_cast<float>(i) / steps);
+            if (!isSeeThrough(static_cast<int>(std::floor(point.x + 0.5f)), static_cast<int>(std::floor(point.y + 0.5f)),
+                              static_cast<int>(std::floor(point.z + 0.5f)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// The steepest relief in a coarse scan - the generator has no real mountains,
+// so a valley between its highest hills stands in for them
+glm::ivec2 findHilliestChunk(const ModularWorldGenerator& generator) {
+    int bestRelief = -1;
+    glm::ivec2 best(0, 0);
+    for (int centerZ = -3000; centerZ <= 3000; centerZ += 64) {
+        for (int centerX = -3000; centerX <= 3000; centerX += 64) {
+            int low = CHUNK_HEIGHT, high = 0;
+            for (int dz = -64; dz <= 64; dz += 16) {
+                for (int dx = -64; dx <= 64; dx += 16) {
+                    int height = generator.getTerrainHeight(centerX + dx, centerZ + dz);
+                    low = std::min(low, height);
+                    high = std::max(high, height);
+                }
+            }
+            if (high - low > bestRelief) {
+                bestRelief = high - low;
+                best = glm::ivec2(centerX / CHUNK_SIZE, centerZ / CHUNK_SIZE);
+            }
+        }
+    }
+    return best;
+}
+
+void benchmarkGenerated(const char* name, ModularWorldGenerator& generator, const glm::ivec2& center) {
+    const int radius = 12;
+    const float occluderDistance = 4.0f;
+    const float minDistance = 2.0f;
+
+    TestWorld world;
+    std::unordered_map<glm::ivec2, ChunkOccluder, ChunkPositionHash> occluders;
+    std::unordered_map<glm::ivec2, glm::vec2, ChunkPositionHash> bounds;  // Mesh min and max Y
+    double extractMs = 0.0;
+    std::mutex resultMutex;
+    std::vector<glm::ivec2> positions = chunksBetween(center - glm::ivec2(radius), center + glm::ivec2(radius));
+    forEachGeneratedChunk(generator, positions, [&](size_t i, Chunk& chunk) {
+        ChunkMeshData meshData;
+        Utils::Timer timer;
+        chunk.buildMeshData(meshData);
+        double elapsed = timer.elapsedMs();
+        std::lock_guard<std::mutex> lock(resultMutex);
+        extractMs += elapsed;
+        occluders[positions[i]] = meshData.occluder;
+        bounds[positions[i]] = glm::vec2(meshData.minY, meshData.maxY);
+        world.blocks[positions[i]] = chunk.getBlockData();
+    });
+
+    // Stand at the lowest ground of the centre chunk, at eye height
+    glm::ivec2 low(center.x * CHUNK_SIZE, center.y * CHUNK_SIZE);
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            glm::ivec2 column(center.x * CHUNK_SIZE + x, center.y * CHUNK_SIZE + z);
+            if (generator.getTerrainHeight(column.x, column.y) < generator.getTerrainHeight(low.x, low.y)) {
+                low = column;
+            }
+        }
+    }
+    const glm::vec3 eye(static_cast<float>(low.x), generator.getTerrainHeight(low.x, low.y) + 2.1f, static_cast<float>(low.y));
+    std::cout << "Generated terrain, " << name << " (radius " << radius << ", eye at " << eye.x << ", " << eye.y
+              << ", " << eye.z << "), mesh build with occluder " << extractMs / ((2 * radius + 1) * (2 * radius + 1))
+              << " ms per chunk:" << std::endl;
+
+    int falseCulls = 0;
+    int hidden = 0, tested = 0;
+    OcclusionCuller culler;
+
+    for (int view = 0; view < 8; ++view) {
+        float yaw = glm::radians(45.0f * view);
+        glm::vec3 forward = glm::normalize(glm::vec3(std::cos(yaw), -0.1f, std::sin(yaw)));
+
+        // Same selection as the world: near chunks occlude, further ones are tested
+        OcclusionCuller::Frame frame;
+        frame.viewProjection = viewProjection(eye, forward);
+        frame.cameraPos = eye;
+        frame.cameraForward = forward;
+        Frustum frustum;
+        frustum.updateFromViewProjection(frame.viewProjection);
+        for (const auto& [chunkPos, occluder] : occluders) {
+            glm::vec3 min(static_cast<float>(chunkPos.x * CHUNK_SIZE), 0.0f, static_cast<float>(chunkPos.y * CHUNK_SIZE));
+            if (!frustum.isChunkVisible(min, min + glm::vec3(static_cast<float>(CHUNK_SIZE), static_cast<float>(CHUNK_HEIGHT),
+                                                             static_cast<float>(CHUNK_SIZE)))) continue;
+            float distance = glm::length(glm::vec2(static_cast<float>(chunkPos.x - center.x),
+                                                   static_cast<float>(chunkPos.y - center.y)));
+            if (distance <= occluderDistance) frame.occluders.push_back({chunkPos, occluder});
+            if (distance >= minDistance) {
+                frame.candidates.push_back(chunkCandidate(chunkPos, bounds[chunkPos].x, bounds[chunkPos].y));
+            }
+        }
+
+        const int runs = 20;
+        OcclusionCuller::Result result;
+        Utils::Timer timer;
+        for (int run = 0; run < runs; ++run) {
+            culler.run(frame, result);
+        }
+        double passMs = timer.elapsedMs() / runs;
+        hidden += static_cast<int>(result.hidden.size());
+        tested += result.tested;
+
+        // Every hidden chunk: no ray from the eye reaches the top of any of its columns
+        for (const glm::ivec2& chunkPos : result.hidden) {
+            const std::vector<BlockType>& blocks = world.blocks[chunkPos];
+            for (int x = 0; x < CHUNK_SIZE; ++x) {
+                for (int z = 0; z < CHUNK_SIZE; ++z) {
+                    int top = CHUNK_HEIGHT;
+                    while (top > 0 && blocks[x + z * CHUNK_SIZE + (top - 1) * CHUNK_SIZE * CHUNK_SIZE] == BlockType::AIR) {
+                        top--;
+                    }
+                    glm::vec3 point(static_cast<float>(chunkPos.x * CHUNK_SIZE + x), top - 0.49f,
+                                    static_cast<float>(chunkPos.y * CHUNK_SIZE + z));
+                    glm::vec4 clip = frame.viewProjection * glm::vec4(point, 1.0f);
+                    if (clip.w <= 0.0f || std::abs(clip.x) > clip.w || std::abs(clip.y) > clip.w) continue;
+                    if (world.canSee(eye, point)) falseCulls++;
+                }
+            }
+        }
+
+        std::cout << "  Yaw " << 45 * view << ": " << result.hidden.size() << " / " << result.tested
+                  << " chunks hidden, " << result.occluderQuads << " occluder quads from " << frame.occluders.size()
+                  << " chunks, " << passMs << " ms per pass" << std::endl;
+    }
+    std::cout << "  Total: " << hidden << " / " << tested << " tested chunks hidden" << std::endl;
+    check(falseCulls == 0, std::string(name) + ": no hidden chunk has a column top in sight (" +
+          std::to_string(falseCulls) + " rays got through)");
+}
+
+} // namespace
+
+int main() {
+    checkScenes();
+    checkExtraction();
+    checkWorker();
+
+    auto generator = loadGenerator();
+    benchmarkGenerated("spawn", *generator, glm::ivec2(0, 0));
+    benchmarkGenerated("hilliest valley", *generator, findHilliestChunk(*generator));
+
+    return finishChecks();
+}
@@ -0,0 +1,376 @@
+/**
+ * Occupancy Benchmark - ChunkOccupancy bits, empty-space skipping and bitwise faces
+ *
+ * Checks a chunk's ChunkOccupancy against its blocks after generation, after
+ * random setBlock edits (exact) and after setBlockFast edits (exact columns,
+ * conservative mips). Then traces eye-height rays, long level rays and rays
+ * from above the world with VoxelRaycaster, which jumps over empty space, and
+ * with the plain block-by-block walk it replaced, checks they hit the same
+ * blocks and reports rays/s for both. Last, counts exposed faces with one neighbour read per face and with
+ * bitwise ops on whole columns, checks the counts agree, and checks
+ * buildMeshData still builds the per-block mesher's exact bytes, timing it.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: occupancy_benchmark [rays]   (default: 100000)
+ */
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include "world/ModularWorldGenerator.h"
+#include "world/VoxelRaycaster.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Ray = VoxelRaycaster::Ray;
+
+bool isKind(ChunkOccupancy::Kind kind, BlockType type) {
+    switch (kind) {
+        case ChunkOccupancy::FILLED: return type != BlockType::AIR;
+        case ChunkOccupancy::SOLID: return type != BlockType::AIR && type != BlockType::WATER;
+        default: return !SectionVisibility::isSeeThrough(type);
+    }
+}
+
+// Blocks whose column bits are wrong, plus sections whose mips are wrong:
+// any mip that doesn't match counts when exact, only one that claims too much when not
+int countMismatches(const Chunk& chunk, bool exactMips) {
+    const ChunkOccupancy& occupancy = *chunk.getOccupancy();
+    int wrong = 0;
+    for (int kind = 0; kind < ChunkOccupancy::KIND_COUNT; ++kind) {
+        for (int x = 0; x < CHUNK_SIZE; ++x) {
+            for (int z = 0; z < CHUNK_SIZE; ++z) {
+                std::uint64_t column = occupancy.getColumn(static_cast<ChunkOccupancy::Kind>(kind), x, z);
+                for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+                    bool expected = isKind(static_cast<ChunkOccupancy::Kind>(kind), chunk.getBlockFast(x, y, z));
+                    if (((column >> y & 1) != 0) != expected) wrong++;
+                }
+            }
+        }
+    }
+
+    const int sectionSize = SectionVisibility::SIZE;
+    const int volume = CHUNK_SIZE * CHUNK_SIZE * sectionSize;
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        int filled = 0;
+        for (int x = 0; x < CHUNK_SIZE; ++x)
+            for (int y = section * sectionSize; y < (section + 1) * sectionSize; ++y)
+                for (int z = 0; z < CHUNK_SIZE; ++z) filled += chunk.getBlockFast(x, y, z) != BlockType::AIR ? 1 : 0;
+        bool empty = occupancy.isSectionEmpty(section), full = occupancy.isSectionFull(section);
+        bool mipWrong = exactMips ? empty != (filled == 0) || full != (filled == volume)
+                                  : (empty && filled > 0) || (full && filled < volume);
+        if (mipWrong) wrong++;
+    }
+    return wrong;
+}
+
+void checkOccupancy(ModularWorldGenerator* generator) {
+    std::cout << "Occupancy bits:" << std::endl;
+    const BlockType palette[] = {BlockType::AIR, BlockType::STONE, BlockType::WATER, BlockType::LEAVES,
+                                 BlockType::GRASS, BlockType::AIR, BlockType::AIR};
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> across(0, CHUNK_SIZE - 1), height(0, CHUNK_HEIGHT - 1);
+    std::uniform_int_distribution<int> pick(0, static_cast<int>(sizeof(palette) / sizeof(palette[0])) - 1);
+
+    int generated = 0, edited = 0, fast = 0;
+    for (int i = 0; i < 4; ++i) {
+        Chunk chunk(glm::ivec2(i * 3 - 5, 2 - i), generator, false);
+        chunk.generateTerrainOnly();
+        generated += countMismatches(chunk, true);
+
+        for (int edit = 0; edit < 2000; ++edit) {
+            chunk.setBlock(across(rng), height(rng), across(rng), palette[pick(rng)]);
+        }
+        // Empty a whole section too, which is where its mip must notice
+        for (int x = 0; x < CHUNK_SIZE; ++x)
+            for (int y = 48; y < CHUNK_HEIGHT; ++y)
+                for (int z = 0; z < CHUNK_SIZE; ++z) chunk.setBlock(x, y, z, BlockType::AIR);
+        edited += countMismatches(chunk, true);
+
+        for (int edit = 0; edit < 2000; ++edit) {
+            chunk.setBlockFast(across(rng), height(rng), across(rng), palette[pick(rng)]);
+        }
+        fast += countMismatches(chunk, false);
+    }
+    check(generated == 0, "generated chunks: exact columns and mips (" + std::to_string(generated) + " wrong)");
+    check(edited == 0, "after setBlock edits: exact columns and mips (" + std::to_string(edited) + " wrong)");
+    check(fast == 0, "after setBlockFast edits: exact columns, mips never claim too much (" +
+                         std::to_string(fast) + " wrong)");
+}
+
+// The walk VoxelRaycaster ran before empty-space skipping: one block read per block
+RaycastHit plainTrace(ChunkView& view, const glm::vec3& origin, const glm::vec3& direction, float maxDistance) {
+    RaycastHit result;
+    glm::vec3 rayDir = glm::normalize(direction);
+    const float EPSILON = 1e-6f;
+    if (std::abs(rayDir.x) < EPSILON) rayDir.x = (rayDir.x > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.y) < EPSILON) rayDir.y = (rayDir.y > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.z) < EPSILON) rayDir.z = (rayDir.z > 0) ? EPSILON : -EPSILON;
+
+    const glm::vec3 start = origin + 0.5f;
+    glm::ivec3 voxel(glm::floor(start));
+    const glm::ivec3 stepDir(rayDir.x >= 0.0f ? 1 : -1, rayDir.y >= 0.0f ? 1 : -1, rayDir.z >= 0.0f ? 1 : -1);
+    const glm::vec3 deltaDist(std::abs(1.0f / rayDir.x), std::abs(1.0f / rayDir.y), std::abs(1.0f / rayDir.z));
+    glm::vec3 sideDist((voxel.x + (stepDir.x > 0 ? 1.0f : 0.0f) - start.x) / rayDir.x,
+                       (voxel.y + (stepDir.y > 0 ? 1.0f : 0.0f) - start.y) / rayDir.y,
+                       (voxel.z + (stepDir.z > 0 ? 1.0f : 0.0f) - start.z) / rayDir.z);
+
+    auto blocksAt = [&view](int x, int z) -> const BlockType* {
+        const Chunk* chunk = view.getChunkAt(x, z);
+        return chunk ? chunk->getBlockData().data() : nullptr;
+    };
+    const int enterX = stepDir.x > 0 ? 0 : CHUNK_SIZE - 1;
+    const int enterZ = stepDir.z > 0 ? 0 : CHUNK_SIZE - 1;
+    const BlockType* blocks = blocksAt(voxel.x, voxel.z);
+
+    float t = 0.0f;
+    glm::ivec3 normal(0);
+    while (blocks && t < maxDistance) {
+        if (voxel.y >= 0 && voxel.y < CHUNK_HEIGHT) {
+            BlockType type = blocks[(voxel.x & (CHUNK_SIZE - 1)) + (voxel.z & (CHUNK_SIZE - 1)) * CHUNK_SIZE +
+                                    voxel.y * CHUNK_SIZE * CHUNK_SIZE];
+            if (type != BlockType::AIR && t > 0.0f) {
+                result.hit = true;
+                result.blockPos = voxel;
+                result.hitPoint = origin + t * rayDir;
+                result.normal = normal;
+                result.blockType = type;
+                return result;
+            }
+        } else if ((voxel.y < 0) == (stepDir.y < 0)) {
+            break;
+        }
+
+        if (sideDist.x < sideDist.y && sideDist.x < sideDist.z) {
+            t = sideDist.x; sideDist.x += deltaDist.x; voxel.x += stepDir.x;
+            normal = glm::ivec3(-stepDir.x, 0, 0);
+            if ((voxel.x & (CHUNK_SIZE - 1)) == enterX) blocks = blocksAt(voxel.x, voxel.z);
+        } else if (sideDist.y < sideDist.z) {
+            t = sideDist.y; sideDist.y += deltaDist.y; voxel.y += stepDir.y;
+            normal = glm::ivec3(0, -stepDir.y, 0);
+        } else {
+            t = sideDist.z; sideDist.z += deltaDist.z; voxel.z += stepDir.z;
+            normal = glm::ivec3(0, 0, -stepDir.z);
+            if ((voxel.z & (CHUNK_SIZE - 1)) == enterZ) blocks = blocksAt(voxel.x, voxel.z);
+        }
+    }
+    return result;
+}
+
+int surfaceAt(const ChunkMap& chunks, int x, int z) {
+    const Chunk* chunk = chunks.at(glm::ivec2(x >> 4, z >> 4)).get();
+    std::uint64_t filled = chunk->getOccupancy()->getColumn(ChunkOccupancy::FILLED, x & 15, z & 15);
+    return filled ? 63 - __builtin_clzll(filled) : 0;
+}
+
+enum class Source {
+    EYE,     // Player eye height, every direction
+    LOW,     // 2-12 blocks over the ground, close to level
+    ABOVE    // Over the top of the world, looking down
+};
+
+std::vector<Ray> makeRays(const ChunkMap& chunks, float extent, int count, float maxDistance, Source source,
+                          std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> across(-extent, extent), lift(2.0f, 12.0f), high(80.0f, 140.0f);
+    std::normal_distribution<float> gaussian;
+
+    std::vector<Ray> rays;
+    rays.reserve(count);
+    while (static_cast<int>(rays.size()) < count) {
+        glm::vec3 origin(across(rng), 0.0f, across(rng));
+        glm::ivec3 column(glm::floor(origin + 0.5f));
+        float surface = surfaceAt(chunks, column.x, column.z) + 0.5f;  // Top face
+        glm::vec3 direction(gaussian(rng), gaussian(rng), gaussian(rng));
+        if (source == Source::EYE) {
+            origin.y = surface + 1.62f;
+        } else if (source == Source::LOW) {
+            origin.y = surface + lift(rng);
+            direction.y *= 0.1f;
+        } else {
+            origin.y = high(rng);
+            direction.y = -2.0f - std::abs(direction.y);
+        }
+        if (glm::length(direction) < 1e-3f) continue;
+        rays.push_back({origin, glm::normalize(direction), maxDistance});
+    }
+    return rays;
+}
+
+void benchmarkRays(const ChunkMap& chunks, float extent, int rayCount) {
+    std::cout << "Rays (" << chunks.size() << " chunks):" << std::endl;
+    ChunkView::Lookup lookup = lookupIn(chunks);
+
+    struct Kind {
+        const char* name;
+        float maxDistance;
+        Source source;
+        int count;
+    };
+    const Kind kinds[] = {{"reach", 5.0f, Source::EYE, rayCount},
+                          {"line of sight", 48.0f, Source::EYE, rayCount / 4},
+                          {"low and level", 128.0f, Source::LOW, rayCount / 4},
+                          {"from above", 192.0f, Source::ABOVE, rayCount / 4}};
+    for (const Kind& kind : kinds) {
+        std::vector<Ray> rays = makeRays(chunks, extent, kind.count, kind.maxDistance, kind.source, 42);
+
+        // Best of a few runs, each through a fresh view
+        double plainMs = 1e30, skippingMs = 1e30;
+        std::vector<RaycastHit> plain(rays.size()), skipping;
+        for (int run = 0; run < 3; ++run) {
+            ChunkView plainView(lookup);
+            Utils::Timer plainTimer;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                plain[i] = plainTrace(plainView, rays[i].origin, rays[i].direction, rays[i].maxDistance);
+            }
+            plainMs = std::min(plainMs, plainTimer.elapsedMs());
+
+            ChunkView view(lookup);
+            Utils::Timer skippingTimer;
+            VoxelRaycaster::traceBatch(view, rays, skipping);
+            skippingMs = std::min(skippingMs, skippingTimer.elapsedMs());
+        }
+
+        int hits = 0, differing = 0;
+        for (size_t i = 0; i < rays.size(); ++i) {
+            hits += skipping[i].hit ? 1 : 0;
+            if (skipping[i].hit != plain[i].hit ||
+                (skipping[i].hit && (skipping[i].blockPos != plain[i].blockPos || skipping[i].normal != plain[i].normal ||
+                                     glm::length(skipping[i].hitPoint - plain[i].hitPoint) > 1e-3f))) {
+                differing++;
+            }
+        }
+
+        auto perSecond = [&](double ms) { return static_cast<long long>(rays.size() / (ms / 1000.0)); };
+        std::cout << "  " << kind.name << " rays (" << kind.maxDistance << " blocks, " << rays.size() << " rays, "
+                  << hits << " hit):" << std::endl;
+        std::cout << "    block by block:       " << perSecond(plainMs) << " rays/s" << std::endl;
+        std::cout << "    skipping empty space: " << perSecond(skippingMs) << " rays/s (" << plainMs / skippingMs
+                  << "x)" << std::endl;
+        check(differing == 0, std::string(kind.name) + ": same block and face either way, hit points within 0.001 (" +
+                                  std::to_string(differing) + " differ)");
+    }
+}
+
+// Faces of non-air blocks facing air, one neighbour read per face
+int countExposedPerBlock(const Chunk& chunk) {
+    static const int OFFSETS[6][3] = {{0, 0, 1}, {0, 0, -1}, {-1, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, -1, 0}};
+    int exposed = 0;
+    for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+        for (int z = 0; z < CHUNK_SIZE; ++z) {
+            for (int x = 0; x < CHUNK_SIZE; ++x) {
+                if (chunk.getBlockFast(x, y, z) == BlockType::AIR) continue;
+                for (const auto& offset : OFFSETS) {
+                    int nx = x + offset[0], ny = y + offset[1], nz = z + offset[2];
+                    bool outside = nx < 0 || nx >= CHUNK_SIZE || ny < 0 || ny >= CHUNK_HEIGHT || nz < 0 ||
+                                   nz >= CHUNK_SIZE;
+                    if (outside || chunk.getBlockFast(nx, ny, nz) == BlockType::AIR) exposed++;
+                }
+            }
+        }
+    }
+    return exposed;
+}
+
+// The same count, 64 blocks at a time from the FILLED columns
+int countExposedBitwise(const Chunk& chunk) {
+    const ChunkOccupancy& occupancy = *chunk.getOccupancy();
+    auto filledAt = [&](int x, int z) {
+        return x < 0 || x >= CHUNK_SIZE || z < 0 || z >= CHUNK_SIZE ? 0ull
+                                                                     : occupancy.getColumn(ChunkOccupancy::FILLED, x, z);
+    };
+    int exposed = 0;
+    for (int z = 0; z < CHUNK_SIZE; ++z) {
+        for (int x = 0; x < CHUNK_SIZE; ++x) {
+            std::uint64_t filled = filledAt(x, z);
+            std::uint64_t faces[6] = {filled & ~filledAt(x, z + 1), filled & ~filledAt(x, z - 1),
+                                      filled & ~filledAt(x - 1, z), filled & ~filledAt(x + 1, z),
+                                      filled & ~(filled >> 1), filled & ~(filled << 1)};
+            for (std::uint64_t face : faces) {
+                exposed += __builtin_popcountll(face);
+            }
+        }
+    }
+    return exposed;
+}
+
+void benchmarkMeshing(const ChunkMap& chunks) {
+    std::cout << "Meshing (" << chunks.size() << " chunks):" << std::endl;
+
+    int perBlock = 0, bitwise = 0;
+    Utils::Timer perBlockTimer;
+    for (const auto& entry : chunks) perBlock += countExposedPerBlock(*entry.second);
+    double perBlockMs = perBlockTimer.elapsedMs();
+    Utils::Timer bitwiseTimer;
+    for (const auto& entry : chunks) bitwise += countExposedBitwise(*entry.second);
+    double bitwiseMs = bitwiseTimer.elapsedMs();
+
+    std::cout << "  exposed faces, neighbour reads: " << perBlockMs / chunks.size() << " ms/chunk" << std::endl;
+    std::cout << "  exposed faces, column bits:     " << bitwiseMs / chunks.size() << " ms/chunk ("
+              << perBlockMs / bitwiseMs << "x)" << std::endl;
+    check(perBlock == bitwise, "both find the same " + std::to_string(bitwise) + " exposed faces");
+
+    // Hash of every chunk's mesh; the per-block mesher built the same bytes
+    const std::uint64_t GOLDEN_MESH_HASH = 0x70e8142d0421f271ull;
+    std::vector<const Chunk*> ordered;
+    for (int x = -4; x < 4; ++x) {
+        for (int z = -4; z < 4; ++z) ordered.push_back(chunks.at(glm::ivec2(x, z)).get());
+    }
+    std::uint64_t hash = 0;
+    double bestMs = 1e30;
+    for (int run = 0; run < 3; ++run) {
+        std::uint64_t runHash = 14695981039346656037ull;
+        Utils::Timer timer;
+        for (const Chunk* chunk : ordered) {
+            ChunkMeshData meshData;
+            chunk->buildMeshData(meshData);
+            for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+                for (const Vertex& vertex : meshData.vertices[layer]) {
+                    runHash = Utils::fnv1a64(&vertex, sizeof(float) * 8, runHash);
+                }
+                runHash = Utils::fnv1a64(meshData.indices[layer].data(),
+                                         meshData.indices[layer].size() * sizeof(unsigned int), runHash);
+            }
+            runHash = Utils::fnv1a64(&meshData.occluder, sizeof(meshData.occluder), runHash);
+        }
+        bestMs = std::min(bestMs, timer.elapsedMs());
+        hash = runHash;
+    }
+    std::ostringstream hex;
+    hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+    std::cout << "  buildMeshData: " << bestMs / ordered.size() << " ms/chunk" << std::endl;
+    check(hash == GOLDEN_MESH_HASH, "meshes match the per-block mesher's (hash " + hex.str() + ")");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int rays = argc > 1 ? std::max(10, std::atoi(argv[1])) : 100000;
+
+    auto generator = loadGenerator();
+    checkOccupancy(generator.get());
+
+    // Chunks -4..3 on each side for the mesh hash, out to -8..7 for long rays
+    const int half = 8;
+    ChunkMap chunks = generateChunks(*generator, glm::ivec2(-half, -half), glm::ivec2(half - 1, half - 1));
+    benchmarkRays(chunks, half * CHUNK_SIZE - 4.0f, rays);
+
+    ChunkMap meshed;
+    for (int x = -4; x < 4; ++x) {
+        for (int z = -4; z < 4; ++z) meshed[glm::ivec2(x, z)] = std::move(chunks.at(glm::ivec2(x, z)));
+    }
+    benchmarkMeshing(meshed);
+
+    return finishChecks();
+}
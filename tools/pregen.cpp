@@ -0,0 +1,238 @@
+/**
+ * Pregen - headless world pre-generation
+ *
+ * Generates every chunk within a radius of the origin on all cores, builds
+ * its mesh on the CPU to validate it, and writes the terrain to the region
+ * files the game loads from. No window or GL context is involved, so this
+ * runs on servers.
+ *
+ * Chunks already present in the region files are skipped, so an interrupted
+ * run (Ctrl+C, kill, crash) resumes by running the same command again.
+ * Chunks are processed nearest-first, so a partial run covers the spawn area.
+ *
+ * Usage: pregen <seed> <radius> [directory] [--threads N]
+ */
+#include "world/Chunk.h"
+#include "world/ChunkStorage.h"
+#include "world/ModularWorldGenerator.h"
+#include "world/WorldConfig.h"
+#include "utils/ModernCpp.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<bool> g_interrupted{false};
+
+void onInterrupt(int) {
+    g_interrupted = true;
+}
+
+// Returns an empty string for a sane mesh, otherwise what is wrong with it
+std::string validateMesh(const Chunk& chunk, const ChunkMeshData& meshData) {
+    const glm::vec3 minCorner = chunk.getWorldPosition() - glm::vec3(0.5f);
+    const glm::vec3 maxCorner = chunk.getWorldPosition() + glm::vec3(CHUNK_SIZE, CHUNK_HEIGHT, CHUNK_SIZE) - glm::vec3(0.5f);
+
+    for (int layer = 0; layer < ChunkMeshData::LAYER_COUNT; ++layer) {
+        const auto& vertices = meshData.vertices[layer];
+        const auto& indices = meshData.indices[layer];
+
+        if (vertices.size() % 4 != 0 || indices.size() % 6 != 0 || indices.size() / 6 != vertices.size() / 4) {
+            return "layer " + std::to_string(layer) + " is not made of whole quads";
+        }
+        for (unsigned int index : indices) {
+            if (index >= vertices.size()) {
+                return "layer " + std::to_string(layer) + " has an index out of range";
+            }
+        }
+        for (const auto& vertex : vertices) {
+            const glm::vec3& p = vertex.position;
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z) ||
+                p.x < minCorner.x || p.y < minCorner.y || p.z < minCorner.z ||
+                p.x > maxCorner.x || p.y > maxCorner.y || p.z > maxCorner.z) {
+                return "layer " + std::to_string(layer) + " has a vertex outside the chunk";
+            }
+        }
+    }
+    return "";
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void printTimes(const std::string& label, std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    double total = 0.0;
+    for (double t : times) {
+        total += t;
+    }
+    double mean = times.empty() ? 0.0 : total / times.size();
+
+    std::cout << std::left << std::setw(12) << label << std::right << std::fixed << std::setprecision(2)
+              << "mean " << std::setw(7) << mean
+              << "  p50 " << std::setw(7) << percentile(times, 0.50)
+              << "  p90 " << std::setw(7) << percentile(times, 0.90)
+              << "  p99 " << std::setw(7) << percentile(times, 0.99)
+              << "  max " << std::setw(7) << (times.empty() ? 0.0 : times.back()) << "  ms" << std::endl;
+}
+
+void printUsage() {
+    std::cerr << "Usage: pregen <seed> <radius> [directory] [--threads N]" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> args;
+    int threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threadCount = std::max(1, std::stoi(argv[++i]));
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    if (args.size() < 2) {
+        printUsage();
+        return 1;
+    }
+
+    // Same config as the game, or the generator signature won't match and the game discards the regions
+    g_worldConfig.loadFromFile("world_config.ini");
+    g_worldConfig.terrain.seed = static_cast<unsigned int>(std::stoul(args[0]));
+    int radius = std::stoi(args[1]);
+    std::string directory = args.size() > 2 ? args[2] : g_worldConfig.persistence.worldDirectory;
+
+    auto generator = ModularWorldGenerator::createDefault(g_worldConfig.terrain.seed);
+    ChunkStorage storage(directory, generator->getSignature(), g_worldConfig.persistence.compressionLevel);
+
+    // Nearest chunks first, skipping everything a previous run already wrote
+    std::vector<glm::ivec2> positions;
+    int alreadyDone = 0;
+    for (int x = -radius; x <= radius; ++x) {
+        for (int z = -radius; z <= radius; ++z) {
+            if (storage.hasChunk(glm::ivec2(x, z))) {
+                alreadyDone++;
+            } else {
+                positions.emplace_back(x, z);
+            }
+        }
+    }
+    std::sort(positions.begin(), positions.end(), [](const glm::ivec2& a, const glm::ivec2& b) {
+        return a.x * a.x + a.y * a.y < b.x * b.x + b.y * b.y;
+    });
+
+    std::cout << "Pregen: seed " << g_worldConfig.terrain.seed << ", radius " << radius << " ("
+              << positions.size() + alreadyDone << " chunks) into " << directory << std::endl;
+    if (alreadyDone > 0) {
+        std::cout << "Resuming: " << alreadyDone << " chunks already generated" << std::endl;
+    }
+    std::cout << "Using " << threadCount << " threads" << std::endl;
+
+    std::signal(SIGINT, onInterrupt);
+    std::signal(SIGTERM, onInterrupt);
+
+    std::atomic<size_t> next{0};
+    std::atomic<int> completed{0};
+    std::atomic<int> invalidMeshes{0};
+    std::vector<double> generateTimes;
+    std::vector<double> meshTimes;
+    std::mutex timesMutex;
+
+    auto worker = [&]() {
+        std::vector<double> localGenerate;
+        std::vector<double> localMesh;
+        ChunkMeshData meshData;
+
+        for (size_t i = next++; i < positions.size() && !g_interrupted; i = next++) {
+            Chunk chunk(positions[i], generator.get(), false);
+
+            Utils::Timer generateTimer;
+            chunk.generateTerrainOnly();
+            localGenerate.push_back(generateTimer.elapsedMs());
+
+            Utils::Timer meshTimer;
+            chunk.buildMeshData(meshData);
+            localMesh.push_back(meshTimer.elapsedMs());
+
+            std::string error = validateMesh(chunk, meshData);
+            if (!error.empty()) {
+                // Not saved, so the next run retries it
+                std::cerr << "Pregen: Chunk (" << positions[i].x << ", " << positions[i].y << "): " << error << std::endl;
+                invalidMeshes++;
+                continue;
+            }
+
+            storage.saveChunkAsync(positions[i], chunk.getBlockData());
+            completed++;
+        }
+
+        std::lock_guard<std::mutex> lock(timesMutex);
+        generateTimes.insert(generateTimes.end(), localGenerate.begin(), localGenerate.end());
+        meshTimes.insert(meshTimes.end(), localMesh.begin(), localMesh.end());
+    };
+
+    Utils::Timer totalTimer;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+
+    // Progress once a second until the workers run out of chunks
+    const int total = static_cast<int>(positions.size());
+    while (completed + invalidMeshes < total && !g_interrupted) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        double seconds = totalTimer.elapsedMs() / 1000.0;
+        std::cout << "  " << completed << "/" << total << " chunks, "
+                  << std::fixed << std::setprecision(0) << (seconds > 0.0 ? completed / seconds : 0.0)
+                  << " chunks/s" << std::endl;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    storage.flush();
+    double totalMs = totalTimer.elapsedMs();
+
+    std::cout << "Generated " << completed << " chunks in " << std::fixed << std::setprecision(1)
+              << totalMs / 1000.0 << " s (" << std::setprecision(0)
+              << (totalMs > 0.0 ? completed * 1000.0 / totalMs : 0.0) << " chunks/s)" << std::endl;
+    printTimes("Generation", generateTimes);
+    printTimes("Meshing", meshTimes);
+    
+    // Where generation time goes - features also run for chunks just outside the radius
+    std::cout << "Stages (mean per run):";
+    const char* stageNames[] = {"heightmap", "surface", "features", "finalize"};
+    for (int stage = 0; stage < ModularWorldGenerator::STAGE_COUNT; ++stage) {
+        auto id = static_cast<ModularWorldGenerator::Stage>(stage);
+        uint64_t runs = generator->getStageRuns(id);
+        std::cout << " " << stageNames[stage] << " " << std::setprecision(3)
+                  << (runs > 0 ? generator->getStageTimeMs(id) / runs : 0.0) << " ms";
+    }
+    std::cout << std::endl;
+
+    if (g_interrupted) {
+        std::cout << "Interrupted - run the same command again to resume" << std::endl;
+        return 130;
+    }
+    if (invalidMeshes > 0) {
+        std::cerr << "ERROR: " << invalidMeshes << " chunks produced invalid meshes and were not saved" << std::endl;
+        return 1;
+    }
+    return 0;
+}
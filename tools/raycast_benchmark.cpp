@@ -0,0 +1,264 @@
+/**
+ * Raycast Benchmark - voxel ray walks through locked lookups versus a ChunkView
+ *
+ * Checks VoxelRaycaster on hand-placed blocks (faces, normals, chunk borders,
+ * unseen chunks, rays from above the world), then checks its hits on
+ * generated terrain against a brute-force test of every block near the ray.
+ * Then times reach-length and line-of-sight rays three ways: the old walk with
+ * a locked chunk-map lookup per block, one ChunkView per ray (what
+ * RaycastUtil::raycast does) and one view for a whole batch. Reports rays/s.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: raycast_benchmark [rays]   (default: 200000)
+ */
+#include "world/Chunk.h"
+#include "world/ChunkView.h"
+#include "world/VoxelRaycaster.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Ray = VoxelRaycaster::Ray;
+
+// World::getBlock as it stands: lock the map, find the chunk, read the block
+struct LockedWorld {
+    const ChunkMap* chunks;
+    mutable std::mutex mutex;
+
+    BlockType getBlock(int x, int y, int z) const {
+        if (y < 0 || y >= CHUNK_HEIGHT) return BlockType::AIR;
+        glm::ivec2 chunkPos(x >> 4, z >> 4);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = chunks->find(chunkPos);
+        return it != chunks->end() ? it->second->getBlock(x & (CHUNK_SIZE - 1), y, z & (CHUNK_SIZE - 1)) : BlockType::AIR;
+    }
+};
+
+// The DDA RaycastUtil ran before, one locked lookup per block
+bool legacyRaycast(const LockedWorld& world, const glm::vec3& rayStart, const glm::vec3& direction, float maxDistance) {
+    glm::vec3 rayDir = glm::normalize(direction);
+    const float EPSILON = 1e-6f;
+    if (std::abs(rayDir.x) < EPSILON) rayDir.x = (rayDir.x > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.y) < EPSILON) rayDir.y = (rayDir.y > 0) ? EPSILON : -EPSILON;
+    if (std::abs(rayDir.z) < EPSILON) rayDir.z = (rayDir.z > 0) ? EPSILON : -EPSILON;
+
+    glm::ivec3 voxel(glm::floor(rayStart));
+    glm::ivec3 stepDir(rayDir.x >= 0.0f ? 1 : -1, rayDir.y >= 0.0f ? 1 : -1, rayDir.z >= 0.0f ? 1 : -1);
+    glm::vec3 deltaDist = glm::abs(1.0f / rayDir);
+    glm::vec3 sideDist((voxel.x + (stepDir.x > 0 ? 1.0f : 0.0f) - rayStart.x) / rayDir.x,
+                       (voxel.y + (stepDir.y > 0 ? 1.0f : 0.0f) - rayStart.y) / rayDir.y,
+                       (voxel.z + (stepDir.z > 0 ? 1.0f : 0.0f) - rayStart.z) / rayDir.z);
+
+    float t = 0.0f;
+    const int maxSteps = static_cast<int>(maxDistance * 2.0f + 1);
+    for (int step = 0; step < maxSteps && t < maxDistance; ++step) {
+        if (voxel.y < 0 || voxel.y >= CHUNK_HEIGHT) break;
+        if (world.getBlock(voxel.x, voxel.y, voxel.z) != BlockType::AIR && t > 0.01f) return true;
+        if (sideDist.x < sideDist.y && sideDist.x < sideDist.z) {
+            t = sideDist.x; sideDist.x += deltaDist.x; voxel.x += stepDir.x;
+        } else if (sideDist.y < sideDist.z) {
+            t = sideDist.y; sideDist.y += deltaDist.y; voxel.y += stepDir.y;
+        } else {
+            t = sideDist.z; sideDist.z += deltaDist.z; voxel.z += stepDir.z;
+        }
+    }
+    return false;
+}
+
+// Distance at which a ray enters a block's box, or a negative value if it misses
+float enterBlock(const glm::vec3& origin, const glm::vec3& rayDir, const glm::ivec3& block) {
+    glm::vec3 low = (glm::vec3(block) - 0.5f - origin) / rayDir;
+    glm::vec3 high = (glm::vec3(block) + 0.5f - origin) / rayDir;
+    glm::vec3 nearT = glm::min(low, high), farT = glm::max(low, high);
+    float enter = std::max(std::max(nearT.x, nearT.y), nearT.z);
+    float leave = std::min(std::min(farT.x, farT.y), farT.z);
+    return enter <= leave && leave > 0.0f ? enter : -1.0f;
+}
+
+// Whether the walk's answer matches testing every block around the ray's segment
+bool matchesBruteForce(ChunkView& view, const Ray& ray, const RaycastHit& hit) {
+    glm::vec3 rayDir = glm::normalize(ray.direction);
+    float end = hit.hit ? glm::length(hit.hitPoint - ray.origin) : ray.maxDistance;
+    glm::ivec3 start(glm::floor(ray.origin + 0.5f));
+    glm::ivec3 low(glm::floor(glm::min(ray.origin, ray.origin + rayDir * end) + 0.5f));
+    glm::ivec3 high(glm::floor(glm::max(ray.origin, ray.origin + rayDir * end) + 0.5f));
+
+    // Slack for blocks the ray only grazes at an edge
+    const float SLACK = 1e-3f;
+    for (int x = low.x; x <= high.x; ++x) {
+        for (int y = std::max(low.y, 0); y <= std::min(high.y, CHUNK_HEIGHT - 1); ++y) {
+            for (int z = low.z; z <= high.z; ++z) {
+                glm::ivec3 block(x, y, z);
+                BlockType type = BlockType::AIR;
+                if (block == start || !view.getBlock(x, y, z, type) || type == BlockType::AIR) continue;
+                float enter = enterBlock(ray.origin, rayDir, block);
+                if (enter >= 0.0f && enter < end - SLACK) return false;  // Walked past a block
+            }
+        }
+    }
+    if (!hit.hit) return true;
+    BlockType type = BlockType::AIR;
+    view.getBlock(hit.blockPos.x, hit.blockPos.y, hit.blockPos.z, type);
+    float enter = enterBlock(ray.origin, rayDir, hit.blockPos);
+    return type == hit.blockType && type != BlockType::AIR && std::abs(enter - end) < SLACK;
+}
+
+void checkPlacedBlocks() {
+    std::cout << "Placed blocks:" << std::endl;
+    ChunkMap chunks;
+    for (int x = -1; x <= 1; ++x) {
+        for (int z = -1; z <= 1; ++z) {
+            chunks[glm::ivec2(x, z)] = std::make_unique<Chunk>(glm::ivec2(x, z), nullptr, false);
+        }
+    }
+    auto set = [&](int x, int y, int z, BlockType type) {
+        chunks.at(glm::ivec2(x >> 4, z >> 4))->setBlockFast(x & (CHUNK_SIZE - 1), y, z & (CHUNK_SIZE - 1), type);
+    };
+    set(3, 10, 3, BlockType::STONE);
+    set(16, 20, 5, BlockType::DIRT);     // First block of the +x chunk
+    set(-1, 20, 5, BlockType::SAND);     // Last block of the -x chunk
+    set(8, 0, 8, BlockType::GRASS);      // Bottom of the world
+    ChunkView view(lookupIn(chunks));
+
+    RaycastHit hit = VoxelRaycaster::trace(view, glm::vec3(3.2f, 14.0f, 2.9f), glm::vec3(0.0f, -1.0f, 0.0f), 10.0f);
+    check(hit.hit && hit.blockPos == glm::ivec3(3, 10, 3) && hit.blockType == BlockType::STONE,
+          "a ray down hits the block under it");
+    check(std::abs(hit.hitPoint.y - 10.5f) < 1e-4f && hit.normal == glm::ivec3(0, 1, 0),
+          "it enters through the top face, half a block above the block's centre");
+
+    hit = VoxelRaycaster::trace(view, glm::vec3(3.2f, 14.0f, 2.9f), glm::vec3(0.0f, -1.0f, 0.0f), 3.4f);
+    check(!hit.hit, "a block beyond the ray's reach isn't hit");
+
+    hit = VoxelRaycaster::trace(view, glm::vec3(3.0f, 10.2f, 3.0f), glm::vec3(0.0f, -1.0f, 0.0f), 5.0f);
+    check(!hit.hit, "the block a ray starts in is skipped");
+
+    hit = VoxelRaycaster::trace(view, glm::vec3(10.0f, 20.0f, 5.0f), glm::vec3(1.0f, 0.0f, 0.0f), 20.0f);
+    check(hit.hit && hit.blockPos == glm::ivec3(16, 20, 5) && hit.normal == glm::ivec3(-1, 0, 0),
+          "a ray in +x finds a block across the chunk border");
+    hit = VoxelRaycaster::trace(view, glm::vec3(10.0f, 20.0f, 5.0f), glm::vec3(-1.0f, 0.0f, 0.0f), 20.0f);
+    check(hit.hit && hit.blockPos == glm::ivec3(-1, 20, 5) && hit.normal == glm::ivec3(1, 0, 0),
+          "a ray in -x finds a block across the chunk border");
+
+    hit = VoxelRaycaster::trace(view, glm::vec3(8.0f, CHUNK_HEIGHT + 20.0f, 8.0f), glm::vec3(0.0f, -1.0f, 0.0f), 200.0f);
+    check(hit.hit && hit.blockPos == glm::ivec3(8, 0, 8), "a ray from above the world comes down into it");
+
+    hit = VoxelRaycaster::trace(view, glm::vec3(20.0f, 30.0f, 5.0f), glm::vec3(1.0f, 0.0f, 0.0f), 100.0f);
+    check(!hit.hit, "a ray into a chunk that isn't there ends without a hit");
+
+    std::vector<Ray> rays = {{glm::vec3(10.0f, 20.0f, 5.0f), glm::vec3(1.0f, 0.0f, 0.0f), 20.0f},
+                             {glm::vec3(3.2f, 14.0f, 2.9f), glm::vec3(0.0f, -1.0f, 0.0f), 10.0f},
+                             {glm::vec3(3.2f, 14.0f, 2.9f), glm::vec3(0.0f, 1.0f, 0.0f), 10.0f}};
+    std::vector<RaycastHit> hits;
+    VoxelRaycaster::traceBatch(view, rays, hits);
+    check(hits.size() == 3 && hits[0].blockPos == glm::ivec3(16, 20, 5) && hits[1].blockPos == glm::ivec3(3, 10, 3) &&
+          !hits[2].hit, "a batch gives one result per ray, in order");
+}
+
+// Eye-height rays in every direction from the surface, and longer sight lines
+std::vector<Ray> makeRays(const ChunkMap& chunks, int chunkSide, int count, float maxDistance, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> across(4.0f, chunkSide * CHUNK_SIZE - 4.0f);
+    std::normal_distribution<float> gaussian;
+
+    std::vector<Ray> rays;
+    rays.reserve(count);
+    while (static_cast<int>(rays.size()) < count) {
+        glm::vec3 origin(across(rng), 0.0f, across(rng));
+        glm::ivec3 column(glm::floor(origin + 0.5f));
+        const Chunk* chunk = chunks.at(glm::ivec2(column.x >> 4, column.z >> 4)).get();
+        int surface = CHUNK_HEIGHT - 1;
+        while (surface > 0 && chunk->getBlockFast(column.x & 15, surface, column.z & 15) == BlockType::AIR) {
+            surface--;
+        }
+        origin.y = surface + 0.5f + 1.62f;  // Player eye height over the top face
+        glm::vec3 direction(gaussian(rng), gaussian(rng), gaussian(rng));
+        if (glm::length(direction) < 1e-3f) continue;
+        rays.push_back({origin, glm::normalize(direction), maxDistance});
+    }
+    return rays;
+}
+
+void benchmarkGenerated(int rayCount) {
+    const int chunkSide = 8;
+    auto generator = loadGenerator();
+    ChunkMap chunks = generateChunks(*generator, glm::ivec2(0, 0), glm::ivec2(chunkSide - 1, chunkSide - 1));
+    ChunkView::Lookup lookup = lookupIn(chunks);
+    LockedWorld locked{&chunks, {}};
+
+    std::cout << "Generated terrain (" << chunks.size() << " chunks, seed " << g_worldConfig.terrain.seed << "):"
+              << std::endl;
+
+    const std::pair<const char*, float> kinds[] = {{"reach", 5.0f}, {"line of sight", 48.0f}};
+    for (const auto& [name, maxDistance] : kinds) {
+        int count = maxDistance > 10.0f ? rayCount / 10 : rayCount;
+        std::vector<Ray> rays = makeRays(chunks, chunkSide, count, maxDistance, 42);
+
+        Utils::Timer legacyTimer;
+        int legacyHits = 0;
+        for (const Ray& ray : rays) {
+            legacyHits += legacyRaycast(locked, ray.origin, ray.direction, ray.maxDistance) ? 1 : 0;
+        }
+        double legacyMs = legacyTimer.elapsedMs();
+
+        Utils::Timer singleTimer;
+        std::vector<RaycastHit> single(rays.size());
+        int lookups = 0;
+        for (size_t i = 0; i < rays.size(); ++i) {
+            ChunkView view(lookup);
+            single[i] = VoxelRaycaster::trace(view, rays[i].origin, rays[i].direction, rays[i].maxDistance);
+            lookups += view.getLookups();
+        }
+        double singleMs = singleTimer.elapsedMs();
+
+        Utils::Timer batchTimer;
+        ChunkView batchView(lookup);
+        std::vector<RaycastHit> batch;
+        VoxelRaycaster::traceBatch(batchView, rays, batch);
+        double batchMs = batchTimer.elapsedMs();
+
+        int hits = 0, differing = 0;
+        for (size_t i = 0; i < rays.size(); ++i) {
+            hits += batch[i].hit ? 1 : 0;
+            if (batch[i].hit != single[i].hit || (batch[i].hit && batch[i].blockPos != single[i].blockPos)) differing++;
+        }
+        int wrong = 0, checked = 0;
+        for (size_t i = 0; i < rays.size(); i += maxDistance > 10.0f ? 50 : 20, ++checked) {
+            if (!matchesBruteForce(batchView, rays[i], batch[i])) wrong++;
+        }
+
+        auto perSecond = [&](double ms) { return static_cast<long long>(rays.size() / (ms / 1000.0)); };
+        std::cout << "  " << name << " rays (" << maxDistance << " blocks, " << rays.size() << " rays, " << hits
+                  << " hit; legacy walk " << legacyHits << " hit):" << std::endl;
+        std::cout << "    locked lookup per block: " << perSecond(legacyMs) << " rays/s" << std::endl;
+        std::cout << "    one view per ray:        " << perSecond(singleMs) << " rays/s, "
+                  << static_cast<double>(lookups) / rays.size() << " chunk lookups per ray" << std::endl;
+        std::cout << "    one view per batch:      " << perSecond(batchMs) << " rays/s, " << batchView.getLookups()
+                  << " chunk lookups in all (" << legacyMs / batchMs << "x the locked walk)" << std::endl;
+
+        check(differing == 0, std::string(name) + ": batch and single rays agree");
+        check(wrong == 0, std::string(name) + ": hits match a brute-force test of " + std::to_string(checked) +
+                              " rays (" + std::to_string(wrong) + " wrong)");
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int rays = argc > 1 ? std::max(10, std::atoi(argv[1])) : 200000;
+
+    checkPlacedBlocks();
+    benchmarkGenerated(rays);
+
+    return finishChecks();
+}
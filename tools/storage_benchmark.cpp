@@ -0,0 +1,104 @@
+/**
+ * Storage Benchmark - region file loading vs terrain regeneration
+ *
+ * Generates a square of chunks, saves them through ChunkStorage, then reloads
+ * them from a fresh storage instance and reports both paths in chunks/second.
+ * Runs headless - no window or GL context is created.
+ *
+ * Usage: storage_benchmark [radius] [directory]
+ */
+#include "world/Chunk.h"
+#include "world/ChunkStorage.h"
+#include "world/ModularWorldGenerator.h"
+#include "world/WorldConfig.h"
+#include "utils/ModernCpp.h"
+#include <filesystem>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+void printResult(const std::string& label, int chunks, double ms) {
+    double chunksPerSecond = ms > 0.0 ? chunks * 1000.0 / ms : 0.0;
+    std::cout << std::left << std::setw(22) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1) << ms << " ms"
+              << std::setw(12) << std::setprecision(0) << chunksPerSecond << " chunks/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int radius = argc > 1 ? std::stoi(argv[1]) : 8;
+    std::string directory = argc > 2 ? argv[2] : "storage_benchmark_world";
+
+    g_worldConfig.loadFromFile("world_config.ini");
+    std::filesystem::remove_all(directory);
+
+    auto generator = ModularWorldGenerator::createDefault(g_worldConfig.terrain.seed);
+
+    std::vector<glm::ivec2> positions;
+    for (int x = -radius; x < radius; ++x) {
+        for (int z = -radius; z < radius; ++z) {
+            positions.emplace_back(x, z);
+        }
+    }
+    const int chunkCount = static_cast<int>(positions.size());
+    std::cout << "Storage benchmark: " << chunkCount << " chunks, seed " << g_worldConfig.terrain.seed << std::endl;
+
+    // 1. Regenerate from noise (what every chunk reload cost before persistence)
+    std::vector<std::unique_ptr<Chunk>> generated;
+    generated.reserve(positions.size());
+    Utils::Timer generateTimer;
+    for (const auto& pos : positions) {
+        auto chunk = std::make_unique<Chunk>(pos, generator.get(), false);
+        chunk->generateTerrainOnly();
+        generated.push_back(std::move(chunk));
+    }
+    double generateMs = generateTimer.elapsedMs();
+
+    // 2. Save through the background I/O thread and wait for it to finish
+    Utils::Timer saveTimer;
+    {
+        ChunkStorage storage(directory, generator->getSignature(), g_worldConfig.persistence.compressionLevel);
+        for (const auto& chunk : generated) {
+            storage.saveChunkAsync(chunk->getPosition(), chunk->getBlockData());
+        }
+        storage.flush();
+    }
+    double saveMs = saveTimer.elapsedMs();
+
+    // 3. Reload from a fresh storage instance (mmap + decompress only)
+    int mismatches = 0;
+    ChunkStorage storage(directory, generator->getSignature(), g_worldConfig.persistence.compressionLevel);
+    Utils::Timer loadTimer;
+    for (const auto& chunk : generated) {
+        Chunk loaded(chunk->getPosition(), nullptr, false);
+        std::vector<BlockType> blocks;
+        if (!storage.loadChunk(chunk->getPosition(), blocks) || !loaded.loadBlockData(std::move(blocks)) ||
+            loaded.getBlockData() != chunk->getBlockData()) {
+            mismatches++;
+        }
+    }
+    double loadMs = loadTimer.elapsedMs();
+
+    std::uintmax_t bytesOnDisk = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        bytesOnDisk += entry.file_size();
+    }
+
+    printResult("Regenerate", chunkCount, generateMs);
+    printResult("Save (async, flushed)", chunkCount, saveMs);
+    printResult("Load from disk", chunkCount, loadMs);
+    std::cout << "Speedup: " << std::setprecision(1) << (loadMs > 0.0 ? generateMs / loadMs : 0.0) << "x, "
+              << bytesOnDisk / 1024 << " KB on disk ("
+              << bytesOnDisk / chunkCount << " bytes/chunk)" << std::endl;
+
+    if (mismatches > 0) {
+        std::cerr << "ERROR: " << mismatches << " chunks did not round-trip correctly" << std::endl;
+        return 1;
+    }
+    return 0;
+}
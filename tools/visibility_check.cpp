@@ -0,0 +1,248 @@
+/**
+ * Visibility Check - section connectivity and the visibility graph on known layouts
+ *
+ * Builds synthetic chunks (solid stone, open air, sealed caves, tunnels),
+ * checks their face connectivity and which sections the graph walk reaches
+ * from a fixed camera, then times both on generated terrain.
+ * Runs headless - no window or GL context is created.
+ *
+ * This is the correctness gate for the visibility culler: any layout whose
+ * result changes fails the run.
+ *
+ * Usage: visibility_check
+ */
+#include "world/Chunk.h"
+#include "world/VisibilityGraph.h"
+#include "utils/ModernCpp.h"
+#include "ToolChecks.h"
+#include <array>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Blocks = std::vector<BlockType>;
+using Sections = std::array<SectionVisibility, SECTION_COUNT>;
+using Layout = std::function<Blocks(const glm::ivec2& chunkPos)>;
+using Face = SectionVisibility::Face;
+
+Blocks filled(BlockType type) {
+    return Blocks(CHUNK_SIZE * CHUNK_SIZE * CHUNK_HEIGHT, type);
+}
+
+// Set a box of blocks, local coordinates, bounds inclusive
+void fillBox(Blocks& blocks, const glm::ivec3& min, const glm::ivec3& max, BlockType type) {
+    for (int y = min.y; y <= max.y; ++y) {
+        for (int z = min.z; z <= max.z; ++z) {
+            for (int x = min.x; x <= max.x; ++x) {
+                blocks[x + z * CHUNK_SIZE + y * CHUNK_SIZE * CHUNK_SIZE] = type;
+            }
+        }
+    }
+}
+
+Sections computeSections(const Blocks& blocks) {
+    Sections sections;
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        sections[section] = SectionVisibility::compute(blocks, section);
+    }
+    return sections;
+}
+
+// Visibility of every chunk within radius of the origin, built from a layout
+struct TestWorld {
+    std::unordered_map<glm::ivec2, Sections, ChunkPositionHash> chunks;
+
+    TestWorld(int radius, const Layout& layout) {
+        for (int x = -radius; x <= radius; ++x) {
+            for (int z = -radius; z <= radius; ++z) {
+                chunks[glm::ivec2(x, z)] = computeSections(layout(glm::ivec2(x, z)));
+            }
+        }
+    }
+
+    VisibilityGraph::ColumnLookup lookup() const {
+        return [this](const glm::ivec2& chunkPos) -> const SectionVisibility* {
+            auto it = chunks.find(chunkPos);
+            return it != chunks.end() ? it->second.data() : nullptr;
+        };
+    }
+};
+
+int countVisibleChunks(const VisibilityGraph& graph, int radius) {
+    int visible = 0;
+    for (int x = -radius; x <= radius; ++x) {
+        for (int z = -radius; z <= radius; ++z) {
+            visible += graph.isChunkVisible(glm::ivec2(x, z));
+        }
+    }
+    return visible;
+}
+
+void checkSections() {
+    std::cout << "Section connectivity:" << std::endl;
+
+    check(SectionVisibility::compute(filled(BlockType::STONE), 0).getBits() == 0, "solid stone connects nothing");
+    check(SectionVisibility::compute(filled(BlockType::AIR), 0).isOpen(), "open air connects every face pair");
+    check(SectionVisibility::compute(filled(BlockType::WATER), 0).isOpen(), "water is see-through");
+
+    // A 2x2 tunnel straight along X through section 1
+    Blocks tunnel = filled(BlockType::STONE);
+    fillBox(tunnel, glm::ivec3(0, 23, 7), glm::ivec3(15, 24, 8), BlockType::AIR);
+    SectionVisibility tunnelSection = SectionVisibility::compute(tunnel, 1);
+    check(tunnelSection.connects(Face::NEG_X, Face::POS_X), "X tunnel connects -X and +X");
+    check(!tunnelSection.connects(Face::NEG_X, Face::POS_Z), "X tunnel does not connect -X and +Z");
+    check(!tunnelSection.connects(Face::NEG_Y, Face::POS_Y), "X tunnel does not connect -Y and +Y");
+    check(SectionVisibility::compute(tunnel, 0).getBits() == 0, "sections beside the tunnel stay sealed");
+
+    // Two separate shafts - one vertical, one along Z - must not join up
+    Blocks shafts = filled(BlockType::STONE);
+    fillBox(shafts, glm::ivec3(2, 16, 2), glm::ivec3(2, 31, 2), BlockType::AIR);
+    fillBox(shafts, glm::ivec3(12, 20, 0), glm::ivec3(12, 20, 15), BlockType::AIR);
+    SectionVisibility shaftSection = SectionVisibility::compute(shafts, 1);
+    check(shaftSection.connects(Face::NEG_Y, Face::POS_Y), "vertical shaft connects -Y and +Y");
+    check(shaftSection.connects(Face::NEG_Z, Face::POS_Z), "Z shaft connects -Z and +Z");
+    check(!shaftSection.connects(Face::POS_Y, Face::POS_Z), "separate shafts stay separate");
+
+    // Leaves let sight through a wall
+    Blocks leafWall = filled(BlockType::STONE);
+    fillBox(leafWall, glm::ivec3(0, 20, 4), glm::ivec3(15, 20, 4), BlockType::AIR);
+    fillBox(leafWall, glm::ivec3(8, 20, 4), glm::ivec3(8, 20, 4), BlockType::LEAVES);
+    check(SectionVisibility::compute(leafWall, 1).connects(Face::NEG_X, Face::POS_X), "leaves do not block a tunnel");
+}
+
+void checkGraph() {
+    std::cout << "Visibility graph:" << std::endl;
+    const int radius = 6;
+    const int side = 2 * radius + 1;
+    const glm::vec3 caveCamera(8.5f, 24.5f, 8.5f);   // Chunk (0, 0), section 1
+    VisibilityGraph graph;
+
+    // The camera's own section is left through every face - the camera may sit right
+    // against one - so its six neighbours always show.
+    
+    // Sealed cave: a pocket in the camera's section that touches none of its faces
+    TestWorld sealed(radius, [](const glm::ivec2& chunkPos) {
+        Blocks blocks = filled(BlockType::STONE);
+        if (chunkPos == glm::ivec2(0, 0)) {
+            fillBox(blocks, glm::ivec3(4, 20, 4), glm::ivec3(11, 27, 11), BlockType::AIR);
+        }
+        return blocks;
+    });
+    graph.compute(caveCamera, radius, sealed.lookup());
+    check(graph.getVisibleSections() == 7, "sealed cave: only the camera's section and its neighbours");
+    check(countVisibleChunks(graph, radius) == 5, "sealed cave: every other chunk is culled");
+
+    // Open air: nothing is hidden
+    TestWorld open(radius, [](const glm::ivec2&) { return filled(BlockType::AIR); });
+    graph.compute(caveCamera, radius, open.lookup());
+    check(graph.getVisibleSections() == side * side * SECTION_COUNT, "open air: every section is visible");
+
+    // Straight tunnel from the camera out along +X for four chunks
+    TestWorld tunnel(radius, [](const glm::ivec2& chunkPos) {
+        Blocks blocks = filled(BlockType::STONE);
+        if (chunkPos.y == 0 && chunkPos.x >= 0 && chunkPos.x <= 4) {
+            int startX = chunkPos.x == 0 ? 4 : 0;
+            int endX = chunkPos.x == 4 ? 8 : 15;
+            fillBox(blocks, glm::ivec3(startX, 23, 7), glm::ivec3(endX, 25, 9), BlockType::AIR);
+        }
+        return blocks;
+    });
+    graph.compute(caveCamera, radius, tunnel.lookup());
+    check(graph.getVisibleSections() == 7 + 3, "tunnel: the camera's neighbours and three more along it");
+    check(graph.isSectionVisible(glm::ivec3(4, 1, 0)) && !graph.isSectionVisible(glm::ivec3(5, 1, 0)),
+          "tunnel: visibility stops where the tunnel does");
+    check(!graph.isSectionVisible(glm::ivec3(1, 2, 0)), "tunnel: the rock above it is culled");
+
+    // U-bend: +X, turn +Z, then back along -X. Sight can't turn back towards the camera
+    TestWorld bend(radius, [](const glm::ivec2& chunkPos) {
+        Blocks blocks = filled(BlockType::STONE);
+        auto dig = [&](int minX, int maxX, int minZ, int maxZ) {
+            fillBox(blocks, glm::ivec3(minX, 23, minZ), glm::ivec3(maxX, 25, maxZ), BlockType::AIR);
+        };
+        if (chunkPos == glm::ivec2(0, 0)) dig(4, 15, 7, 9);
+        if (chunkPos == glm::ivec2(1, 0)) dig(0, 15, 7, 9);
+        if (chunkPos == glm::ivec2(2, 0)) { dig(0, 9, 7, 9); dig(7, 9, 7, 15); }
+        if (chunkPos == glm::ivec2(2, 1)) { dig(7, 9, 0, 9); dig(0, 9, 7, 9); }
+        if (chunkPos == glm::ivec2(1, 1)) dig(0, 15, 7, 9);
+        if (chunkPos == glm::ivec2(0, 1)) dig(0, 15, 7, 9);
+        return blocks;
+    });
+    graph.compute(caveCamera, radius, bend.lookup());
+    check(graph.getVisibleSections() == 7 + 2, "U-bend: visible up to the turn");
+    check(graph.isSectionVisible(glm::ivec3(2, 1, 1)) && !graph.isSectionVisible(glm::ivec3(1, 1, 1)),
+          "U-bend: the leg leading back is culled");
+
+    // From above the world every column's top section shows, nothing under solid rock
+    TestWorld solid(radius, [](const glm::ivec2&) { return filled(BlockType::STONE); });
+    graph.compute(glm::vec3(8.5f, CHUNK_HEIGHT + 20.0f, 8.5f), radius, solid.lookup());
+    check(graph.getVisibleSections() == side * side, "above solid ground: only the top layer is visible");
+
+    // Chunks that aren't loaded hide nothing
+    graph.compute(caveCamera, radius, [](const glm::ivec2&) -> const SectionVisibility* { return nullptr; });
+    check(graph.getVisibleSections() == side * side * SECTION_COUNT, "unloaded chunks are treated as open");
+
+    // Frustum filter: sections it rejects are neither visible nor walked through
+    graph.compute(caveCamera, radius, open.lookup(), [](const glm::ivec3& section) { return section.x >= 0; });
+    check(graph.getVisibleSections() == (radius + 1) * side * SECTION_COUNT, "filtered sections are not walked");
+}
+
+void benchmarkGenerated() {
+    const int radius = 12;
+    auto generator = loadGenerator();
+
+    std::cout << "Generated terrain (radius " << radius << ", seed " << g_worldConfig.terrain.seed << "):" << std::endl;
+    std::unordered_map<glm::ivec2, Sections, ChunkPositionHash> chunks;
+    double computeMs = 0.0;
+    std::mutex resultMutex;
+    std::vector<glm::ivec2> positions = chunksBetween(glm::ivec2(-radius), glm::ivec2(radius));
+    forEachGeneratedChunk(*generator, positions, [&](size_t i, Chunk& chunk) {
+        Utils::Timer timer;
+        Sections sections = computeSections(chunk.getBlockData());
+        double elapsed = timer.elapsedMs();
+        std::lock_guard<std::mutex> lock(resultMutex);
+        computeMs += elapsed;
+        chunks[positions[i]] = sections;
+    });
+    int chunkCount = (2 * radius + 1) * (2 * radius + 1);
+    std::cout << "  Section fill: " << computeMs / chunkCount << " ms per chunk" << std::endl;
+
+    auto lookup = [&](const glm::ivec2& chunkPos) -> const SectionVisibility* {
+        auto it = chunks.find(chunkPos);
+        return it != chunks.end() ? it->second.data() : nullptr;
+    };
+
+    int surface = generator->getTerrainHeight(8, 8);
+    const std::pair<const char*, glm::vec3> cameras[] = {
+        {"above the surface", glm::vec3(8.5f, surface + 2.5f, 8.5f)},
+        {"underground", glm::vec3(8.5f, 6.5f, 8.5f)},
+        {"flying high", glm::vec3(8.5f, CHUNK_HEIGHT + 30.0f, 8.5f)},
+    };
+
+    VisibilityGraph graph;
+    for (const auto& [name, camera] : cameras) {
+        const int runs = 20;
+        Utils::Timer timer;
+        for (int run = 0; run < runs; ++run) {
+            graph.compute(camera, radius, lookup);
+        }
+        double walkMs = timer.elapsedMs() / runs;
+        std::cout << "  Camera " << name << ": " << countVisibleChunks(graph, radius) << " / " << chunkCount
+                  << " chunks, " << graph.getVisibleSections() << " / " << chunkCount * SECTION_COUNT
+                  << " sections visible, walk " << walkMs << " ms" << std::endl;
+    }
+}
+
+} // namespace
+
+int main() {
+    checkSections();
+    checkGraph();
+    benchmarkGenerated();
+
+    return finishChecks();
+}